@@ -239,9 +239,21 @@ class V8_PLATFORM_EXPORT TracingController
   ~TracingController() override;
 
 #if defined(V8_USE_PERFETTO)
+  enum class OutputFormat {
+    // Convert the trace into the legacy JSON trace event format when tracing
+    // stops. This requires parsing the whole trace with the trace processor.
+    kJSON,
+    // Write the serialized Perfetto trace protobuf as is. This avoids the
+    // conversion cost and preserves the typed track events, but requires
+    // Perfetto tools (e.g. ui.perfetto.dev) to consume the output.
+    kProto,
+  };
+
   // Must be called before StartTracing() if V8_USE_PERFETTO is true. Provides
-  // the output stream for the JSON trace data.
-  void InitializeForPerfetto(std::ostream* output_stream);
+  // the output stream for the trace data, which is written in |format|. For
+  // kProto, the stream should be opened in binary mode.
+  void InitializeForPerfetto(std::ostream* output_stream,
+                             OutputFormat format = OutputFormat::kJSON);
   // Provide an optional listener for testing that will receive trace events.
   // Must be called before StartTracing().
   void SetTraceEventListenerForTesting(TraceEventListener* listener);
@@ -311,6 +323,7 @@ class V8_PLATFORM_EXPORT TracingController
 
 #if defined(V8_USE_PERFETTO)
   std::ostream* output_stream_ = nullptr;
+  OutputFormat output_format_ = OutputFormat::kJSON;
   std::unique_ptr<perfetto::trace_processor::TraceProcessorStorage>
       trace_processor_;
   TraceEventListener* listener_for_testing_ = nullptr;
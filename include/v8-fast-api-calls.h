@@ -164,6 +164,8 @@
  *  - uint64_t
  *  - float32_t
  *  - float64_t
+ *  - sequential one-byte strings (FastOneByteString)
+ *  - sequential two-byte strings (FastTwoByteString)
  *
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
@@ -248,6 +250,8 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kSeqOneByteString,
+    kSeqTwoByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
     kAny,        // This is added to enable untyped representation of fast
@@ -379,6 +383,20 @@ struct FastApiArrayBuffer {
   size_t byte_length;
 };
 
+// A JS string argument whose characters are stored contiguously in the V8
+// heap as Latin-1 or UTF-16 code units respectively. Calls with strings that
+// have a different encoding or aren't flat take the slow path. The data is
+// only valid for the duration of the fast call and must not be retained.
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
+struct FastTwoByteString {
+  const uint16_t* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   // Construct a struct to hold a CFunction's type information.
@@ -438,6 +456,8 @@ struct AnyCType {
     const FastApiTypedArray<uint64_t>* uint64_ta_value;
     const FastApiTypedArray<float>* float_ta_value;
     const FastApiTypedArray<double>* double_ta_value;
+    const FastOneByteString* one_byte_string_value;
+    const FastTwoByteString* two_byte_string_value;
     FastApiCallbackOptions* options_value;
   };
 };
@@ -660,11 +680,13 @@ struct CTypeInfoTraits {};
   V(uint8_t, kUint8)
 
 // Same as above, but includes deprecated types for compatibility.
-#define ALL_C_TYPES(V)               \
-  PRIMITIVE_C_TYPES(V)               \
-  V(void, kVoid)                     \
-  V(v8::Local<v8::Value>, kV8Value)  \
-  V(v8::Local<v8::Object>, kV8Value) \
+#define ALL_C_TYPES(V)                           \
+  PRIMITIVE_C_TYPES(V)                           \
+  V(void, kVoid)                                 \
+  V(v8::Local<v8::Value>, kV8Value)              \
+  V(v8::Local<v8::Object>, kV8Value)             \
+  V(const FastOneByteString&, kSeqOneByteString) \
+  V(const FastTwoByteString&, kSeqTwoByteString) \
   V(AnyCType, kAny)
 
 // ApiObject was a temporary solution to wrap the pointer to the v8::Value.
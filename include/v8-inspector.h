@@ -336,6 +336,11 @@ class V8_EXPORT V8Inspector {
   virtual void asyncTaskStarted(void* task) = 0;
   virtual void asyncTaskFinished(void* task) = 0;
   virtual void allAsyncTasksCanceled() = 0;
+  // Record scheduled async tasks into a fixed-size buffer and only build
+  // their async stack traces when a pause or stack trace capture needs them.
+  // Tasks that are still pending once the buffer wraps around lose their
+  // async stack trace.
+  virtual void setLazyAsyncStackTraces(bool lazy) {}
 
   virtual V8StackTraceId storeCurrentStackTrace(StringView description) = 0;
   virtual void externalAsyncTaskStarted(const V8StackTraceId& parent) = 0;
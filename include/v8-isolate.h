@@ -152,6 +152,17 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * The fraction of CPU time, in the range (0, 1), that the garbage collector
+   * should aim to use relative to the mutator. The old generation allocation
+   * limit is derived from this target and the measured GC and allocation
+   * throughput at each full GC. A value of 0 uses V8's default target.
+   */
+  double target_gc_cpu_fraction() const { return target_gc_cpu_fraction_; }
+  void set_target_gc_cpu_fraction(double fraction) {
+    target_gc_cpu_fraction_ = fraction;
+  }
+
  private:
   static constexpr size_t kMB = 1048576u;
   size_t code_range_size_ = 0;
@@ -159,6 +170,7 @@ class V8_EXPORT ResourceConstraints {
   size_t max_young_generation_size_ = 0;
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
+  double target_gc_cpu_fraction_ = 0.0;
   uint32_t* stack_limit_ = nullptr;
 };
 
@@ -812,6 +824,16 @@ class V8_EXPORT Isolate {
       std::unique_ptr<MeasureMemoryDelegate> delegate,
       MeasureMemoryExecution execution = MeasureMemoryExecution::kDefault);
 
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Returns the number of live bytes attributed to the given context by the
+   * last full GC, with kilobyte granularity. Attribution runs as part of
+   * regular marking when --continuous-memory-attribution is enabled;
+   * otherwise this returns 0.
+   */
+  size_t GetContextLiveBytesAtLastGC(Local<Context> context);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -1312,6 +1334,17 @@ class V8_EXPORT Isolate {
    */
   bool IdleNotificationDeadline(double deadline_in_seconds);
 
+  /**
+   * Optional notification that the embedder is idle for the next
+   * idle_time_in_ms milliseconds, starting now. This is equivalent to
+   * IdleNotificationDeadline() with a deadline computed from
+   * MonotonicallyIncreasingTime() and is meant for embedders, such as
+   * request/response servers, that know the length of the idle period rather
+   * than its end. V8 may use the period for incremental marking, to finalize
+   * marking, or, with --idle-time-scavenge, for a young generation GC.
+   */
+  bool IdleNotificationForMilliseconds(double idle_time_in_ms);
+
   /**
    * Optional notification that the system is running low on memory.
    * V8 uses these notifications to attempt to free memory.
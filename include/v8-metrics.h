@@ -28,6 +28,18 @@ struct GarbageCollectionPhases {
   int64_t weak_wall_clock_duration_in_us = -1;
 };
 
+// Main-thread durations of the individual phases of an atomic pause. As for
+// the other metrics, -1 means that a value was not reported. Phases that do
+// not apply to the collector that ran, like sweeping for the Scavenger, are
+// reported as zero.
+struct GarbageCollectionDetailedPhases {
+  int64_t roots_wall_clock_duration_in_us = -1;
+  int64_t weak_wall_clock_duration_in_us = -1;
+  int64_t evacuate_wall_clock_duration_in_us = -1;
+  int64_t update_pointers_wall_clock_duration_in_us = -1;
+  int64_t sweep_wall_clock_duration_in_us = -1;
+};
+
 struct GarbageCollectionSizes {
   int64_t bytes_before = -1;
   int64_t bytes_after = -1;
@@ -42,6 +54,7 @@ struct GarbageCollectionFullCycle {
   GarbageCollectionPhases main_thread_cpp;
   GarbageCollectionPhases main_thread_atomic;
   GarbageCollectionPhases main_thread_atomic_cpp;
+  GarbageCollectionDetailedPhases main_thread_atomic_detailed;
   GarbageCollectionPhases main_thread_incremental;
   GarbageCollectionPhases main_thread_incremental_cpp;
   GarbageCollectionSizes objects;
@@ -82,6 +95,7 @@ struct GarbageCollectionYoungCycle {
   int reason = -1;
   int64_t total_wall_clock_duration_in_us = -1;
   int64_t main_thread_wall_clock_duration_in_us = -1;
+  GarbageCollectionDetailedPhases main_thread_detailed;
   double collection_rate_in_percent = -1.0;
   double efficiency_in_bytes_per_us = -1.0;
   double main_thread_efficiency_in_bytes_per_us = -1.0;
@@ -129,6 +143,16 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+struct Deoptimization {
+  // Static string describing the DeoptimizeReason.
+  const char* reason = nullptr;
+  bool lazy = false;
+  bool maglev = false;
+  int bytecode_offset = -1;
+  int script_id = -1;
+  int function_start_position = -1;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -181,6 +205,7 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(Deoptimization)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
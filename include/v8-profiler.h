@@ -209,7 +209,8 @@ class V8_EXPORT OutputStream {
 class V8_EXPORT CpuProfile {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,  // See format description near 'Serialize' method.
+    kPprof = 1  // See format description near 'Serialize' method.
   };
   /** Returns CPU profile title. */
   Local<String> GetTitle() const;
@@ -280,6 +281,9 @@ class V8_EXPORT CpuProfile {
    *    timeDeltas: [numbers array]
    *  }
    *
+   * For the pprof format, the stream receives a binary (not ASCII) encoding
+   * of the perftools.profiles.Profile protocol buffer message, with one
+   * sample per profile node and source line that has self ticks.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -803,6 +807,15 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * The number of garbage collections of any kind, and the number of full
+     * (mark-compact) garbage collections, that happened between the sampled
+     * allocation and the time this profile was taken. Together with
+     * |sample_id| this tells long-lived objects apart from recent ones.
+     */
+    unsigned int gcs_survived;
+    unsigned int full_gcs_survived;
   };
 
   /**
@@ -1065,6 +1078,29 @@ class V8_EXPORT HeapProfiler {
       ObjectNameResolver* global_object_name_resolver = nullptr,
       bool hide_internals = true, bool capture_numeric_value = false);
 
+  /**
+   * Takes a heap snapshot and serializes it to |stream| in JSON format while
+   * it is being generated. Unlike `TakeHeapSnapshot()` followed by
+   * `HeapSnapshot::Serialize()`, the edges of the graph are never kept in
+   * memory, which bounds the memory overhead of taking a snapshot of a large
+   * heap.
+   *
+   * The resulting layout differs from the regular one: the "edges" section
+   * comes first, is not grouped by owner node, and every edge record is
+   * prefixed by the index of its owner node as described by
+   * "snapshot.meta.streamed_edge_fields". Tools need to sort edges by owner
+   * node and drop that field to obtain the regular layout.
+   *
+   * |stream| is written to while the heap is paused and must not call into
+   * V8.
+   *
+   * \returns false if generation was cancelled by `options.control` or the
+   * stream aborted, in which case the end of stream is not signaled.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream,
+      const HeapSnapshotOptions& options = HeapSnapshotOptions());
+
   /**
    * Starts tracking of heap objects population statistics. After calling
    * this method, all heap objects relocations done by the garbage collector
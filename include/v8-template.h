@@ -782,6 +782,22 @@ class V8_EXPORT ObjectTemplate : public Template {
   /** Creates a new instance of this template.*/
   V8_WARN_UNUSED_RESULT MaybeLocal<Object> NewInstance(Local<Context> context);
 
+  /**
+   * Creates |count| new instances of this template and stores them in
+   * |instances|, which must have room for |count| elements. This is
+   * equivalent to calling NewInstance() |count| times but cheaper.
+   *
+   * If |internal_fields| is not null, it must hold |count| *
+   * InternalFieldCount() aligned pointers, and the i-th instance gets
+   * internal_fields[i * InternalFieldCount() + j] as its j-th internal field.
+   *
+   * Returns Nothing if an exception was thrown, in which case the contents
+   * of |instances| are unspecified.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> NewInstances(
+      Local<Context> context, int count, Local<Object> instances[],
+      void* const internal_fields[] = nullptr);
+
   /**
    * Sets an accessor on the object template.
    *
@@ -163,6 +163,11 @@ class V8_EXPORT ValueSerializer {
    * Marks an ArrayBuffer as havings its contents transferred out of band.
    * Pass the corresponding ArrayBuffer in the deserializing context to
    * ValueDeserializer::TransferArrayBuffer.
+   *
+   * Only |transfer_id| is written to the stream, not the contents. Embedders
+   * that move messages between processes can use this to send large buffers
+   * through their own transport (e.g. shared memory), and create the receiving
+   * ArrayBuffer over the mapped memory with ArrayBuffer::NewBackingStore.
    */
   void TransferArrayBuffer(uint32_t transfer_id,
                            Local<ArrayBuffer> array_buffer);
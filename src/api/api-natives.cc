@@ -600,6 +600,14 @@ MaybeHandle<JSObject> ApiNatives::InstantiateObject(
   return ::v8::internal::InstantiateObject(isolate, data, new_target, false);
 }
 
+// static
+MaybeHandle<JSObject> ApiNatives::GetCachedInstantiation(
+    Isolate* isolate, Handle<ObjectTemplateInfo> data) {
+  if (!data->should_cache() || !data->is_cached()) return {};
+  return ProbeInstantiationsCache(isolate, isolate->native_context(),
+                                  data->serial_number(), CachingMode::kLimited);
+}
+
 MaybeHandle<JSObject> ApiNatives::InstantiateRemoteObject(
     Handle<ObjectTemplateInfo> data) {
   Isolate* isolate = data->GetIsolate();
@@ -36,6 +36,12 @@ class ApiNatives {
       Isolate* isolate, Handle<ObjectTemplateInfo> data,
       Handle<JSReceiver> new_target = Handle<JSReceiver>());
 
+  // Returns the cached instance of {data} that InstantiateObject() would copy
+  // to create a new instance, if there is one. The result must not be handed
+  // out, only copied.
+  static MaybeHandle<JSObject> GetCachedInstantiation(
+      Isolate* isolate, Handle<ObjectTemplateInfo> data);
+
   V8_WARN_UNUSED_RESULT static MaybeHandle<JSObject> InstantiateRemoteObject(
       Handle<ObjectTemplateInfo> data);
 
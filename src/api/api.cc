@@ -2565,6 +2565,13 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
               no_cache_reason, i::NOT_NATIVES_CODE);
       source->cached_data->rejected = cached_data->rejected();
     }
+  } else if (source->compile_hint_callback) {
+    // Compile without any cache, but with compile hints from the embedder.
+    maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+            i_isolate, str, script_details, source->compile_hint_callback,
+            source->compile_hint_callback_data, options, no_cache_reason,
+            i::NOT_NATIVES_CODE);
   } else {
     // Compile without any cache.
     maybe_function_info = i::Compiler::GetSharedFunctionInfoForScript(
@@ -6833,6 +6840,56 @@ MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> ObjectTemplate::NewInstances(Local<Context> context, int count,
+                                         Local<Object> instances[],
+                                         void* const internal_fields[]) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  const char* location = "v8::ObjectTemplate::NewInstances()";
+  if (!Utils::ApiCheck(count >= 0, location, "Negative count")) {
+    return Nothing<bool>();
+  }
+  // The instances belong to the caller's HandleScope, while everything else
+  // created below is released on return, so reserve the result slots first.
+  for (int i = 0; i < count; i++) {
+    instances[i] = ToApiHandle<Object>(
+        i::handle(i::ReadOnlyRoots(isolate).undefined_value(), isolate));
+  }
+  PREPARE_FOR_EXECUTION_WITH_CONTEXT(context, ObjectTemplate, NewInstances,
+                                     Nothing<bool>(), i::HandleScope, false);
+  auto self = Utils::OpenHandle(this);
+  const int field_count = self->embedder_field_count();
+  i::Handle<i::JSObject> cached;
+  for (int i = 0; i < count; i++) {
+    if (i == 1) {
+      // Once the first instance is in the instantiation cache, the remaining
+      // ones are plain copies of it.
+      i::ApiNatives::GetCachedInstantiation(i_isolate, self).ToHandle(&cached);
+    }
+    i::HandleScope instance_scope(i_isolate);
+    i::Handle<i::JSObject> object;
+    if (!cached.is_null()) {
+      object = i_isolate->factory()->CopyJSObject(cached);
+    } else {
+      has_pending_exception =
+          !i::ApiNatives::InstantiateObject(i_isolate, self).ToHandle(&object);
+      RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    }
+    if (internal_fields != nullptr) {
+      i::DisallowGarbageCollection no_gc;
+      i::JSObject raw = *object;
+      DCHECK_EQ(field_count, raw.GetEmbedderFieldCount());
+      for (int j = 0; j < field_count; j++) {
+        Utils::ApiCheck(i::EmbedderDataSlot(raw, j).store_aligned_pointer(
+                            i_isolate, internal_fields[i * field_count + j]),
+                        location, "Unaligned pointer");
+      }
+      internal::WriteBarrier::MarkingFromInternalFields(raw);
+    }
+    *reinterpret_cast<i::Address*>(*instances[i]) = object->ptr();
+  }
+  return Just(true);
+}
+
 void v8::ObjectTemplate::CheckCast(Data* that) {
   i::Handle<i::Object> obj = Utils::OpenHandle(that);
   Utils::ApiCheck(obj->IsObjectTemplateInfo(), "v8::ObjectTemplate::Cast",
@@ -9232,6 +9289,13 @@ bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
   return i_isolate->heap()->MeasureMemory(std::move(delegate), execution);
 }
 
+size_t Isolate::GetContextLiveBytesAtLastGC(Local<Context> context) {
+  i::NativeContext native_context =
+      Utils::OpenHandle(*context)->native_context();
+  return static_cast<size_t>(native_context.live_kb_at_last_gc().value()) *
+         i::KB;
+}
+
 std::unique_ptr<MeasureMemoryDelegate> MeasureMemoryDelegate::Default(
     Isolate* v8_isolate, Local<Context> context,
     Local<Promise::Resolver> promise_resolver, MeasureMemoryMode mode) {
@@ -9418,6 +9482,16 @@ bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
   return i_isolate->heap()->IdleNotification(deadline_in_seconds);
 }
 
+bool Isolate::IdleNotificationForMilliseconds(double idle_time_in_ms) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!i::v8_flags.use_idle_notification) return true;
+  const double deadline_in_seconds =
+      i::V8::GetCurrentPlatform()->MonotonicallyIncreasingTime() +
+      idle_time_in_ms /
+          static_cast<double>(base::Time::kMillisecondsPerSecond);
+  return i_isolate->heap()->IdleNotification(deadline_in_seconds);
+}
+
 void Isolate::LowMemoryNotification() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   {
@@ -10104,10 +10178,15 @@ static i::CpuProfile* ToInternal(const CpuProfile* profile) {
 
 void CpuProfile::Serialize(OutputStream* stream,
                            CpuProfile::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::CpuProfile::Serialize",
-                  "Unknown serialization format");
+  Utils::ApiCheck(format == kJSON || format == kPprof,
+                  "v8::CpuProfile::Serialize", "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::CpuProfile::Serialize",
                   "Invalid stream chunk size");
+  if (format == kPprof) {
+    i::CpuProfilePprofSerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::CpuProfileJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -10470,6 +10549,12 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(ActivityControl* control,
   return TakeHeapSnapshot(options);
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(
+    OutputStream* stream, const HeapSnapshotOptions& options) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      options, stream);
+}
+
 void HeapProfiler::StartTrackingHeapObjects(bool track_allocations) {
   reinterpret_cast<i::HeapProfiler*>(this)->StartHeapObjectsTracking(
       track_allocations);
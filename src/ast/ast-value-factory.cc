@@ -27,11 +27,14 @@
 
 #include "src/ast/ast-value-factory.h"
 
+#include <vector>
+
 #include "src/base/hashmap-entry.h"
 #include "src/base/logging.h"
 #include "src/common/globals.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/objects/string-table.h"
 #include "src/objects/string.h"
 #include "src/strings/string-hasher.h"
 #include "src/utils/utils-inl.h"
@@ -366,13 +369,35 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. Non-empty one-byte strings, which are the vast majority, are
+  // internalized as one batch, so that the string table lock is only taken
+  // once for all of the new ones.
+  std::vector<AstRawString*> one_byte_strings;
+  std::vector<OneByteStringKey> one_byte_keys;
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->is_one_byte() && !current->IsEmpty()) {
+      one_byte_strings.push_back(current);
+      one_byte_keys.emplace_back(current->raw_hash_field_,
+                                 current->literal_bytes_);
+    } else {
+      current->Internalize(isolate);
+    }
     current = next;
   }
 
+  if (!one_byte_strings.empty()) {
+    std::vector<OneByteStringKey*> keys;
+    keys.reserve(one_byte_keys.size());
+    for (OneByteStringKey& key : one_byte_keys) keys.push_back(&key);
+    std::vector<Handle<String>> results(keys.size());
+    isolate->string_table()->LookupKeys(isolate, base::VectorOf(keys),
+                                        results.data());
+    for (size_t i = 0; i < one_byte_strings.size(); ++i) {
+      one_byte_strings[i]->set_string(results[i]);
+    }
+  }
+
   ResetStrings();
 }
 template EXPORT_TEMPLATE_DEFINE(
@@ -345,6 +345,36 @@ V8_BASE_EXPORT int64_t SignedMulHigh64(int64_t lhs, int64_t rhs);
 // those.
 V8_BASE_EXPORT uint64_t UnsignedMulHigh64(uint64_t lhs, uint64_t rhs);
 
+// UnsignedMul128(lhs, rhs, low) multiplies two unsigned 64-bit values |lhs|
+// and |rhs|, stores the least significant 64 bits of the result in |low|, and
+// returns the most significant 64 bits. Unlike UnsignedMulHigh64() this is
+// inlined, for hot paths such as number parsing and printing.
+V8_INLINE uint64_t UnsignedMul128(uint64_t lhs, uint64_t rhs, uint64_t* low) {
+#if defined(__SIZEOF_INT128__)
+  const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+  *low = static_cast<uint64_t>(product);
+  return static_cast<uint64_t>(product >> 64);
+#elif V8_CC_MSVC && defined(_M_X64)
+  uint64_t high;
+  *low = _umul128(lhs, rhs, &high);
+  return high;
+#else
+  const uint64_t lhs_lo = lhs & 0xFFFF'FFFF;
+  const uint64_t lhs_hi = lhs >> 32;
+  const uint64_t rhs_lo = rhs & 0xFFFF'FFFF;
+  const uint64_t rhs_hi = rhs >> 32;
+
+  const uint64_t lo_lo = lhs_lo * rhs_lo;
+  const uint64_t hi_lo = lhs_hi * rhs_lo;
+  const uint64_t lo_hi = lhs_lo * rhs_hi;
+  const uint64_t hi_hi = lhs_hi * rhs_hi;
+
+  const uint64_t mid = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFF) + lo_hi;
+  *low = (mid << 32) | (lo_lo & 0xFFFF'FFFF);
+  return hi_hi + (hi_lo >> 32) + (mid >> 32);
+#endif
+}
+
 // SignedMulHighAndAdd32(lhs, rhs, acc) multiplies two signed 32-bit values
 // |lhs| and |rhs|, extracts the most significant 32 bits of the result, and
 // adds the accumulate value |acc|.
@@ -802,6 +802,33 @@ int OS::GetCurrentThreadId() {
 #endif
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  constexpr uintptr_t kTransparentHugePageSize = 2 * 1024 * 1024;
+  const uintptr_t start = RoundUp(reinterpret_cast<uintptr_t>(address),
+                                  kTransparentHugePageSize);
+  const uintptr_t end = RoundDown(reinterpret_cast<uintptr_t>(address) + size,
+                                  kTransparentHugePageSize);
+  if (end <= start) return false;
+  return madvise(reinterpret_cast<void*>(start), end - start,
+                 MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+int OS::GetCurrentNumaNode() {
+#if V8_OS_LINUX && defined(__NR_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
 void OS::ExitProcess(int exit_code) {
   // Use _exit instead of exit to avoid races between isolate
   // threads and static destructors.
@@ -277,6 +277,11 @@ int OS::GetCurrentProcessId() {
 
 int OS::GetCurrentThreadId() { return SbThreadGetId(); }
 
+int OS::GetCurrentNumaNode() { return -1; }
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 int OS::GetLastError() { return SbSystemGetLastError(); }
 
 // ----------------------------------------------------------------------------
@@ -534,6 +534,17 @@ int OS::GetCurrentThreadId() {
   return static_cast<int>(::GetCurrentThreadId());
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+int OS::GetCurrentNumaNode() {
+  PROCESSOR_NUMBER processor;
+  ::GetCurrentProcessorNumberEx(&processor);
+  USHORT node = 0;
+  if (!::GetNumaProcessorNodeEx(&processor, &node)) return -1;
+  return static_cast<int>(node);
+}
+
 void OS::ExitProcess(int exit_code) {
   // Use TerminateProcess to avoid races between isolate threads and
   // static destructors.
@@ -296,6 +296,10 @@ class V8_BASE_EXPORT OS {
 
   static int GetCurrentThreadId();
 
+  // Returns the NUMA node the calling thread is currently running on, or -1
+  // if this information is not available on the platform.
+  static int GetCurrentNumaNode();
+
   static void AdjustSchedulingParams();
 
   using Address = uintptr_t;
@@ -342,6 +346,11 @@ class V8_BASE_EXPORT OS {
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
+  // Advises the OS to back the huge-page-aligned interior of the given
+  // reserved region with transparent huge pages once it gets committed.
+  // Returns false if this is not supported on the platform.
+  static bool AdviseHugePages(void* address, size_t size);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
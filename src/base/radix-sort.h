@@ -0,0 +1,135 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_RADIX_SORT_H_
+#define V8_BASE_RADIX_SORT_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace base {
+
+namespace radix_sort_internal {
+
+template <typename T, typename = void>
+struct KeyTraits;
+
+// Integers are ordered as unsigned keys once the sign bit is flipped.
+template <typename T>
+struct KeyTraits<T, std::enable_if_t<std::is_integral<T>::value>> {
+  using Key = std::make_unsigned_t<T>;
+  static constexpr Key kFlip =
+      std::is_signed<T>::value ? Key{1} << (sizeof(Key) * 8 - 1) : 0;
+
+  static Key ToKey(T value) { return static_cast<Key>(value) ^ kFlip; }
+  static T FromKey(Key key) { return static_cast<T>(key ^ kFlip); }
+};
+
+// Non-NaN floats are ordered as unsigned keys once positive values get their
+// sign bit set and negative values are inverted. This places -0 before +0.
+template <typename T>
+struct KeyTraits<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  using Key = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  static_assert(sizeof(Key) == sizeof(T));
+  static constexpr Key kSignBit = Key{1} << (sizeof(Key) * 8 - 1);
+
+  static Key ToKey(T value) {
+    Key bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & kSignBit) ? ~bits : bits | kSignBit;
+  }
+  static T FromKey(Key key) {
+    Key bits = (key & kSignBit) ? key & ~kSignBit : ~key;
+    T value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+};
+
+// Sorts keys[0, length) with one counting sort pass per byte, skipping bytes
+// that are the same in all keys. Returns whichever of {keys, scratch} holds
+// the result.
+template <typename Key>
+Key* SortKeys(Key* keys, Key* scratch, size_t length) {
+  constexpr int kPasses = sizeof(Key);
+  constexpr int kBuckets = 256;
+  std::vector<size_t> counts(kPasses * kBuckets);
+  for (size_t i = 0; i < length; i++) {
+    Key key = keys[i];
+    for (int pass = 0; pass < kPasses; pass++) {
+      counts[pass * kBuckets + ((key >> (pass * 8)) & 0xFF)]++;
+    }
+  }
+  for (int pass = 0; pass < kPasses; pass++) {
+    size_t* count = &counts[pass * kBuckets];
+    if (count[(keys[0] >> (pass * 8)) & 0xFF] == length) continue;
+    size_t offset = 0;
+    for (int bucket = 0; bucket < kBuckets; bucket++) {
+      size_t bucket_count = count[bucket];
+      count[bucket] = offset;
+      offset += bucket_count;
+    }
+    for (size_t i = 0; i < length; i++) {
+      Key key = keys[i];
+      scratch[count[(key >> (pass * 8)) & 0xFF]++] = key;
+    }
+    std::swap(keys, scratch);
+  }
+  return keys;
+}
+
+}  // namespace radix_sort_internal
+
+// Sorts the numbers in data[0, length) in ascending order, with -0 before +0
+// and NaNs last, like %TypedArray%.prototype.sort without a comparator. The
+// elements are accessed with memcpy, so {data} need not be aligned.
+// This runs in linear time and allocates 2 * length keys of scratch space.
+template <typename T>
+void RadixSort(T* data, size_t length) {
+  using Traits = radix_sort_internal::KeyTraits<T>;
+  using Key = typename Traits::Key;
+  if (length < 2) return;
+  std::vector<Key> keys(length);
+  std::vector<T> nans;
+  size_t count = 0;
+  for (size_t i = 0; i < length; i++) {
+    T value;
+    memcpy(&value, &data[i], sizeof(value));
+    if (std::is_floating_point<T>::value && std::isnan(value)) {
+      nans.push_back(value);
+    } else {
+      keys[count++] = Traits::ToKey(value);
+    }
+  }
+  const Key* sorted = keys.data();
+  if (count > 1) {
+    std::vector<Key> scratch(count);
+    sorted = radix_sort_internal::SortKeys(keys.data(), scratch.data(), count);
+    // Copy out before {scratch} goes away.
+    if (sorted == scratch.data()) {
+      memcpy(keys.data(), scratch.data(), count * sizeof(Key));
+      sorted = keys.data();
+    }
+  }
+  for (size_t i = 0; i < count; i++) {
+    T value = Traits::FromKey(sorted[i]);
+    memcpy(&data[i], &value, sizeof(value));
+  }
+  DCHECK_EQ(count + nans.size(), length);
+  if (!nans.empty()) {
+    memcpy(&data[count], nans.data(), nans.size() * sizeof(T));
+  }
+}
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_RADIX_SORT_H_
@@ -18,6 +18,12 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#include <stdio.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -60,6 +66,51 @@ int SysInfo::NumberOfProcessors() {
 #endif
 }
 
+#if V8_OS_LINUX
+namespace {
+
+// Returns the number of CPUs granted by the cgroup CPU bandwidth controller,
+// rounded up, or 0 if there is no limit.
+int CgroupCpuLimit() {
+  long long quota = -1;  // NOLINT(runtime/int)
+  long long period = 0;  // NOLINT(runtime/int)
+  // cgroup v2: "<quota> <period>", or "max <period>" if unlimited.
+  if (FILE* file = fopen("/sys/fs/cgroup/cpu.max", "r")) {
+    if (fscanf(file, "%lld %lld", &quota, &period) != 2) quota = -1;
+    fclose(file);
+  } else {
+    // cgroup v1.
+    if (FILE* file = fopen("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "r")) {
+      if (fscanf(file, "%lld", &quota) != 1) quota = -1;
+      fclose(file);
+    }
+    if (FILE* file = fopen("/sys/fs/cgroup/cpu/cpu.cfs_period_us", "r")) {
+      if (fscanf(file, "%lld", &period) != 1) period = 0;
+      fclose(file);
+    }
+  }
+  if (quota <= 0 || period <= 0) return 0;
+  return static_cast<int>((quota + period - 1) / period);
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+// static
+int SysInfo::NumberOfAvailableProcessors() {
+  int processors = NumberOfProcessors();
+#if V8_OS_LINUX
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    processors = std::min(processors, CPU_COUNT(&cpu_set));
+  }
+  int cgroup_limit = CgroupCpuLimit();
+  if (cgroup_limit > 0) processors = std::min(processors, cgroup_limit);
+#endif  // V8_OS_LINUX
+  return std::max(processors, 1);
+}
+
 
 // static
 int64_t SysInfo::AmountOfPhysicalMemory() {
@@ -18,6 +18,12 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of logical processors/core on the current machine.
   static int NumberOfProcessors();
 
+  // Returns the number of processors the current process can actually use,
+  // which can be lower than NumberOfProcessors() when the process is
+  // restricted by CPU affinity or, on Linux, by a cgroup CPU quota (e.g. in
+  // containers).
+  static int NumberOfAvailableProcessors();
+
   // Returns the number of bytes of physical memory on the current machine.
   static int64_t AmountOfPhysicalMemory();
 
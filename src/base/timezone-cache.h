@@ -23,6 +23,14 @@ class TimezoneCache {
   // https://github.com/tc39/ecma262/pull/778
   virtual double LocalTimeOffset(double time_ms, bool is_utc) = 0;
 
+  // Finds the first time after time_ms at which LocalTimeOffset(_, is_utc)
+  // may change and stores it in transition_ms, or +infinity if it never
+  // changes again. Returns false if the time zone can't tell.
+  virtual bool NextLocalTimeOffsetTransition(double time_ms, bool is_utc,
+                                             double* transition_ms) {
+    return false;
+  }
+
   /**
    * Time zone redetection indicator for Clear function.
    *
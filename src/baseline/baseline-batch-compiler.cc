@@ -11,6 +11,7 @@
 
 #include <algorithm>
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/isolate.h"
@@ -170,14 +171,20 @@ class ConcurrentBaselineCompiler {
       // we only switch back the memory chunks to RX at the end.
       CodePageCollectionMemoryModificationScope batch_alloc(isolate_->heap());
 
+      bool has_compiled_jobs = false;
       while (!incoming_queue_->IsEmpty() && !delegate->ShouldYield()) {
         std::unique_ptr<BaselineBatchCompilerJob> job;
         if (!incoming_queue_->Dequeue(&job)) break;
         DCHECK_NOT_NULL(job);
         job->Compile(&local_isolate);
         outgoing_queue_->Enqueue(std::move(job));
+        has_compiled_jobs = true;
+      }
+      // Install all jobs compiled by this run with a single interrupt; don't
+      // interrupt the main thread if another worker drained the queue first.
+      if (has_compiled_jobs) {
+        isolate_->stack_guard()->RequestInstallBaselineCode();
       }
-      isolate_->stack_guard()->RequestInstallBaselineCode();
     }
 
     size_t GetMaxConcurrency(size_t worker_count) const override {
@@ -242,6 +249,7 @@ BaselineBatchCompiler::BaselineBatchCompiler(Isolate* isolate)
       compilation_queue_(Handle<WeakFixedArray>::null()),
       last_index_(0),
       estimated_instruction_size_(0),
+      compiled_instruction_size_(0),
       enabled_(true) {
   if (v8_flags.concurrent_sparkplug) {
     concurrent_compiler_ =
@@ -313,6 +321,8 @@ void BaselineBatchCompiler::EnsureQueueCapacity() {
 }
 
 void BaselineBatchCompiler::CompileBatch(Handle<JSFunction> function) {
+  base::ElapsedTimer timer;
+  if (v8_flags.baseline_batch_compilation_time_budget_us > 0) timer.Start();
   CodePageCollectionMemoryModificationScope batch_allocation(isolate_->heap());
   {
     IsCompiledScope is_compiled_scope(
@@ -325,6 +335,10 @@ void BaselineBatchCompiler::CompileBatch(Handle<JSFunction> function) {
     MaybeCompileFunction(maybe_sfi);
     compilation_queue_->Set(i, HeapObjectReference::ClearedValue(isolate_));
   }
+  if (timer.IsStarted()) {
+    compiled_instruction_size_ += estimated_instruction_size_;
+    compile_time_ += timer.Elapsed();
+  }
   ClearBatch();
 }
 
@@ -355,11 +369,9 @@ bool BaselineBatchCompiler::ShouldCompileBatch(SharedFunctionInfo shared) {
            shared.DebugNameCStr().get());
     PrintF(trace_scope.file(),
            " with estimated size %d (current budget: %d/%d)\n", estimated_size,
-           estimated_instruction_size_,
-           v8_flags.baseline_batch_compilation_threshold.value());
+           estimated_instruction_size_, BatchSizeThreshold());
   }
-  if (estimated_instruction_size_ >=
-      v8_flags.baseline_batch_compilation_threshold) {
+  if (estimated_instruction_size_ >= BatchSizeThreshold()) {
     if (v8_flags.trace_baseline_batch_compilation) {
       CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
       PrintF(trace_scope.file(),
@@ -372,6 +384,21 @@ bool BaselineBatchCompiler::ShouldCompileBatch(SharedFunctionInfo shared) {
   return false;
 }
 
+int BaselineBatchCompiler::BatchSizeThreshold() const {
+  const int budget_us = v8_flags.baseline_batch_compilation_time_budget_us;
+  // Without a budget, or before the first batch has been measured, fall back
+  // to the fixed threshold. Concurrent batches don't block the main thread.
+  if (budget_us <= 0 || v8_flags.concurrent_sparkplug ||
+      compile_time_.IsZero()) {
+    return v8_flags.baseline_batch_compilation_threshold;
+  }
+  const double size_per_us =
+      static_cast<double>(compiled_instruction_size_) /
+      compile_time_.InMicroseconds();
+  return static_cast<int>(
+      std::clamp(size_per_us * budget_us, 1.0, static_cast<double>(kMaxInt)));
+}
+
 bool BaselineBatchCompiler::MaybeCompileFunction(MaybeObject maybe_sfi) {
   HeapObject heapobj;
   // Skip functions where the weak reference is no longer valid.
@@ -408,6 +435,7 @@ BaselineBatchCompiler::BaselineBatchCompiler(Isolate* isolate)
       compilation_queue_(Handle<WeakFixedArray>::null()),
       last_index_(0),
       estimated_instruction_size_(0),
+      compiled_instruction_size_(0),
       enabled_(false) {}
 
 BaselineBatchCompiler::~BaselineBatchCompiler() {
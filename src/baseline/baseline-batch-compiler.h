@@ -7,6 +7,7 @@
 
 #include <atomic>
 
+#include "src/base/platform/time.h"
 #include "src/handles/global-handles.h"
 #include "src/handles/handles.h"
 
@@ -44,6 +45,10 @@ class BaselineBatchCompiler {
   // compiled.
   bool ShouldCompileBatch(SharedFunctionInfo shared);
 
+  // Returns the estimated instruction size at which the current batch is
+  // compiled.
+  int BatchSizeThreshold() const;
+
   // Compiles the current batch.
   void CompileBatch(Handle<JSFunction> function);
 
@@ -69,6 +74,12 @@ class BaselineBatchCompiler {
   // Estimated insturction size of current batch.
   int estimated_instruction_size_;
 
+  // Estimated instruction size of, and time spent on, all batches compiled on
+  // the main thread so far. Used to derive the batch size threshold from
+  // --baseline-batch-compilation-time-budget-us.
+  int64_t compiled_instruction_size_;
+  base::TimeDelta compile_time_;
+
   // Flag indicating whether batch compilation is enabled.
   // Batch compilation can be dynamically disabled e.g. when creating snapshots.
   bool enabled_;
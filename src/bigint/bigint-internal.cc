@@ -45,6 +45,10 @@ void ProcessorImpl::Multiply(RWDigits Z, Digits X, Digits Y) {
 #else
   if (Y.len() < kToomThreshold) return MultiplyKaratsuba(Z, X, Y);
   if (Y.len() < kFftThreshold) return MultiplyToomCook(Z, X, Y);
+  if (Y.len() >= kParallelMultiplicationThreshold &&
+      !in_parallel_multiplication_ && platform_->CanPostWorkerTasks()) {
+    return MultiplyToomCookParallel(Z, X, Y);
+  }
   return MultiplyFFT(Z, X, Y);
 #endif
 }
@@ -16,6 +16,9 @@ constexpr int kKaratsubaThreshold = 34;
 constexpr int kToomThreshold = 193;
 constexpr int kFftThreshold = 1500;
 constexpr int kFftInnerThreshold = 200;
+// Above this length, and if the Platform supports it, the pointwise products
+// of the top-level Toom-Cook step are computed on worker threads.
+constexpr int kParallelMultiplicationThreshold = 4000;
 
 constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
@@ -51,6 +54,17 @@ class ProcessorImpl : public Processor {
   void MultiplyToomCook(RWDigits Z, Digits X, Digits Y);
   void Toom3Main(RWDigits Z, Digits X, Digits Y);
 
+  struct MultiplicationTask {
+    RWDigits Z;
+    Digits X;
+    Digits Y;
+  };
+  void MultiplyToomCookParallel(RWDigits Z, Digits X, Digits Y);
+  void Toom3Parallel(RWDigits Z, Digits X, Digits Y);
+  // Runs {Multiply} for each of the {count} tasks, spreading them over the
+  // calling thread and the Platform's worker threads.
+  void MultiplyConcurrently(MultiplicationTask* tasks, int count);
+
   void MultiplyFFT(RWDigits Z, Digits X, Digits Y);
 
   void DivideBarrett(RWDigits Q, RWDigits R, Digits A, Digits B);
@@ -95,6 +109,9 @@ class ProcessorImpl : public Processor {
  private:
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
+  // Set while this thread is working on its share of a parallel
+  // multiplication, so that nested products don't fan out again.
+  bool in_parallel_multiplication_{false};
   Platform* platform_;
 };
 
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <iostream>
 #include <vector>
 
@@ -191,6 +192,15 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  // If you want very large multiplications (and divisions, which are built
+  // on top of them) to use more than one thread, implement a Platform
+  // subclass that overrides these methods. {PostWorkerTask} must eventually
+  // run {task} on some thread; tasks only run library-internal code and never
+  // call back into the Platform. The calling thread waits until all work it
+  // has handed out is done, so tasks that start late are harmless no-ops.
+  virtual bool CanPostWorkerTasks() { return false; }
+  virtual void PostWorkerTask(std::function<void()> task) { task(); }
 };
 
 // These are the operations that this library supports.
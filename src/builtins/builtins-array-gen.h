@@ -45,6 +45,34 @@ class ArrayBuiltinsAssembler : public CodeStubAssembler {
                       std::make_pair(MachineType::AnyTagged(), dest)));
   }
 
+  TNode<IntPtrT> CallJSArrayArrayJoinSmisLength(TNode<FixedArray> fixed_array,
+                                                TNode<IntPtrT> length) {
+    TNode<ExternalReference> func = ExternalConstant(
+        ExternalReference::jsarray_array_join_smis_length());
+    return UncheckedCast<IntPtrT>(
+        CallCFunction(func,
+                      MachineType::IntPtr(),  // <return> intptr_t
+                      std::make_pair(MachineType::AnyTagged(), fixed_array),
+                      std::make_pair(MachineType::IntPtr(), length)));
+  }
+
+  TNode<String> CallJSArrayArrayJoinSmisToSequentialString(
+      TNode<FixedArray> fixed_array, TNode<IntPtrT> length, TNode<String> sep,
+      TNode<String> dest) {
+    TNode<ExternalReference> func = ExternalConstant(
+        ExternalReference::jsarray_array_join_smis_to_sequential_string());
+    TNode<ExternalReference> isolate_ptr =
+        ExternalConstant(ExternalReference::isolate_address(isolate()));
+    return UncheckedCast<String>(
+        CallCFunction(func,
+                      MachineType::AnyTagged(),  // <return> String
+                      std::make_pair(MachineType::Pointer(), isolate_ptr),
+                      std::make_pair(MachineType::AnyTagged(), fixed_array),
+                      std::make_pair(MachineType::IntPtr(), length),
+                      std::make_pair(MachineType::AnyTagged(), sep),
+                      std::make_pair(MachineType::AnyTagged(), dest)));
+  }
+
  protected:
   TNode<Context> context() { return context_; }
   TNode<Object> receiver() { return receiver_; }
@@ -110,11 +110,36 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   InitializeNativeClosure(closure_context, native_context, on_resolve,
                           on_resolve_sfi);
 
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
+  // Allocate and initialize reject handler. If {value} is already fulfilled,
+  // PerformPromiseThen directly schedules a PromiseFulfillReactionJobTask that
+  // only references the resolve handler, so the reject handler is only needed
+  // if {value} is still pending (or rejected) or for the instrumentation below.
+  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
+  TVARIABLE(Object, var_on_reject, UndefinedConstant());
+  {
+    Label if_allocate_on_reject(this), if_on_reject_done(this);
+    GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
+               promiseHookFlags),
+           &if_allocate_on_reject);
+    const TNode<Int32T> promise_flags =
+        SmiToInt32(LoadObjectField<Smi>(CAST(value), JSPromise::kFlagsOffset));
+    Branch(Word32Equal(DecodeWord32<JSPromise::StatusBits>(promise_flags),
+                       Int32Constant(Promise::kFulfilled)),
+           &if_on_reject_done, &if_allocate_on_reject);
+
+    BIND(&if_allocate_on_reject);
+    {
+      TNode<HeapObject> on_reject =
+          AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+      InitializeNativeClosure(closure_context, native_context, on_reject,
+                              on_reject_sfi);
+      var_on_reject = on_reject;
+      Goto(&if_on_reject_done);
+    }
+
+    BIND(&if_on_reject_done);
+  }
+  const TNode<Object> on_reject = var_on_reject.value();
 
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
@@ -122,7 +147,6 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   TVARIABLE(Object, var_throwaway, UndefinedConstant());
   Label if_instrumentation(this, Label::kDeferred),
       if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
   GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
              promiseHookFlags),
          &if_instrumentation);
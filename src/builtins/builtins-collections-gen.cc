@@ -1291,10 +1291,31 @@ void CollectionsBuiltinsAssembler::SameValueZeroString(
     Label* if_not_same) {
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
-  GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
-
+  GotoIf(TaggedEqual(key_string, candidate_key), if_same);
+  const TNode<Uint16T> candidate_instance_type =
+      LoadInstanceType(CAST(candidate_key));
+  GotoIfNot(IsStringInstanceType(candidate_instance_type), if_not_same);
+  const TNode<String> candidate_string = CAST(candidate_key);
+
+  // Other candidates in the bucket chain mostly differ from the key, so try
+  // to rule them out without comparing the contents: distinct internalized
+  // strings are never equal, and neither are strings with different hashes.
+  Label check_hashes(this), compare_contents(this);
+  GotoIfNot(IsInternalizedStringInstanceType(candidate_instance_type),
+            &check_hashes);
+  Branch(IsInternalizedStringInstanceType(LoadInstanceType(key_string)),
+         if_not_same, &check_hashes);
+
+  BIND(&check_hashes);
+  const TNode<Uint32T> key_hash = LoadNameHash(key_string, &compare_contents);
+  const TNode<Uint32T> candidate_hash =
+      LoadNameHash(candidate_string, &compare_contents);
+  Branch(Word32Equal(key_hash, candidate_hash), &compare_contents,
+         if_not_same);
+
+  BIND(&compare_contents);
   Branch(TaggedEqual(CallBuiltin(Builtin::kStringEqual, NoContextConstant(),
-                                 key_string, candidate_key),
+                                 key_string, candidate_string),
                      TrueConstant()),
          if_same, if_not_same);
 }
@@ -30,6 +30,7 @@
 #include "src/debug/debug.h"
 #include "src/debug/liveedit.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/diagnostics/compilation-statistics.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/isolate.h"
@@ -255,6 +256,15 @@ class CompilerTracer : public AllStatic {
     PrintTraceSuffix(scope);
   }
 
+  static void TraceSharedRecompilation(Isolate* isolate, JSFunction function) {
+    if (!v8_flags.trace_opt_verbose) return;
+    CodeTracer::Scope scope(isolate->GetCodeTracer());
+    PrintF(scope.file(), "[installing optimized code for ");
+    function.ShortPrint(scope.file());
+    PrintF(scope.file(),
+           " whose function was already optimized for another closure]\n");
+  }
+
   static void TraceOptimizeForAlwaysOpt(Isolate* isolate,
                                         Handle<JSFunction> function,
                                         CodeKind code_kind) {
@@ -318,6 +328,11 @@ void Compiler::LogFunctionCompilation(Isolate* isolate,
   DCHECK_NE(*abstract_code,
             ToAbstractCode(*BUILTIN_CODE(isolate, CompileLazy)));
 
+  if (V8_UNLIKELY(isolate->function_compilation_statistics() != nullptr)) {
+    isolate->function_compilation_statistics()->RecordCompilation(
+        *shared, kind, base::TimeDelta::FromMillisecondsD(time_taken_ms));
+  }
+
   // Log the code generation. If source information is available include
   // script name and line number. Check explicitly whether logging is
   // enabled as finding the line number is not free.
@@ -989,6 +1004,21 @@ class OptimizedCodeCache : public AllStatic {
       return;
     }
 
+    if (kind == CodeKind::TURBOFAN) {
+      SharedFunctionInfo shared = function.shared();
+      if (shared.turbofan_compiled() &&
+          !feedback_vector.was_turbofan_optimized()) {
+        // The optimized code cache lives on the feedback vector, so closures
+        // that don't share one (e.g. closures created in different native
+        // contexts) end up optimizing the same function again. Re-optimizing
+        // after a deopt on the same vector is not counted.
+        isolate->counters()->turbofan_shared_recompilations()->Increment();
+        CompilerTracer::TraceSharedRecompilation(isolate, function);
+      }
+      shared.set_turbofan_compiled(true);
+      feedback_vector.set_was_turbofan_optimized();
+    }
+
     feedback_vector.SetOptimizedCode(code);
   }
 };
@@ -1165,7 +1195,8 @@ MaybeHandle<CodeT> CompileTurbofan(Isolate* isolate,
 #ifdef V8_ENABLE_MAGLEV
 // TODO(v8:7700): Record maglev compilations better.
 void RecordMaglevFunctionCompilation(Isolate* isolate,
-                                     Handle<JSFunction> function) {
+                                     Handle<JSFunction> function,
+                                     double time_taken_ms) {
   PtrComprCageBase cage_base(isolate);
   // TODO(v8:13261): We should be able to pass a CodeT AbstractCode in here, but
   // LinuxPerfJitLogger only supports Code AbstractCode.
@@ -1176,9 +1207,6 @@ void RecordMaglevFunctionCompilation(Isolate* isolate,
   Handle<FeedbackVector> feedback_vector(function->feedback_vector(cage_base),
                                          isolate);
 
-  // Optimistic estimate.
-  double time_taken_ms = 0;
-
   Compiler::LogFunctionCompilation(
       isolate, LogEventListener::CodeTag::kFunction, script, shared,
       feedback_vector, abstract_code, abstract_code->kind(cage_base),
@@ -3275,11 +3303,15 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
     const UnoptimizedCompileFlags flags, Handle<String> source,
     const ScriptDetails& script_details, NativesFlag natives,
     v8::Extension* extension, Isolate* isolate,
-    MaybeHandle<Script> maybe_script, IsCompiledScope* is_compiled_scope) {
+    MaybeHandle<Script> maybe_script, IsCompiledScope* is_compiled_scope,
+    ScriptCompiler::CompileHintCallback compile_hint_callback = nullptr,
+    void* compile_hint_callback_data = nullptr) {
   UnoptimizedCompileState compile_state;
   ReusableUnoptimizedCompileState reusable_state(isolate);
   ParseInfo parse_info(isolate, flags, &compile_state, &reusable_state);
   parse_info.set_extension(extension);
+  parse_info.set_compile_hint_callback_and_data(compile_hint_callback,
+                                                compile_hint_callback_data);
 
   Handle<Script> script;
   if (!maybe_script.ToHandle(&script)) {
@@ -3439,7 +3471,9 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     const ScriptDetails& script_details, v8::Extension* extension,
     AlignedCachedData* cached_data, BackgroundDeserializeTask* deserialize_task,
     ScriptCompiler::CompileOptions compile_options,
-    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives,
+    ScriptCompiler::CompileHintCallback compile_hint_callback = nullptr,
+    void* compile_hint_callback_data = nullptr) {
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason);
 
   if (compile_options == ScriptCompiler::kNoCompileOptions ||
@@ -3557,7 +3591,7 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
 
   if (maybe_result.is_null()) {
     // No cache entry found compile the script.
-    if (v8_flags.stress_background_compile &&
+    if (v8_flags.stress_background_compile && compile_hint_callback == nullptr &&
         CanBackgroundCompile(script_details, extension, compile_options,
                              natives)) {
       // If the --stress-background-compile flag is set, do the actual
@@ -3581,7 +3615,8 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
 
       maybe_result = CompileScriptOnMainThread(
           flags, source, script_details, natives, extension, isolate,
-          maybe_script, &is_compiled_scope);
+          maybe_script, &is_compiled_scope, compile_hint_callback,
+          compile_hint_callback_data);
     }
 
     // Add the result to the isolate cache.
@@ -3609,6 +3644,20 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       compile_options, no_cache_reason, natives);
 }
 
+MaybeHandle<SharedFunctionInfo>
+Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details,
+    ScriptCompiler::CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data,
+    ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, nullptr, nullptr, nullptr,
+      compile_options, no_cache_reason, natives, compile_hint_callback,
+      compile_hint_callback_data);
+}
+
 MaybeHandle<SharedFunctionInfo>
 Compiler::GetSharedFunctionInfoForScriptWithExtension(
     Isolate* isolate, Handle<String> source,
@@ -4022,10 +4071,11 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
     // code.
     ResetProfilerTicks(*function, osr_offset);
 
-    RecordMaglevFunctionCompilation(isolate, function);
     double ms_prepare = job->time_taken_to_prepare().InMillisecondsF();
     double ms_optimize = job->time_taken_to_execute().InMillisecondsF();
     double ms_codegen = job->time_taken_to_finalize().InMillisecondsF();
+    RecordMaglevFunctionCompilation(isolate, function,
+                                    ms_prepare + ms_optimize + ms_codegen);
     CompilerTracer::TraceFinishMaglevCompile(isolate, function, ms_prepare,
                                              ms_optimize, ms_codegen);
   }
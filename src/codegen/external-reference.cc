@@ -932,6 +932,9 @@ ExternalReference ExternalReference::search_string_raw() {
 
 FUNCTION_REFERENCE(jsarray_array_join_concat_to_sequential_string,
                    JSArray::ArrayJoinConcatToSequentialString)
+FUNCTION_REFERENCE(jsarray_array_join_smis_length, JSArray::ArrayJoinSmisLength)
+FUNCTION_REFERENCE(jsarray_array_join_smis_to_sequential_string,
+                   JSArray::ArrayJoinSmisToSequentialString)
 
 FUNCTION_REFERENCE(gsab_byte_length, JSArrayBuffer::GsabByteLength)
 
@@ -166,6 +166,9 @@ class StatsCounter;
   V(invoke_function_callback, "InvokeFunctionCallback")                        \
   V(jsarray_array_join_concat_to_sequential_string,                            \
     "jsarray_array_join_concat_to_sequential_string")                          \
+  V(jsarray_array_join_smis_length, "jsarray_array_join_smis_length")          \
+  V(jsarray_array_join_smis_to_sequential_string,                              \
+    "jsarray_array_join_smis_to_sequential_string")                            \
   V(jsreceiver_create_identity_hash, "jsreceiver_create_identity_hash")        \
   V(libc_memchr_function, "libc_memchr")                                       \
   V(libc_memcpy_function, "libc_memcpy")                                       \
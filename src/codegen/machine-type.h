@@ -315,6 +315,8 @@ class MachineType {
       case CTypeInfo::Type::kFloat64:
         return MachineType::Float64();
       case CTypeInfo::Type::kV8Value:
+      case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kApiObject:
         return MachineType::AnyTagged();
     }
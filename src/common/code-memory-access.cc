@@ -29,6 +29,9 @@ bool RwxMemoryWriteScope::is_key_permissions_initialized_for_current_thread() {
 void RwxMemoryWriteScope::InitializeMemoryProtectionKey() {
   // Flip {pkey_initialized} (in debug mode) and check the new value.
   DCHECK_EQ(true, pkey_initialized = !pkey_initialized);
+  // Leaving the key unallocated makes IsSupported() return false, in which
+  // case the heap falls back to mprotect-based code write protection.
+  if (!v8_flags.memory_protection_keys) return;
   memory_protection_key_ = base::MemoryProtectionKey::AllocateKey();
   DCHECK(memory_protection_key_ > 0 ||
          memory_protection_key_ ==
@@ -70,7 +70,7 @@ class V8_NODISCARD RwxMemoryWriteScope {
 
   static void InitializeMemoryProtectionKey();
 
-  static bool IsPKUWritable();
+  V8_EXPORT_PRIVATE static bool IsPKUWritable();
 
   // Linux resets key's permissions to kDisableAccess before executing signal
   // handlers. If the handler requires access to code page bodies it should take
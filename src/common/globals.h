@@ -275,10 +275,16 @@ using CodeT = Code;
 #define V8_HEAP_USE_PTHREAD_JIT_WRITE_PROTECT false
 #endif
 
-// TODO(v8:13023): enable PKU support when we have a test coverage
-#if V8_HAS_PKU_JIT_WRITE_PROTECT && \
+// Intel PKU lets a thread toggle write access to all code pages tagged with
+// the same key with a single WRPKRU instead of an mprotect per page. The JS
+// code space only uses it in builds with v8_enable_heap_pku_jit_write_protect
+// (see also --memory-protection-keys). The same pointer compression
+// restriction as above applies.
+// TODO(v8:13023): enable PKU support by default when we have a test coverage
+#if V8_HAS_PKU_JIT_WRITE_PROTECT &&                   \
+    defined(V8_ENABLE_HEAP_PKU_JIT_WRITE_PROTECT) &&  \
     !(defined(V8_COMPRESS_POINTERS) && !defined(V8_EXTERNAL_CODE_SPACE))
-#define V8_HEAP_USE_PKU_JIT_WRITE_PROTECT false
+#define V8_HEAP_USE_PKU_JIT_WRITE_PROTECT true
 #else
 #define V8_HEAP_USE_PKU_JIT_WRITE_PROTECT false
 #endif
@@ -1145,6 +1151,7 @@ enum class CodeFlushMode {
   kFlushBytecode,
   kFlushBaselineCode,
   kStressFlushCode,
+  kReduceMemoryFlushCode,
 };
 
 bool inline IsBaselineCodeFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
@@ -1159,6 +1166,10 @@ bool inline IsStressFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.contains(CodeFlushMode::kStressFlushCode);
 }
 
+bool inline IsReduceMemoryFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
+  return mode.contains(CodeFlushMode::kReduceMemoryFlushCode);
+}
+
 bool inline IsFlushingDisabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.empty();
 }
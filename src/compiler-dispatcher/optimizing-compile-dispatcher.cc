@@ -15,7 +15,8 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -45,12 +46,21 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
     LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
     DCHECK(local_isolate.heap()->IsParked());
 
-    {
+    // This task doesn't modify code objects but it needs a read access to the
+    // code space in order to be able to get a bytecode array from a baseline
+    // code. See SharedFunctionInfo::GetActiveBytecodeArray() for details.
+    RwxMemoryWriteScope::SetDefaultPermissionsForNewThread();
+
+    // Compile up to {batch_size_} queued jobs with the same LocalIsolate to
+    // amortize its setup cost. Tasks posted for jobs that were already picked
+    // up by an earlier task simply find the queue empty.
+    for (int i = 0; i < dispatcher_->batch_size_; i++) {
       RCS_SCOPE(&local_isolate,
                 RuntimeCallCounterId::kOptimizeBackgroundDispatcherJob);
 
       TimerEventScope<TimerEventRecompileConcurrent> timer(isolate_);
       TurbofanCompilationJob* job = dispatcher_->NextInput(&local_isolate);
+      if (job == nullptr) break;
       TRACE_EVENT_WITH_FLOW0(
           TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.OptimizeBackground", job,
           TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
@@ -60,10 +70,6 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
             dispatcher_->recompilation_delay_));
       }
 
-      // This task doesn't modify code objects but it needs a read access to the
-      // code space in order to be able to get a bytecode array from a baseline
-      // code. See SharedFunctionInfo::GetActiveBytecodeArray() for details.
-      RwxMemoryWriteScope::SetDefaultPermissionsForNewThread();
       dispatcher_->CompileNext(job, &local_isolate);
     }
     {
@@ -83,14 +89,50 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   DCHECK_EQ(0, ref_count_);
   DCHECK_EQ(0, input_queue_length_);
   DeleteArray(input_queue_);
+  DeleteArray(input_queue_priorities_);
+}
+
+// static
+int OptimizingCompileDispatcher::ComputePriority(TurbofanCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  // OSR requests come from code that is stuck in a hot loop right now.
+  if (info->is_osr()) return kMaxInt;
+  JSFunction function = *info->closure();
+  if (!function.has_feedback_vector()) return 0;
+  return std::max(0, function.feedback_vector().invocation_count(kRelaxedLoad));
+}
+
+int OptimizingCompileDispatcher::NextInputPosition() {
+  DCHECK_LT(0, input_queue_length_);
+  if (!prioritize_ || input_queue_head_bypass_count_ >= max_bypass_) return 0;
+  int best = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    if (input_queue_priorities_[InputQueueIndex(i)] >
+        input_queue_priorities_[InputQueueIndex(best)]) {
+      best = i;
+    }
+  }
+  return best;
 }
 
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  int position = NextInputPosition();
+  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(position)];
   DCHECK_NOT_NULL(job);
+  if (position == 0) {
+    input_queue_head_bypass_count_ = 0;
+  } else {
+    input_queue_head_bypass_count_++;
+    // Close the gap, keeping the remaining jobs in FIFO order.
+    for (int i = position; i > 0; i--) {
+      input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i - 1)];
+      input_queue_priorities_[InputQueueIndex(i)] =
+          input_queue_priorities_[InputQueueIndex(i - 1)];
+    }
+  }
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
   return job;
@@ -140,6 +182,7 @@ void OptimizingCompileDispatcher::FlushInputQueue() {
     input_queue_length_--;
     Compiler::DisposeTurbofanCompilationJob(job.get(), true);
   }
+  input_queue_head_bypass_count_ = 0;
 }
 
 void OptimizingCompileDispatcher::AwaitCompileTasks() {
@@ -224,11 +267,13 @@ bool OptimizingCompileDispatcher::HasJobs() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  int priority = prioritize_ ? ComputePriority(job) : 0;
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
     input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_priorities_[InputQueueIndex(input_queue_length_)] = priority;
     input_queue_length_++;
   }
   V8::GetCurrentPlatform()->CallOnWorkerThread(
@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_DISPATCHER_OPTIMIZING_COMPILE_DISPATCHER_H_
 #define V8_COMPILER_DISPATCHER_OPTIMIZING_COMPILE_DISPATCHER_H_
 
+#include <algorithm>
 #include <atomic>
 #include <queue>
 
@@ -31,8 +32,13 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_length_(0),
         input_queue_shift_(0),
         ref_count_(0),
-        recompilation_delay_(v8_flags.concurrent_recompilation_delay) {
+        recompilation_delay_(v8_flags.concurrent_recompilation_delay),
+        prioritize_(v8_flags.concurrent_recompilation_prioritize),
+        max_bypass_(v8_flags.concurrent_recompilation_max_bypass),
+        batch_size_(
+            std::max(1, v8_flags.concurrent_recompilation_batch_size)) {
     input_queue_ = NewArray<TurbofanCompilationJob*>(input_queue_capacity_);
+    input_queue_priorities_ = NewArray<int>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -74,6 +80,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
+  // Returns the position in the input queue of the job to compile next.
+  int NextInputPosition();
+  static int ComputePriority(TurbofanCompilationJob* job);
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -84,11 +93,16 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
+  // Circular queue of incoming recompilation tasks (including OSR), and the
+  // priority of each of them, computed when it was queued.
   TurbofanCompilationJob** input_queue_;
+  int* input_queue_priorities_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
+  // Number of times the oldest job in the input queue was passed over in favor
+  // of a job with a higher priority.
+  int input_queue_head_bypass_count_ = 0;
   base::Mutex input_queue_mutex_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
@@ -107,6 +121,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // Since flags might get modified while the background thread is running, it
   // is not safe to access them directly.
   int recompilation_delay_;
+  // Copies of v8_flags.concurrent_recompilation_prioritize,
+  // v8_flags.concurrent_recompilation_max_bypass and
+  // v8_flags.concurrent_recompilation_batch_size, for the same reason.
+  const bool prioritize_;
+  const int max_bypass_;
+  const int batch_size_;
 
   bool finalize_ = true;
 };
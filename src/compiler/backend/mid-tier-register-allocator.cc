@@ -2186,14 +2186,17 @@ RegisterIndex SinglePassRegisterAllocator::ChooseRegisterToSpill(
     MachineRepresentation rep, UsePosition pos) {
   RegisterBitVector in_use = InUseBitmap(pos);
 
-  // Choose a register that will need to be spilled. Preferentially choose:
+  // Choose a register that will need to be spilled. In order of priority,
+  // preferentially choose:
   //  - A register with only pending uses, to avoid having to add a gap move for
   //    a non-pending use.
   //  - A register holding a virtual register that has already been spilled, to
   //    avoid adding a new gap move to spill the virtual register when it is
   //    output.
   //  - Prefer the register holding the virtual register with the earliest
-  //    definition point, since it is more likely to be spilled anyway.
+  //    definition point, since it is more likely to be spilled anyway. Values
+  //    defined ahead of a loop thus get spilled before the values computed in
+  //    its body, which keeps the spill stores out of the loop.
   RegisterIndex chosen_reg;
   int earliest_definition = kMaxInt;
   bool pending_only_use = false;
@@ -2211,14 +2214,25 @@ RegisterIndex SinglePassRegisterAllocator::ChooseRegisterToSpill(
 
     VirtualRegisterData& vreg_data =
         VirtualRegisterDataFor(VirtualRegisterForRegister(reg));
-    if ((!pending_only_use && register_state_->HasPendingUsesOnly(reg)) ||
-        (!already_spilled && vreg_data.HasSpillOperand()) ||
-        vreg_data.output_instr_index() < earliest_definition) {
-      chosen_reg = reg;
-      earliest_definition = vreg_data.output_instr_index();
-      pending_only_use = register_state_->HasPendingUsesOnly(reg);
-      already_spilled = vreg_data.HasSpillOperand();
+    bool reg_pending_only_use = register_state_->HasPendingUsesOnly(reg);
+    bool reg_already_spilled = vreg_data.HasSpillOperand();
+    int reg_definition = vreg_data.output_instr_index();
+    // Only fall through to a lower priority criterion if the higher priority
+    // ones are tied, otherwise a register with an earlier definition would
+    // replace one that can be spilled without any additional gap moves.
+    if (chosen_reg.is_valid()) {
+      if (reg_pending_only_use != pending_only_use) {
+        if (!reg_pending_only_use) continue;
+      } else if (reg_already_spilled != already_spilled) {
+        if (!reg_already_spilled) continue;
+      } else if (reg_definition >= earliest_definition) {
+        continue;
+      }
     }
+    chosen_reg = reg;
+    earliest_definition = reg_definition;
+    pending_only_use = reg_pending_only_use;
+    already_spilled = reg_already_spilled;
   }
 
   // There should always be an unblocked register available.
@@ -203,6 +203,9 @@ class EffectControlLinearizer {
   void LowerTransitionElementsKind(Node* node);
   Node* LowerLoadFieldByIndex(Node* node);
   Node* LowerLoadMessage(Node* node);
+  Node* AdaptFastCallStringArgument(Node* node, uint32_t encoding_tag,
+                                    int header_size,
+                                    GraphAssemblerLabel<0>* bailout);
   Node* AdaptFastCallTypedArrayArgument(Node* node,
                                         ElementsKind expected_elements_kind,
                                         GraphAssemblerLabel<0>* bailout);
@@ -5297,6 +5300,44 @@ Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
   return stack_slot;
 }
 
+Node* EffectControlLinearizer::AdaptFastCallStringArgument(
+    Node* node, uint32_t encoding_tag, int header_size,
+    GraphAssemblerLabel<0>* bailout) {
+  // Check that the value is a sequential string with the expected encoding.
+  __ GotoIf(ObjectIsSmi(node), bailout);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  Node* value_is_expected_string = __ Word32Equal(
+      __ Word32And(value_instance_type,
+                   __ Int32Constant(kIsNotStringMask |
+                                    kStringRepresentationMask |
+                                    kStringEncodingMask)),
+      __ Int32Constant(kStringTag | kSeqStringTag | encoding_tag));
+  __ GotoIfNot(value_is_expected_string, bailout);
+
+  // Pass the characters in place, which is fine since the fast callback can't
+  // trigger a GC that could move the string.
+  Node* data_ptr = __ IntPtrAdd(__ BitcastTaggedToWord(node),
+                                __ IntPtrConstant(header_size - kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+
+  constexpr int kAlign = alignof(FastOneByteString);
+  constexpr int kSize = sizeof(FastOneByteString);
+  static_assert(kAlign == alignof(FastTwoByteString));
+  static_assert(kSize == sizeof(FastTwoByteString));
+  static_assert(offsetof(FastOneByteString, length) ==
+                offsetof(FastTwoByteString, length));
+  Node* stack_slot = __ StackSlot(kSize, kAlign);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, 0, data_ptr);
+  __ Store(StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(FastOneByteString, length)),
+           length);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::ClampFastCallArgument(
     Node* input, CTypeInfo::Type scalar_type) {
   Node* min = nullptr;
@@ -5438,6 +5479,14 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
 
             return stack_slot;
           }
+          case CTypeInfo::Type::kSeqOneByteString:
+            return AdaptFastCallStringArgument(node, kOneByteStringTag,
+                                               SeqOneByteString::kHeaderSize,
+                                               if_error);
+          case CTypeInfo::Type::kSeqTwoByteString:
+            return AdaptFastCallStringArgument(node, kTwoByteStringTag,
+                                               SeqTwoByteString::kHeaderSize,
+                                               if_error);
           case CTypeInfo::Type::kFloat32: {
             return __ TruncateFloat64ToFloat32(node);
           }
@@ -5647,6 +5696,8 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
             return ChangeFloat64ToTagged(
                 c_call_result, CheckForMinusZeroMode::kCheckForMinusZero);
           case CTypeInfo::Type::kV8Value:
+          case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kApiObject:
           case CTypeInfo::Type::kUint8:
             UNREACHABLE();
@@ -31,6 +31,8 @@ ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
     case CTypeInfo::Type::kVoid:
     case CTypeInfo::Type::kBool:
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
     case CTypeInfo::Type::kApiObject:
     case CTypeInfo::Type::kAny:
       UNREACHABLE();
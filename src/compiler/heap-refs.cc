@@ -1077,13 +1077,14 @@ bool MapRef::CanInlineElementAccess() const {
   ElementsKind kind = elements_kind();
   if (IsFastElementsKind(kind)) return true;
   if (IsSharedArrayElementsKind(kind)) return true;
-  if (IsTypedArrayElementsKind(kind) && kind != BIGUINT64_ELEMENTS &&
-      kind != BIGINT64_ELEMENTS) {
-    return true;
+  // BigInt64Array elements are accessed as raw 64-bit words, which requires
+  // a 64-bit platform.
+  if (IsBigIntTypedArrayElementsKind(kind) &&
+      kSystemPointerSize != kInt64Size) {
+    return false;
   }
-  if (v8_flags.turbo_rab_gsab && IsRabGsabTypedArrayElementsKind(kind) &&
-      kind != RAB_GSAB_BIGUINT64_ELEMENTS &&
-      kind != RAB_GSAB_BIGINT64_ELEMENTS) {
+  if (IsTypedArrayElementsKind(kind)) return true;
+  if (v8_flags.turbo_rab_gsab && IsRabGsabTypedArrayElementsKind(kind)) {
     return true;
   }
   return false;
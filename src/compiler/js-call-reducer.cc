@@ -6214,9 +6214,11 @@ Reduction JSCallReducer::ReduceArrayIteratorPrototypeNext(Node* node) {
   // Check that various {iterated_object_maps} have compatible elements kinds.
   ElementsKind elements_kind = iterated_object_maps[0].elements_kind();
   if (IsTypedArrayElementsKind(elements_kind)) {
-    // TurboFan doesn't support loading from BigInt typed arrays yet.
-    if (elements_kind == BIGUINT64_ELEMENTS ||
-        elements_kind == BIGINT64_ELEMENTS) {
+    // TurboFan supports loading from BigInt typed arrays only on 64-bit
+    // platforms.
+    if ((elements_kind == BIGUINT64_ELEMENTS ||
+         elements_kind == BIGINT64_ELEMENTS) &&
+        !jsgraph()->machine()->Is64()) {
       return inference.NoChange();
     }
     for (const MapRef& iterated_object_map : iterated_object_maps) {
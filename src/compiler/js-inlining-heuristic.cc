@@ -298,10 +298,22 @@ void JSInliningHeuristic::Finalize() {
     int total_size =
         total_inlined_bytecode_size_ + static_cast<int>(size_of_candidate);
     if (total_size > max_inlined_bytecode_size_cumulative_) {
+      TRACE("Not inlining call site #"
+            << candidate.node->id() << ":" << candidate.node->op()->mnemonic()
+            << " with frequency " << candidate.frequency << " and size "
+            << candidate.total_size << ", because it exceeds the remaining "
+            << "cumulative budget (" << total_inlined_bytecode_size_ << " of "
+            << max_inlined_bytecode_size_cumulative_ << " used)");
       // Try if any smaller functions are available to inline.
       continue;
     }
 
+    TRACE("Inlining call site #"
+          << candidate.node->id() << ":" << candidate.node->op()->mnemonic()
+          << " with frequency " << candidate.frequency << " and size "
+          << candidate.total_size << " (" << total_inlined_bytecode_size_
+          << " of " << max_inlined_bytecode_size_cumulative_
+          << " cumulative budget used)");
     Reduction const reduction = InlineCandidate(candidate, false);
     if (reduction.Changed()) return;
   }
@@ -797,9 +809,19 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
     return true;
   } else if (left.frequency.IsUnknown()) {
     return false;
-  } else if (left.frequency.value() > right.frequency.value()) {
+  }
+  double left_value = left.frequency.value();
+  double right_value = right.frequency.value();
+  if (v8_flags.turbo_inlining_frequency_per_size) {
+    // Rank by frequency per unit of consumed budget, so that a single large
+    // candidate cannot use up the budget needed by several hot, smaller ones.
+    // Cross-multiply to avoid dividing by (and special-casing) zero sizes.
+    left_value *= std::max(right.total_size, 1);
+    right_value *= std::max(left.total_size, 1);
+  }
+  if (left_value > right_value) {
     return true;
-  } else if (left.frequency.value() < right.frequency.value()) {
+  } else if (left_value < right_value) {
     return false;
   } else {
     return left.node->id() > right.node->id();
@@ -1345,6 +1345,58 @@ Reduction JSNativeContextSpecialization::ReduceJSStoreGlobal(Node* node) {
   }
 }
 
+Reduction JSNativeContextSpecialization::ReduceJSProxyNamedLoad(
+    Node* node, Node* receiver, MapRef const& proxy_map, NameRef const& name) {
+  DCHECK_EQ(IrOpcode::kJSLoadNamed, node->opcode());
+  // Private symbols never reach the proxy traps.
+  if (name.object()->IsPrivate()) return NoChange();
+
+  Node* context = NodeProperties::GetContextInput(node);
+  FrameState frame_state{NodeProperties::GetFrameStateInput(node)};
+  Effect effect{NodeProperties::GetEffectInput(node)};
+  Control control{NodeProperties::GetControlInput(node)};
+
+  PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
+  ZoneVector<MapRef> maps(zone());
+  maps.push_back(proxy_map);
+  access_builder.BuildCheckMaps(receiver, &effect, control, maps);
+
+  Callable callable =
+      Builtins::CallableFor(isolate(), Builtin::kProxyGetProperty);
+  CallDescriptor* call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState);
+  Node* inputs[] = {
+      jsgraph()->HeapConstant(callable.code()),
+      receiver,
+      jsgraph()->Constant(name),
+      receiver,
+      jsgraph()->SmiConstant(
+          static_cast<int>(OnNonExistent::kReturnUndefined)),
+      context,
+      frame_state,
+      effect,
+      control};
+  Node* value = graph()->NewNode(common()->Call(call_descriptor),
+                                 arraysize(inputs), inputs);
+  effect = Effect(value);
+  control = Control(value);
+
+  // Rewire the IfException edge if the load is inside a try-block.
+  Node* if_exception = nullptr;
+  if (NodeProperties::IsExceptionalCall(node, &if_exception)) {
+    Node* new_if_exception =
+        graph()->NewNode(common()->IfException(), effect, control);
+    ReplaceWithValue(if_exception, new_if_exception, new_if_exception,
+                     new_if_exception);
+    control = graph()->NewNode(common()->IfSuccess(), control);
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSNativeContextSpecialization::ReduceMegaDOMPropertyAccess(
     Node* node, Node* value, MegaDOMPropertyAccessFeedback const& feedback,
     FeedbackSource const& source) {
@@ -1508,6 +1560,18 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     }
   }
 
+  // Loads from a proxy can't be inlined, since the trap may do anything, but
+  // once the proxy map is known we can call the [[Get]] builtin directly and
+  // skip the IC dispatch.
+  if (inferred_maps.size() == 1 && inferred_maps[0].IsJSProxyMap() &&
+      node->opcode() == IrOpcode::kJSLoadNamed &&
+      v8_flags.optimize_proxy_loads) {
+    DCHECK_EQ(access_mode, AccessMode::kLoad);
+    DCHECK_EQ(receiver, lookup_start_object);
+    return ReduceJSProxyNamedLoad(node, receiver, inferred_maps[0],
+                                  feedback.name());
+  }
+
   ZoneVector<PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<PropertyAccessInfo> access_infos_for_feedback(zone());
@@ -3316,12 +3380,16 @@ JSNativeContextSpecialization::BuildElementAccess(
       case AccessMode::kDefine:
         UNREACHABLE();
       case AccessMode::kStore: {
-        // Ensure that the {value} is actually a Number or an Oddball,
-        // and truncate it to a Number appropriately.
-        value = effect = graph()->NewNode(
-            simplified()->SpeculativeToNumber(
-                NumberOperationHint::kNumberOrOddball, FeedbackSource()),
-            value, effect, control);
+        if (external_array_type != kExternalBigInt64Array &&
+            external_array_type != kExternalBigUint64Array) {
+          // Ensure that the {value} is actually a Number or an Oddball,
+          // and truncate it to a Number appropriately. For BigInt arrays,
+          // the BigInt check and truncation happen in StoreTypedElement.
+          value = effect = graph()->NewNode(
+              simplified()->SpeculativeToNumber(
+                  NumberOperationHint::kNumberOrOddball, FeedbackSource()),
+              value, effect, control);
+        }
 
         // Introduce the appropriate truncation for {value}. Currently we
         // only need to do this for ClamedUint8Array {receiver}s, as the
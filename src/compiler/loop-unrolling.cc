@@ -14,6 +14,29 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+uint32_t EstimateLoopCodeSize(const ZoneUnorderedSet<Node*>& loop) {
+  uint32_t size = 0;
+  for (Node* node : loop) {
+    IrOpcode::Value opcode = node->opcode();
+    if (IrOpcode::IsConstantOpcode(opcode) || IrOpcode::IsPhiOpcode(opcode) ||
+        IrOpcode::IsMergeOpcode(opcode) ||
+        IrOpcode::IsIfProjectionOpcode(opcode)) {
+      continue;
+    }
+    switch (opcode) {
+      case IrOpcode::kLoopExit:
+      case IrOpcode::kLoopExitValue:
+      case IrOpcode::kLoopExitEffect:
+      case IrOpcode::kProjection:
+      case IrOpcode::kTerminate:
+        continue;
+      default:
+        ++size;
+    }
+  }
+  return size;
+}
+
 void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
                 Graph* graph, CommonOperatorBuilder* common, Zone* tmp_zone,
                 SourcePositionTable* source_positions,
@@ -24,7 +47,7 @@ void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
   if (loop_node->InputCount() < 2) return;
 
   uint32_t unrolling_count =
-      unrolling_count_heuristic(static_cast<uint32_t>(loop->size()), depth);
+      unrolling_count_heuristic(EstimateLoopCodeSize(*loop), depth);
   if (unrolling_count == 0) return;
 
   uint32_t iteration_count = unrolling_count + 1;
@@ -12,24 +12,34 @@
 
 #include "src/compiler/common-operator.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/flags/flags.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
-static constexpr uint32_t kMaximumUnnestedSize = 50;
-static constexpr uint32_t kMaximumUnrollingCount = 5;
-
-// A simple heuristic to decide how many times to unroll a loop. Favors small
-// and deeply nested loops.
-// TODO(manoskouk): Investigate how this can be improved.
-V8_INLINE uint32_t unrolling_count_heuristic(uint32_t size, uint32_t depth) {
-  return std::min((depth + 1) * kMaximumUnnestedSize / size,
-                  kMaximumUnrollingCount);
+// Nodes that do not produce machine code (constants, phis, pure control) do
+// not count towards the unrolling budget. Loop discovery thus has to admit
+// loops whose node count exceeds the budget by this factor.
+static constexpr uint32_t kLoopDiscoverySizeFactor = 2;
+
+// Estimates the size of the machine code generated for {loop}, ignoring nodes
+// which are (almost) free after instruction selection.
+uint32_t EstimateLoopCodeSize(const ZoneUnorderedSet<Node*>& loop);
+
+// Decides how many times to unroll a loop of the given estimated code size:
+// as many times as the copies fit in the size budget for its depth, which
+// favors small and deeply nested loops, up to the maximum unrolling count.
+V8_INLINE uint32_t unrolling_count_heuristic(uint32_t code_size,
+                                             uint32_t depth) {
+  uint32_t budget = (depth + 1) * v8_flags.wasm_loop_unrolling_size_budget;
+  return std::min(budget / std::max(code_size, 1u),
+                  v8_flags.wasm_loop_unrolling_max_count);
 }
 
 V8_INLINE uint32_t maximum_unrollable_size(uint32_t depth) {
-  return (depth + 1) * kMaximumUnnestedSize;
+  return kLoopDiscoverySizeFactor * (depth + 1) *
+         v8_flags.wasm_loop_unrolling_size_budget;
 }
 
 void UnrollLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop, uint32_t depth,
@@ -205,6 +205,13 @@ class V8_EXPORT_PRIVATE Node final {
     using InputIndexField = base::BitField<unsigned, 1, 31>;
   };
 
+  // With compressed graph zones, inputs and use links are 32-bit offsets, so
+  // every input of a node ({Use} plus input pointer) costs 16 rather than 32
+  // bytes.
+  static_assert(sizeof(ZoneNodePtr) ==
+                (kCompressGraphZone ? kInt32Size : kSystemPointerSize));
+  static_assert(!kCompressGraphZone || sizeof(Use) == 3 * kInt32Size);
+
   //============================================================================
   //== Memory layout ===========================================================
   //============================================================================
@@ -80,6 +80,7 @@
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/store-store-elimination.h"
 #include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/branch-elimination-reducer.h"
 #include "src/compiler/turboshaft/decompression-optimization.h"
 #include "src/compiler/turboshaft/graph-builder.h"
 #include "src/compiler/turboshaft/graph-visualizer.h"
@@ -1964,9 +1965,10 @@ struct LateOptimizationPhase {
   void Run(PipelineData* data, Zone* temp_zone) {
     if (data->HasTurboshaftGraph()) {
       // TODO(dmercadier,tebbi): add missing reducers (LateEscapeAnalysis,
-      // BranchElimination, MachineOperatorReducer and CommonOperatorReducer).
+      // MachineOperatorReducer and CommonOperatorReducer).
       turboshaft::OptimizationPhase<
           turboshaft::SelectLoweringReducer,
+          turboshaft::BranchEliminationReducer,
           turboshaft::ValueNumberingReducer>::Run(&data->turboshaft_graph(),
                                                   temp_zone,
                                                   data->node_origins());
@@ -96,7 +96,7 @@ MachineRepresentation MachineRepresentationFromArrayType(
       return MachineRepresentation::kFloat64;
     case kExternalBigInt64Array:
     case kExternalBigUint64Array:
-      UNIMPLEMENTED();
+      return MachineRepresentation::kWord64;
   }
   UNREACHABLE();
 }
@@ -1961,6 +1961,8 @@ class RepresentationSelector {
           case CTypeInfo::Type::kFloat64:
             return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
           case CTypeInfo::Type::kV8Value:
+          case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kApiObject:
             return UseInfo::AnyTagged();
         }
@@ -3677,14 +3679,24 @@ class RepresentationSelector {
         return;
       }
       case IrOpcode::kStoreTypedElement: {
+        ExternalArrayType const array_type = ExternalArrayTypeOf(node->op());
         MachineRepresentation const rep =
-            MachineRepresentationFromArrayType(ExternalArrayTypeOf(node->op()));
+            MachineRepresentationFromArrayType(array_type);
         ProcessInput<T>(node, 0, UseInfo::AnyTagged());  // buffer
         ProcessInput<T>(node, 1, UseInfo::AnyTagged());  // base pointer
         ProcessInput<T>(node, 2, UseInfo::Word());       // external pointer
         ProcessInput<T>(node, 3, UseInfo::Word());       // index
-        ProcessInput<T>(node, 4,
-                        TruncatingUseInfoFromRepresentation(rep));  // value
+        if (array_type == kExternalBigInt64Array ||
+            array_type == kExternalBigUint64Array) {
+          // Both element types store the value modulo 2^64, so truncating
+          // to a word is exact; deopt for anything that isn't a BigInt.
+          ProcessInput<T>(
+              node, 4,
+              UseInfo::CheckedBigIntTruncatingWord64(FeedbackSource{}));
+        } else {
+          ProcessInput<T>(node, 4,
+                          TruncatingUseInfoFromRepresentation(rep));  // value
+        }
         ProcessRemainingInputs<T>(node, 5);
         SetOutput<T>(node, MachineRepresentation::kNone);
         return;
@@ -0,0 +1,152 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_BRANCH_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_BRANCH_ELIMINATION_REDUCER_H_
+
+#include "src/base/optional.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/snapshot-table.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+// Removes branches and deoptimization checks whose condition is already known
+// from a dominating branch or deoptimization check. For instance:
+//
+//     if (x) {
+//       ...
+//       if (x) {   // Always true: replaced by a Goto to the true block.
+//         ...
+//       }
+//     }
+//
+// Similarly, after `DeoptimizeIf(x)`, `x` is known to be false.
+//
+// The known conditions are kept in a SnapshotTable. Since the OptimizationPhase
+// visits the graph in dominator order, entering a block restores the snapshot
+// of its immediate dominator (conditions are SSA values, so whatever was known
+// at the end of a dominator holds in all the blocks it dominates). If the block
+// is the only successor of a Branch on one of its sides, the condition of the
+// Branch is additionally recorded.
+template <class Next>
+class BranchEliminationReducer : public Next {
+ public:
+  using Next::Asm;
+
+  BranchEliminationReducer()
+      : known_conditions_(Asm().phase_zone()),
+        condition_keys_(Asm().phase_zone()),
+        block_snapshots_(Asm().phase_zone()) {}
+
+  ~BranchEliminationReducer() {
+    if (scope_.has_value()) scope_->Seal();
+  }
+
+  void Bind(Block* block, const Block* origin = nullptr) {
+    Next::Bind(block, origin);
+    SealCurrentBlock();
+    current_block_ = block;
+
+    Block* dominator = block->GetDominator();
+    if (dominator == nullptr) {
+      scope_.emplace(known_conditions_);
+    } else {
+      DCHECK_LT(dominator->index().id(), block_snapshots_.size());
+      scope_.emplace(known_conditions_,
+                     *block_snapshots_[dominator->index().id()]);
+    }
+
+    // If {block} is reached through a single side of a Branch, the condition
+    // of the Branch is known in {block}.
+    if (block->IsLoop() || block->PredecessorCount() != 1) return;
+    Block* predecessor = block->LastPredecessor();
+    const Operation& last_op =
+        *base::Reversed(Asm().output_graph().operations(*predecessor)).begin();
+    if (const BranchOp* branch = last_op.TryCast<BranchOp>()) {
+      if (branch->if_true == branch->if_false) return;
+      DCHECK(branch->if_true == block || branch->if_false == block);
+      SetKnownCondition(branch->condition(), branch->if_true == block);
+    }
+  }
+
+  OpIndex ReduceBranch(OpIndex condition, Block* if_true, Block* if_false) {
+    if (base::Optional<bool> decision = GetKnownCondition(condition)) {
+      Asm().Goto(*decision ? if_true : if_false);
+      return OpIndex::Invalid();
+    }
+    return Next::ReduceBranch(condition, if_true, if_false);
+  }
+
+  OpIndex ReduceDeoptimizeIf(OpIndex condition, OpIndex frame_state,
+                             bool negated,
+                             const DeoptimizeParameters* parameters) {
+    if (base::Optional<bool> decision = GetKnownCondition(condition)) {
+      if (*decision != negated) {
+        Asm().Deoptimize(frame_state, parameters);
+      }
+      // `DeoptimizeIf` doesn't produce a value.
+      return OpIndex::Invalid();
+    }
+    OpIndex result =
+        Next::ReduceDeoptimizeIf(condition, frame_state, negated, parameters);
+    // Execution only continues if the deoptimization was not triggered.
+    if (Asm().current_block() != nullptr) {
+      SetKnownCondition(condition, negated);
+    }
+    return result;
+  }
+
+ private:
+  using Table = SnapshotTable<base::Optional<bool>>;
+
+  void SealCurrentBlock() {
+    if (!scope_.has_value()) return;
+    DCHECK_NOT_NULL(current_block_);
+    size_t index = current_block_->index().id();
+    if (index >= block_snapshots_.size()) {
+      block_snapshots_.resize(index + 1);
+    }
+    block_snapshots_[index] = scope_->Seal();
+    scope_.reset();
+  }
+
+  base::Optional<bool> GetKnownCondition(OpIndex condition) {
+    DCHECK(scope_.has_value());
+    size_t index = condition.id();
+    if (index >= condition_keys_.size() ||
+        !condition_keys_[index].has_value()) {
+      return base::nullopt;
+    }
+    return scope_->Get(*condition_keys_[index]);
+  }
+
+  void SetKnownCondition(OpIndex condition, bool value) {
+    DCHECK(scope_.has_value());
+    size_t index = condition.id();
+    if (index >= condition_keys_.size()) {
+      condition_keys_.resize(index + 1);
+    }
+    if (!condition_keys_[index].has_value()) {
+      condition_keys_[index] = known_conditions_.NewKey();
+    }
+    scope_->Set(*condition_keys_[index], value);
+  }
+
+  Table known_conditions_;
+  base::Optional<Table::Scope> scope_;
+  Block* current_block_ = nullptr;
+  // Keys of the conditions seen so far, indexed by OpIndex id in the output
+  // graph.
+  ZoneVector<base::Optional<Table::Key>> condition_keys_;
+  // Snapshots at the end of each bound block, indexed by BlockIndex id in the
+  // output graph.
+  ZoneVector<base::Optional<Table::Snapshot>> block_snapshots_;
+};
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_BRANCH_ELIMINATION_REDUCER_H_
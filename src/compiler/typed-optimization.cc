@@ -188,6 +188,46 @@ Reduction TypedOptimization::ReduceMaybeGrowFastElements(Node* node) {
   return NoChange();
 }
 
+namespace {
+
+// Returns true if {node} is only reachable through the true projection of a
+// {index} < {length} comparison, i.e. if the comparison is known to hold at
+// {node}. This covers the canonical
+//
+//   for (let i = 0; i < a.length; ++i) a[i]
+//
+// pattern once load elimination has unified the loads of {a.length}.
+bool IsDominatedByLessThan(Node* node, Node* index, Node* length) {
+  // The walk is linear in the length of the control chain; bound it since the
+  // reducer may revisit {node} several times.
+  static constexpr int kMaxControlChainWalk = 32;
+  Node* control = NodeProperties::GetControlInput(node);
+  for (int i = 0; i < kMaxControlChainWalk; ++i) {
+    // Each node with a single control input is dominated by that input; stop
+    // at merges and loops.
+    if (control->op()->ControlInputCount() != 1) return false;
+    if (control->opcode() == IrOpcode::kIfTrue) {
+      Node* condition = NodeProperties::GetValueInput(
+          NodeProperties::GetControlInput(control), 0);
+      switch (condition->opcode()) {
+        case IrOpcode::kNumberLessThan:
+        case IrOpcode::kSpeculativeNumberLessThan:
+          if (condition->InputAt(0) == index &&
+              condition->InputAt(1) == length) {
+            return true;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+    control = NodeProperties::GetControlInput(control);
+  }
+  return false;
+}
+
+}  // namespace
+
 Reduction TypedOptimization::ReduceCheckBounds(Node* node) {
   CheckBoundsParameters const& p = CheckBoundsParametersOf(node->op());
   Node* const input = NodeProperties::GetValueInput(node, 0);
@@ -202,6 +242,18 @@ Reduction TypedOptimization::ReduceCheckBounds(Node* node) {
             p.flags().without(CheckBoundsFlag::kConvertStringAndMinusZero)));
     return Changed(node);
   }
+  // A non-negative integral index that is known to be below the length from a
+  // dominating comparison is always in bounds, so the check can't deopt.
+  Node* const length = NodeProperties::GetValueInput(node, 1);
+  if (!(p.flags() & CheckBoundsFlag::kAbortOnOutOfBounds) &&
+      input_type.Is(Type::Integral32()) && !input_type.IsNone() &&
+      input_type.Min() >= 0.0 && IsDominatedByLessThan(node, input, length)) {
+    NodeProperties::ChangeOp(
+        node, simplified()->CheckBounds(
+                  p.check_parameters().feedback(),
+                  p.flags() | CheckBoundsFlag::kAbortOnOutOfBounds));
+    return Changed(node);
+  }
   return NoChange();
 }
 
@@ -7851,6 +7851,11 @@ static bool IsSupportedWasmFastApiFunction(
     // Arg 0 is the receiver, skip over it since wasm doesn't
     // have a concept of receivers.
     CTypeInfo arg = info->ArgumentInfo(i + 1);
+    if (arg.GetType() == CTypeInfo::Type::kSeqOneByteString ||
+        arg.GetType() == CTypeInfo::Type::kSeqTwoByteString) {
+      log_imported_function_mismatch("string parameters are not supported");
+      return false;
+    }
     if (NormalizeFastApiRepresentation(arg) !=
         expected_sig->GetParam(i).machine_type().representation()) {
       log_imported_function_mismatch("parameter type mismatch");
@@ -964,6 +964,44 @@ class FastCApiObject {
     args.GetReturnValue().Set(Boolean::New(isolate, result));
   }
 
+  template <typename Char>
+  static uint32_t SumCharCodes(const Char* chars, uint32_t length) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < length; i++) {
+      sum += static_cast<std::make_unsigned_t<Char>>(chars[i]);
+    }
+    return sum;
+  }
+
+  template <typename FastString>
+  static uint32_t SumCharCodesFastCallback(Local<Object> receiver,
+                                           const FastString& string,
+                                           FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    return SumCharCodes(string.data, string.length);
+  }
+
+  static void SumCharCodesSlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    if (args.Length() < 1 || !args[0]->IsString()) {
+      isolate->ThrowError("sum_char_codes should be called with a string");
+      return;
+    }
+    String::Value value(isolate, args[0]);
+    args.GetReturnValue().Set(SumCharCodes(*value, value.length()));
+  }
+
   static bool TestWasmMemoryFastCallback(Local<Object> receiver,
                                          uint32_t address,
                                          FastApiCallbackOptions& options) {
@@ -1408,6 +1446,24 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, &is_valid_api_object_c_func));
 
+    CFunction sum_one_byte_char_codes_c_func = CFunction::Make(
+        FastCApiObject::SumCharCodesFastCallback<FastOneByteString>);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_one_byte_char_codes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumCharCodesSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &sum_one_byte_char_codes_c_func));
+
+    CFunction sum_two_byte_char_codes_c_func = CFunction::Make(
+        FastCApiObject::SumCharCodesFastCallback<FastTwoByteString>);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_two_byte_char_codes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumCharCodesSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &sum_two_byte_char_codes_c_func));
+
     CFunction test_wasm_memory_c_func =
         CFunction::Make(FastCApiObject::TestWasmMemoryFastCallback);
     api_obj_ctor->PrototypeTemplate()->Set(
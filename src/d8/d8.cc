@@ -34,6 +34,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/cpu.h"
 #include "src/base/logging.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
@@ -1566,7 +1567,11 @@ bool Shell::LoadJSON(Isolate* isolate, const char* file_name) {
 }
 
 PerIsolateData::PerIsolateData(Isolate* isolate)
-    : isolate_(isolate), realms_(nullptr) {
+    : isolate_(isolate),
+      realm_count_(0),
+      realm_current_(0),
+      realm_switch_(0),
+      realms_(nullptr) {
   isolate->SetData(0, this);
   if (i::v8_flags.expose_async_hooks) {
     async_hooks_wrapper_ = new AsyncHooks(isolate);
@@ -1687,7 +1692,12 @@ void PerIsolateData::SetDomNodeCtor(Local<FunctionTemplate> ctor) {
   dom_node_ctor_.Reset(isolate_, ctor);
 }
 
-PerIsolateData::RealmScope::RealmScope(PerIsolateData* data) : data_(data) {
+PerIsolateData::RealmScope::RealmScope(PerIsolateData* data)
+    : data_(data),
+      previous_count_(data->realm_count_),
+      previous_current_(data->realm_current_),
+      previous_switch_(data->realm_switch_),
+      previous_realms_(data->realms_) {
   data_->realm_count_ = 1;
   data_->realm_current_ = 0;
   data_->realm_switch_ = 0;
@@ -1698,8 +1708,11 @@ PerIsolateData::RealmScope::RealmScope(PerIsolateData* data) : data_(data) {
 
 PerIsolateData::RealmScope::~RealmScope() {
   // Drop realms to avoid keeping them alive.
-  data_->realm_count_ = 0;
   delete[] data_->realms_;
+  data_->realm_count_ = previous_count_;
+  data_->realm_current_ = previous_current_;
+  data_->realm_switch_ = previous_switch_;
+  data_->realms_ = previous_realms_;
 }
 
 PerIsolateData::ExplicitRealmScope::ExplicitRealmScope(PerIsolateData* data,
@@ -4391,6 +4404,78 @@ bool SourceGroup::Execute(Isolate* isolate) {
   return success;
 }
 
+namespace {
+
+struct ThroughputGCStats {
+  base::TimeTicks start;
+  int count = 0;
+  double ms = 0;
+};
+
+void ThroughputGCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                          void* data) {
+  static_cast<ThroughputGCStats*>(data)->start = base::TimeTicks::Now();
+}
+
+void ThroughputGCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                          void* data) {
+  ThroughputGCStats* stats = static_cast<ThroughputGCStats*>(data);
+  stats->count++;
+  stats->ms += (base::TimeTicks::Now() - stats->start).InMillisecondsF();
+}
+
+}  // namespace
+
+bool SourceGroup::ExecuteForThroughput(Isolate* isolate) {
+  ThroughputGCStats gc_stats;
+  isolate->AddGCPrologueCallback(ThroughputGCPrologue, &gc_stats);
+  isolate->AddGCEpilogueCallback(ThroughputGCEpilogue, &gc_stats);
+  iteration_ms_.clear();
+  bool success = true;
+  base::ElapsedTimer timer;
+  timer.Start();
+  for (int i = 0; i < Shell::options.throughput_iterations; ++i) {
+    // Run each iteration in a fresh context, so that top-level lexical
+    // declarations of the sources don't clash with the previous iteration.
+    HandleScope handle_scope(isolate);
+    Local<Context> context = Shell::CreateEvaluationContext(isolate);
+    if (context.IsEmpty()) {
+      success = false;
+      break;
+    }
+    Context::Scope context_scope(context);
+    PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+    base::ElapsedTimer iteration_timer;
+    iteration_timer.Start();
+    if (!Execute(isolate)) {
+      success = false;
+      break;
+    }
+    iteration_ms_.push_back(iteration_timer.Elapsed().InMillisecondsF());
+  }
+  elapsed_ms_ = timer.Elapsed().InMillisecondsF();
+  isolate->RemoveGCPrologueCallback(ThroughputGCPrologue, &gc_stats);
+  isolate->RemoveGCEpilogueCallback(ThroughputGCEpilogue, &gc_stats);
+  gc_count_ = gc_stats.count;
+  gc_ms_ = gc_stats.ms;
+  return success;
+}
+
+void SourceGroup::PrintThroughput(int index) const {
+  std::vector<double> sorted = iteration_ms_;
+  std::sort(sorted.begin(), sorted.end());
+  auto percentile = [&sorted](size_t p) {
+    if (sorted.empty()) return 0.0;
+    return sorted[std::min(sorted.size() - 1, sorted.size() * p / 100)];
+  };
+  printf(
+      "isolate %d: %d iterations in %.3f ms, %.2f ops/s, p50 %.3f ms, "
+      "p99 %.3f ms, %d GCs in %.3f ms\n",
+      index, completed_iterations(), elapsed_ms_,
+      elapsed_ms_ > 0 ? completed_iterations() * 1000 / elapsed_ms_ : 0,
+      percentile(50), percentile(99), gc_count_, gc_ms_);
+}
+
 SourceGroup::IsolateThread::IsolateThread(SourceGroup* group)
     : base::Thread(GetThreadOptions("IsolateThread")), group_(group) {}
 
@@ -4418,7 +4503,11 @@ void SourceGroup::ExecuteInThread() {
           InspectorClient inspector_client(context,
                                            Shell::options.enable_inspector);
           PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
-          Execute(isolate);
+          if (Shell::options.throughput_isolates > 0) {
+            ExecuteForThroughput(isolate);
+          } else {
+            Execute(isolate);
+          }
           Shell::CompleteMessageLoop(isolate);
         }
       }
@@ -4956,6 +5045,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--repeat-compile=", 17) == 0) {
       options.repeat_compile = atoi(argv[i] + 17);
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-isolates=", 22) == 0) {
+      options.throughput_isolates = atoi(argv[i] + 22);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-iterations=", 24) == 0) {
+      options.throughput_iterations = atoi(argv[i] + 24);
+      argv[i] = nullptr;
     } else if (strncmp(argv[i], "--max-serializer-memory=", 24) == 0) {
       // Value is expressed in MB.
       options.max_serializer_memory = atoi(argv[i] + 24) * i::MB;
@@ -5050,6 +5145,14 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     FATAL("Flag --expose-fast-api is incompatible with --stress-snapshot.");
   }
 
+  // In throughput mode the same sources run in every isolate.
+  if (options.throughput_isolates > 0) {
+    if (options.num_isolates > 1) {
+      FATAL("Flag --throughput-isolates is incompatible with --isolate.");
+    }
+    options.num_isolates = options.throughput_isolates;
+  }
+
   // Set up isolated source groups.
   options.isolate_sources = new SourceGroup[options.num_isolates];
   SourceGroup* current = options.isolate_sources;
@@ -5076,6 +5179,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     }
   }
   current->End(argc);
+  if (options.throughput_isolates > 0) {
+    for (int i = 1; i < options.num_isolates; i++) {
+      options.isolate_sources[i].Begin(argv, 1);
+      options.isolate_sources[i].End(argc);
+    }
+  }
 
   if (!logfile_per_isolate && options.num_isolates) {
     V8::SetFlagsFromString("--no-logfile-per-isolate");
@@ -5106,7 +5215,12 @@ int Shell::RunMain(Isolate* isolate, bool last_run) {
       Context::Scope cscope(context);
       InspectorClient inspector_client(context, options.enable_inspector);
       PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
-      if (!options.isolate_sources[0].Execute(isolate)) success = false;
+      SourceGroup& group = options.isolate_sources[0];
+      if (options.throughput_isolates > 0) {
+        if (!group.ExecuteForThroughput(isolate)) success = false;
+      } else {
+        if (!group.Execute(isolate)) success = false;
+      }
       if (!CompleteMessageLoop(isolate)) success = false;
     }
     WriteLcovData(isolate, options.lcov_file);
@@ -5138,6 +5252,19 @@ int Shell::RunMain(Isolate* isolate, bool last_run) {
     }
   }
   WaitForRunningWorkers(parked);
+  if (options.throughput_isolates > 0) {
+    int total_iterations = 0;
+    double max_elapsed_ms = 0;
+    for (int i = 0; i < options.num_isolates; ++i) {
+      const SourceGroup& group = options.isolate_sources[i];
+      group.PrintThroughput(i);
+      total_iterations += group.completed_iterations();
+      max_elapsed_ms = std::max(max_elapsed_ms, group.throughput_elapsed_ms());
+    }
+    printf("throughput: %d isolates, %d iterations in %.3f ms, %.2f ops/s\n",
+           options.num_isolates, total_iterations, max_elapsed_ms,
+           max_elapsed_ms > 0 ? total_iterations * 1000 / max_elapsed_ms : 0);
+  }
   if (Shell::unhandled_promise_rejections_.load() > 0) {
     printf("%i pending unhandled Promise rejection(s) detected.\n",
            Shell::unhandled_promise_rejections_.load());
@@ -5652,10 +5779,29 @@ int Shell::Main(int argc, char* argv[]) {
   if (options.trace_enabled && !i::v8_flags.verify_predictable) {
     tracing = std::make_unique<platform::tracing::TracingController>();
 
+#ifdef V8_USE_PERFETTO
+    // Trace files with a Perfetto extension receive the raw protobuf trace
+    // rather than the converted JSON.
+    auto trace_format =
+        platform::tracing::TracingController::OutputFormat::kJSON;
+    if (options.trace_path &&
+        (ends_with(options.trace_path, ".pftrace") ||
+         ends_with(options.trace_path, ".perfetto-trace"))) {
+      trace_format = platform::tracing::TracingController::OutputFormat::kProto;
+    }
+#endif  // V8_USE_PERFETTO
+
     if (!options.enable_etw_stack_walking) {
       const char* trace_path =
           options.trace_path ? options.trace_path : "v8_trace.json";
-      trace_file.open(trace_path);
+      std::ios_base::openmode mode = std::ios_base::out;
+#ifdef V8_USE_PERFETTO
+      if (trace_format ==
+          platform::tracing::TracingController::OutputFormat::kProto) {
+        mode |= std::ios_base::binary;
+      }
+#endif  // V8_USE_PERFETTO
+      trace_file.open(trace_path, mode);
       if (!trace_file.good()) {
         printf("Cannot open trace file '%s' for writing: %s.\n", trace_path,
                strerror(errno));
@@ -5670,7 +5816,7 @@ int Shell::Main(int argc, char* argv[]) {
     init_args.backends = perfetto::BackendType::kInProcessBackend;
     perfetto::Tracing::Initialize(init_args);
 
-    tracing->InitializeForPerfetto(&trace_file);
+    tracing->InitializeForPerfetto(&trace_file, trace_format);
 #else
     platform::tracing::TraceBuffer* trace_buffer = nullptr;
 #if defined(V8_ENABLE_SYSTEM_INSTRUMENTATION)
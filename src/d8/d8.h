@@ -105,6 +105,16 @@ class SourceGroup {
   // Returns true on success, false if an uncaught exception was thrown.
   bool Execute(Isolate* isolate);
 
+  // Like Execute, but runs the sources --throughput-iterations times, each
+  // time in a fresh context, and records how long each iteration took and how
+  // much time went to GC. Stops at the first iteration that throws.
+  bool ExecuteForThroughput(Isolate* isolate);
+  void PrintThroughput(int index) const;
+  int completed_iterations() const {
+    return static_cast<int>(iteration_ms_.size());
+  }
+  double throughput_elapsed_ms() const { return elapsed_ms_; }
+
   void StartExecuteInThread();
   void WaitForThread(const i::ParkedScope& parked);
   void JoinThread(const i::ParkedScope& parked);
@@ -131,6 +141,12 @@ class SourceGroup {
   const char** argv_;
   int begin_offset_;
   int end_offset_;
+
+  // Results of ExecuteForThroughput.
+  std::vector<double> iteration_ms_;
+  double elapsed_ms_ = 0;
+  int gc_count_ = 0;
+  double gc_ms_ = 0;
 };
 
 class SerializationData {
@@ -275,6 +291,8 @@ class PerIsolateData {
     return reinterpret_cast<PerIsolateData*>(isolate->GetData(0));
   }
 
+  // Makes the entered context the only Realm. Nested scopes restore the
+  // outer Realms when they are left.
   class V8_NODISCARD RealmScope {
    public:
     explicit RealmScope(PerIsolateData* data);
@@ -282,6 +300,10 @@ class PerIsolateData {
 
    private:
     PerIsolateData* data_;
+    int previous_count_;
+    int previous_current_;
+    int previous_switch_;
+    Global<Context>* previous_realms_;
   };
 
   // Contrary to RealmScope (which creates a new Realm), ExplicitRealmScope
@@ -474,6 +496,9 @@ class ShellOptions {
   DisallowReassignment<bool> stress_deserialize = {"stress-deserialize", false};
   DisallowReassignment<bool> compile_only = {"compile-only", false};
   DisallowReassignment<int> repeat_compile = {"repeat-compile", 1};
+  DisallowReassignment<int> throughput_isolates = {"throughput-isolates", 0};
+  DisallowReassignment<int> throughput_iterations = {"throughput-iterations",
+                                                     1};
 #if V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> wasm_trap_handler = {"wasm-trap-handler", true};
 #endif  // V8_ENABLE_WEBASSEMBLY
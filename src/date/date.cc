@@ -4,6 +4,8 @@
 
 #include "src/date/date.h"
 
+#include <limits>
+
 #include "src/base/overflowing-math.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
@@ -51,6 +53,7 @@ void DateCache::ResetDateCache(
   dst_usage_counter_ = 0;
   before_ = &dst_[0];
   after_ = &dst_[1];
+  ClearOffsetCache();
   ymd_valid_ = false;
 #ifdef V8_INTL_SUPPORT
   if (!v8_flags.icu_timezone_data) {
@@ -79,6 +82,71 @@ void DateCache::ClearSegment(DST* segment) {
   segment->last_used = 0;
 }
 
+void DateCache::ClearOffsetCache() {
+  for (auto& cache : offset_cache_) {
+    for (OffsetBucket& bucket : cache) {
+      bucket.key = kInvalidOffsetBucketKey;
+      bucket.candidate_key = kInvalidOffsetBucketKey;
+    }
+  }
+}
+
+int DateCache::LocalOffsetInMs(int64_t time_ms, bool is_utc) {
+  int64_t key = OffsetBucketKey(time_ms);
+  OffsetBucket* bucket =
+      &offset_cache_[is_utc][static_cast<uint64_t>(key) % kOffsetCacheSize];
+  if (bucket->key != key) {
+    if (bucket->candidate_key != key) {
+      bucket->candidate_key = key;
+      return GetLocalOffsetFromOS(time_ms, is_utc);
+    }
+    ComputeOffsetBucket(bucket, key, is_utc);
+  }
+  if (bucket->transition_count == kOffsetBucketUncacheable) {
+    return GetLocalOffsetFromOS(time_ms, is_utc);
+  }
+  int i = 0;
+  while (i < bucket->transition_count && time_ms >= bucket->transition_ms[i]) {
+    i++;
+  }
+  return bucket->offset_ms[i];
+}
+
+void DateCache::ComputeOffsetBucket(OffsetBucket* bucket, int64_t key,
+                                    bool is_utc) {
+  int64_t start = key * (int64_t{1} << kOffsetBucketBits);
+  int64_t last = start + (int64_t{1} << kOffsetBucketBits) - 1;
+  bucket->key = key;
+  bucket->transition_count = 0;
+  int64_t time = start;
+  int offset = GetLocalOffsetFromOS(start, is_utc);
+  bucket->offset_ms[0] = offset;
+  while (true) {
+    int64_t transition;
+    if (!GetNextOffsetTransitionFromOS(time, is_utc, &transition) ||
+        transition <= time) {
+      bucket->transition_count = kOffsetBucketUncacheable;
+      return;
+    }
+    if (transition > last) return;
+    // Confirm the transition against the offsets themselves: the offset has to
+    // change exactly there. A reported transition that leaves the offset
+    // unchanged may be a misplaced real one, so it can't be confirmed either.
+    int next_offset = GetLocalOffsetFromOS(transition, is_utc);
+    if (next_offset == offset ||
+        GetLocalOffsetFromOS(transition - 1, is_utc) != offset ||
+        bucket->transition_count == kMaxOffsetTransitionsPerBucket) {
+      bucket->transition_count = kOffsetBucketUncacheable;
+      return;
+    }
+    int index = bucket->transition_count++;
+    bucket->transition_ms[index] = transition;
+    bucket->offset_ms[index + 1] = next_offset;
+    offset = next_offset;
+    time = transition;
+  }
+}
+
 void DateCache::YearMonthDayFromDays(int days, int* year, int* month,
                                      int* day) {
   if (ymd_valid_) {
@@ -275,6 +343,27 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   return static_cast<int>(offset);
 }
 
+bool DateCache::GetNextOffsetTransitionFromOS(int64_t time_ms, bool is_utc,
+                                              int64_t* transition_ms) {
+#ifdef V8_INTL_SUPPORT
+  if (v8_flags.icu_timezone_data) {
+    double transition;
+    if (!tz_cache_->NextLocalTimeOffsetTransition(static_cast<double>(time_ms),
+                                                  is_utc, &transition)) {
+      return false;
+    }
+    *transition_ms =
+        transition < static_cast<double>(std::numeric_limits<int64_t>::max())
+            ? static_cast<int64_t>(transition)
+            : std::numeric_limits<int64_t>::max();
+    return true;
+  }
+#endif
+  // Without ICU time zone data, the offsets come from the DST cache, whose
+  // transitions are only known to within kDefaultDSTDeltaInSec.
+  return false;
+}
+
 void DateCache::ExtendTheAfterSegment(int time_sec, int offset_ms) {
   if (after_->offset_ms == offset_ms &&
       after_->start_sec - kDefaultDSTDeltaInSec <= time_sec &&
@@ -5,6 +5,8 @@
 #ifndef V8_DATE_DATE_H_
 #define V8_DATE_DATE_H_
 
+#include <limits>
+
 #include "src/base/small-vector.h"
 #include "src/base/timezone-cache.h"
 #include "src/common/globals.h"
@@ -76,9 +78,7 @@ class V8_EXPORT_PRIVATE DateCache {
   }
 
   // ECMA 262 - ES#sec-local-time-zone-adjustment
-  int LocalOffsetInMs(int64_t time, bool is_utc) {
-    return GetLocalOffsetFromOS(time, is_utc);
-  }
+  int LocalOffsetInMs(int64_t time, bool is_utc);
 
   const char* LocalTimezone(int64_t time_ms) {
     if (time_ms < 0 || time_ms > kMaxEpochTimeInMs) {
@@ -167,6 +167,14 @@ class V8_EXPORT_PRIVATE DateCache {
 
   virtual int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc);
 
+  // Finds the first time after time_ms at which GetLocalOffsetFromOS may
+  // change and stores it in transition_ms, or the maximum int64_t if there is
+  // no later change. Returns false if the transitions are not known, e.g.
+  // without ICU time zone data. Overrides of GetLocalOffsetFromOS have to
+  // override this as well.
+  virtual bool GetNextOffsetTransitionFromOS(int64_t time_ms, bool is_utc,
+                                             int64_t* transition_ms);
+
  private:
   // The implementation relies on the fact that no time zones have
   // more than one daylight savings offset change per 19 days.
@@ -213,6 +221,44 @@ class V8_EXPORT_PRIVATE DateCache {
     return segment->start_sec > segment->end_sec;
   }
 
+  // Local offsets are cached per bucket of 2^kOffsetBucketBits ms (a little
+  // over a year). When a bucket is used twice in a row in its cache slot, its
+  // offset transitions are taken from GetNextOffsetTransitionFromOS, and each
+  // of them is confirmed against GetLocalOffsetFromOS on both sides;
+  // afterwards, lookups in the bucket don't call into the OS or ICU at all.
+  // Buckets whose transitions are unknown or can't be confirmed are not
+  // cached, so that every lookup gets the exact offset from the OS or ICU.
+  // Waiting for the second use keeps scattered one-off lookups from paying
+  // for the precomputation, and from evicting buckets that are in use.
+  static const int kOffsetBucketBits = 35;
+  static const int kOffsetCacheSize = 32;
+  // Morocco had four transitions a year while suspending DST during Ramadan;
+  // buckets with more transitions than this are not cached.
+  static const int kMaxOffsetTransitionsPerBucket = 6;
+
+  static const int kOffsetBucketUncacheable = -1;
+
+  struct OffsetBucket {
+    int64_t key;
+    // The most recent key that missed in this cache slot.
+    int64_t candidate_key;
+    // Or kOffsetBucketUncacheable if there were too many transitions.
+    int transition_count;
+    int64_t transition_ms[kMaxOffsetTransitionsPerBucket];
+    int offset_ms[kMaxOffsetTransitionsPerBucket + 1];
+  };
+
+  static const int64_t kInvalidOffsetBucketKey =
+      std::numeric_limits<int64_t>::min();
+
+  static int64_t OffsetBucketKey(int64_t time_ms) {
+    // Arithmetic shift, so that negative times get their own buckets.
+    return time_ms >> kOffsetBucketBits;
+  }
+
+  void ComputeOffsetBucket(OffsetBucket* bucket, int64_t key, bool is_utc);
+  void ClearOffsetCache();
+
   Smi stamp_;
 
   // Daylight Saving Time cache.
@@ -223,6 +269,9 @@ class V8_EXPORT_PRIVATE DateCache {
 
   int local_offset_ms_;
 
+  // Local offset cache, indexed by is_utc.
+  OffsetBucket offset_cache_[2][kOffsetCacheSize];
+
   // Year/Month/Day cache.
   bool ymd_valid_;
   int ymd_days_;
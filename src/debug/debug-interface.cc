@@ -15,8 +15,10 @@
 #include "src/debug/debug-property-iterator.h"
 #include "src/debug/debug-stack-trace-iterator.h"
 #include "src/debug/debug.h"
+#include "src/diagnostics/compilation-statistics.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/heap/heap.h"
+#include "src/ic/ic-stats.h"
 #include "src/objects/js-generator-inl.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/strings/string-builder-inl.h"
@@ -1178,6 +1180,39 @@ v8::MaybeLocal<v8::Value> EvaluateGlobalForTesting(
   RETURN_ESCAPED(result);
 }
 
+bool GetMegamorphicICSites(Isolate* v8_isolate,
+                           std::vector<MegamorphicICSite>* sites) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::MegamorphicICStats* stats = isolate->megamorphic_ic_stats();
+  if (stats == nullptr) return false;
+  stats->ForEachSite([sites](const i::MegamorphicICStats::Site& site,
+                             const i::MegamorphicICStats::Counts& counts) {
+    sites->push_back({site.script_id, site.function_position, site.slot,
+                      counts.transitions, counts.stub_cache_misses});
+  });
+  return true;
+}
+
+void DumpMegamorphicICSites(Isolate* v8_isolate) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  if (isolate->megamorphic_ic_stats() == nullptr) return;
+  i::StdoutStream os;
+  isolate->megamorphic_ic_stats()->Dump(os);
+}
+
+void ResetMegamorphicICSites(Isolate* v8_isolate) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  if (isolate->megamorphic_ic_stats() == nullptr) return;
+  isolate->megamorphic_ic_stats()->Reset();
+}
+
+void PrintFunctionCompilationStatistics(Isolate* v8_isolate, size_t count) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  if (isolate->function_compilation_statistics() == nullptr) return;
+  i::StdoutStream os;
+  isolate->function_compilation_statistics()->PrintTop(os, count);
+}
+
 void QueryObjects(v8::Local<v8::Context> v8_context,
                   QueryObjectPredicate* predicate,
                   std::vector<v8::Global<v8::Object>>* objects) {
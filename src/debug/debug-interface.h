@@ -520,6 +520,30 @@ void QueryObjects(v8::Local<v8::Context> context,
 void GlobalLexicalScopeNames(v8::Local<v8::Context> context,
                              std::vector<v8::Global<v8::String>>* names);
 
+// Per IC site statistics collected with --megamorphic-ic-stats. A site is
+// identified by the script, the start position of its function and its
+// feedback slot.
+struct MegamorphicICSite {
+  int script_id;
+  int function_position;
+  int slot;
+  uint64_t transitions;
+  uint64_t stub_cache_misses;
+};
+
+// Returns false if --megamorphic-ic-stats is not enabled.
+V8_EXPORT_PRIVATE bool GetMegamorphicICSites(
+    Isolate* isolate, std::vector<MegamorphicICSite>* sites);
+// Prints the collected statistics to stdout.
+V8_EXPORT_PRIVATE void DumpMegamorphicICSites(Isolate* isolate);
+// Discards the statistics collected so far.
+V8_EXPORT_PRIVATE void ResetMegamorphicICSites(Isolate* isolate);
+
+// Prints the |count| functions with the highest compile time across all tiers
+// to stdout. Requires --function-compilation-stats.
+V8_EXPORT_PRIVATE void PrintFunctionCompilationStatistics(Isolate* isolate,
+                                                          size_t count);
+
 void SetReturnValue(v8::Isolate* isolate, v8::Local<v8::Value> value);
 
 enum class NativeAccessorType {
@@ -9,6 +9,7 @@
 #include "src/codegen/register-configuration.h"
 #include "src/codegen/reloc-info.h"
 #include "src/debug/debug.h"
+#include "src/diagnostics/compilation-statistics.h"
 #include "src/deoptimizer/deoptimized-frame-info.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/execution/frames-inl.h"
@@ -19,6 +20,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/js-function-inl.h"
 #include "src/objects/oddball.h"
@@ -560,6 +562,36 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
     DCHECK_EQ(0, offset % kLazyDeoptExitSize);
     deopt_exit_index_ = eager_deopt_count + (offset / kLazyDeoptExitSize);
   }
+
+  if (V8_UNLIKELY(isolate->metrics_recorder()->HasEmbedderRecorder())) {
+    RecordDeoptimizationEvent();
+  }
+  if (V8_UNLIKELY(isolate->function_compilation_statistics() != nullptr)) {
+    isolate->function_compilation_statistics()->RecordDeoptimization(
+        function_.shared());
+  }
+}
+
+void Deoptimizer::RecordDeoptimizationEvent() {
+  // The event is delayed to a task since the embedder must not be called while
+  // the stack is being rewritten.
+  DeoptimizationData deopt_data =
+      DeoptimizationData::cast(compiled_code_.deoptimization_data());
+  v8::metrics::Deoptimization event;
+  event.reason = DeoptimizeReasonToString(GetDeoptInfo().deopt_reason);
+  event.lazy = deopt_kind_ == DeoptimizeKind::kLazy;
+  event.maglev = compiled_code_.kind() == CodeKind::MAGLEV;
+  event.bytecode_offset =
+      deopt_data.GetBytecodeOffset(deopt_exit_index_).ToInt();
+  SharedFunctionInfo shared = function_.shared();
+  if (shared.script().IsScript()) {
+    event.script_id = Script::cast(shared.script()).id();
+  }
+  event.function_start_position = shared.StartPosition();
+  HandleScope scope(isolate_);
+  isolate_->metrics_recorder()->DelayMainThreadEvent(
+      event, isolate_->GetOrRegisterRecorderContextId(
+                 handle(function_.native_context(), isolate_)));
 }
 
 Code Deoptimizer::FindOptimizedCode() {
@@ -1943,7 +1975,15 @@ void Deoptimizer::DoComputeBuiltinContinuation(
 }
 
 void Deoptimizer::MaterializeHeapObjects() {
-  translated_state_.Prepare(static_cast<Address>(stack_fp_));
+  if (values_to_materialize_.empty()) {
+    // Every output slot already got its final value from the frame writers,
+    // so there is no need to handlify the translated frames or to consult the
+    // materialized object store. This is the common case for eager deopts
+    // from code without escape-analyzed objects or unboxed doubles.
+    translated_state_.PrepareForFeedbackUpdate();
+  } else {
+    translated_state_.Prepare(static_cast<Address>(stack_fp_));
+  }
   if (v8_flags.deopt_every_n_times > 0) {
     // Doing a GC here will find problems with the deoptimized frames.
     isolate_->heap()->CollectAllGarbage(Heap::kNoGCFlags,
@@ -1518,14 +1518,18 @@ void TranslatedState::Init(Isolate* isolate, Address input_frame_pointer,
 void TranslatedState::Prepare(Address stack_frame_pointer) {
   for (auto& frame : frames_) frame.Handlify();
 
+  PrepareForFeedbackUpdate();
+  stack_frame_pointer_ = stack_frame_pointer;
+
+  UpdateFromPreviouslyMaterializedObjects();
+}
+
+void TranslatedState::PrepareForFeedbackUpdate() {
   if (!feedback_vector_.is_null()) {
     feedback_vector_handle_ =
         Handle<FeedbackVector>(feedback_vector_, isolate());
     feedback_vector_ = FeedbackVector();
   }
-  stack_frame_pointer_ = stack_frame_pointer;
-
-  UpdateFromPreviouslyMaterializedObjects();
 }
 
 TranslatedValue* TranslatedState::GetValueByObjectIndex(int object_index) {
@@ -367,6 +367,11 @@ class TranslatedState {
 
   void Prepare(Address stack_frame_pointer);
 
+  // Like Prepare, but only handlifies what DoUpdateFeedback needs. Used by the
+  // deoptimizer when no output value has to be materialized, so the values of
+  // the translated frames are never read again.
+  void PrepareForFeedbackUpdate();
+
   // Store newly materialized values into the isolate.
   void StoreMaterializedValuesAndDeopt(JavaScriptFrame* frame);
 
@@ -4,10 +4,14 @@
 
 #include "src/diagnostics/compilation-statistics.h"
 
+#include <algorithm>
+#include <iomanip>
 #include <ostream>
 #include <vector>
 
 #include "src/base/platform/platform.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -174,5 +178,109 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   return os;
 }
 
+base::TimeDelta FunctionCompilationStatistics::FunctionStats::TotalTime()
+    const {
+  base::TimeDelta total;
+  for (int i = 0; i < kTierCount; i++) total += time[i];
+  return total;
+}
+
+int FunctionCompilationStatistics::FunctionStats::TotalCompilations() const {
+  int total = 0;
+  for (int i = 0; i < kTierCount; i++) total += compilations[i];
+  return total;
+}
+
+// static
+std::pair<int, int> FunctionCompilationStatistics::KeyFor(
+    SharedFunctionInfo shared) {
+  Object script = shared.script();
+  int script_id = script.IsScript() ? Script::cast(script).id() : -1;
+  return std::make_pair(script_id, shared.StartPosition());
+}
+
+FunctionCompilationStatistics::FunctionStats&
+FunctionCompilationStatistics::LookupOrInsert(SharedFunctionInfo shared) {
+  std::pair<int, int> key = KeyFor(shared);
+  auto result = functions_.emplace(key, FunctionStats());
+  FunctionStats& stats = result.first->second;
+  if (result.second) {
+    stats.function_name = shared.DebugNameCStr().get();
+    stats.script_id = key.first;
+    stats.start_position = key.second;
+  }
+  return stats;
+}
+
+const FunctionCompilationStatistics::FunctionStats*
+FunctionCompilationStatistics::Lookup(SharedFunctionInfo shared) const {
+  auto it = functions_.find(KeyFor(shared));
+  return it == functions_.end() ? nullptr : &it->second;
+}
+
+void FunctionCompilationStatistics::RecordCompilation(SharedFunctionInfo shared,
+                                                      CodeKind kind,
+                                                      base::TimeDelta time) {
+  Tier tier;
+  switch (kind) {
+    case CodeKind::INTERPRETED_FUNCTION:
+      tier = Tier::kIgnition;
+      break;
+    case CodeKind::BASELINE:
+      tier = Tier::kSparkplug;
+      break;
+    case CodeKind::MAGLEV:
+      tier = Tier::kMaglev;
+      break;
+    case CodeKind::TURBOFAN:
+      tier = Tier::kTurbofan;
+      break;
+    default:
+      return;
+  }
+  FunctionStats& stats = LookupOrInsert(shared);
+  stats.time[static_cast<int>(tier)] += time;
+  stats.compilations[static_cast<int>(tier)]++;
+}
+
+void FunctionCompilationStatistics::RecordDeoptimization(
+    SharedFunctionInfo shared) {
+  LookupOrInsert(shared).deoptimizations++;
+}
+
+void FunctionCompilationStatistics::PrintTop(std::ostream& os,
+                                             size_t count) const {
+  std::vector<const FunctionStats*> sorted;
+  sorted.reserve(functions_.size());
+  for (const auto& entry : functions_) sorted.push_back(&entry.second);
+  count = std::min(count, sorted.size());
+  std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(),
+                    [](const FunctionStats* a, const FunctionStats* b) {
+                      return a->TotalTime() > b->TotalTime();
+                    });
+
+  static const char* const kTierNames[] = {"ignition", "sparkplug", "maglev",
+                                           "turbofan"};
+  static_assert(arraysize(kTierNames) == kTierCount);
+  os << "Top " << count << " of " << functions_.size()
+     << " functions by compile time (ms, compilations):" << std::endl;
+  for (size_t i = 0; i < count; i++) {
+    const FunctionStats& stats = *sorted[i];
+    os << std::fixed << std::setprecision(3) << std::setw(10)
+       << stats.TotalTime().InMillisecondsF() << "/"
+       << stats.TotalCompilations() << " "
+       << (stats.function_name.empty() ? "(anonymous)"
+                                       : stats.function_name.c_str())
+       << " [" << stats.script_id << ":" << stats.start_position << "]";
+    for (int tier = 0; tier < kTierCount; tier++) {
+      if (stats.compilations[tier] == 0) continue;
+      os << " " << kTierNames[tier] << "=" << stats.time[tier].InMillisecondsF()
+         << "/" << stats.compilations[tier];
+    }
+    if (stats.deoptimizations > 0) os << " deopts=" << stats.deoptimizations;
+    os << std::endl;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
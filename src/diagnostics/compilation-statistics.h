@@ -6,10 +6,12 @@
 #define V8_DIAGNOSTICS_COMPILATION_STATISTICS_H_
 
 #include <map>
+#include <ostream>
 #include <string>
 
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
+#include "src/objects/code-kind.h"
 #include "src/utils/allocation.h"
 
 namespace v8 {
@@ -17,6 +19,7 @@ namespace internal {
 
 class OptimizedCompilationInfo;
 class CompilationStatistics;
+class SharedFunctionInfo;
 
 struct AsPrintableStatistics {
   const CompilationStatistics& s;
@@ -90,6 +93,51 @@ class CompilationStatistics final : public Malloced {
 
 std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& s);
 
+// Per-function compile time accounting across all tiers, enabled by
+// --function-compilation-stats. Unlike CompilationStatistics, which breaks
+// TurboFan compilation down into phases, this only records the total time
+// per tier and function, which is cheap enough to leave enabled for a whole
+// run. Functions are identified by their script id and start position, since
+// SharedFunctionInfos move. Only accessed from the main thread.
+class FunctionCompilationStatistics final : public Malloced {
+ public:
+  enum class Tier { kIgnition, kSparkplug, kMaglev, kTurbofan };
+  static constexpr int kTierCount = static_cast<int>(Tier::kTurbofan) + 1;
+
+  struct FunctionStats {
+    std::string function_name;
+    int script_id = 0;
+    int start_position = 0;
+    base::TimeDelta time[kTierCount];
+    int compilations[kTierCount] = {};
+    int deoptimizations = 0;
+
+    base::TimeDelta TotalTime() const;
+    int TotalCompilations() const;
+  };
+
+  FunctionCompilationStatistics() = default;
+  FunctionCompilationStatistics(const FunctionCompilationStatistics&) = delete;
+  FunctionCompilationStatistics& operator=(
+      const FunctionCompilationStatistics&) = delete;
+
+  void RecordCompilation(SharedFunctionInfo shared, CodeKind kind,
+                         base::TimeDelta time);
+  void RecordDeoptimization(SharedFunctionInfo shared);
+
+  // Returns nullptr if nothing was recorded for |shared| yet.
+  const FunctionStats* Lookup(SharedFunctionInfo shared) const;
+
+  // Prints the |count| functions with the highest total compile time.
+  void PrintTop(std::ostream& os, size_t count) const;
+
+ private:
+  static std::pair<int, int> KeyFor(SharedFunctionInfo shared);
+  FunctionStats& LookupOrInsert(SharedFunctionInfo shared);
+
+  std::map<std::pair<int, int>, FunctionStats> functions_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -37,6 +37,7 @@
 #include <unistd.h>
 
 #include <memory>
+#include <vector>
 
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler.h"
@@ -347,19 +348,25 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Handle<Code> code,
       code->SourcePositionTable(isolate_, *shared);
   // Compute the entry count and get the names of all scripts.
   // Avoid additional work if the script name is repeated. Multiple script
-  // names only occur for cross-script inlining.
+  // names only occur for cross-script inlining. The position infos are kept,
+  // since resolving line and column numbers is the expensive part and both
+  // loops below need them.
   uint32_t entry_count = 0;
   Object last_script = Smi::zero();
+  std::vector<SourcePositionInfo> infos;
   std::vector<base::Vector<const char>> script_names;
+  std::vector<std::unique_ptr<char[]>> script_name_storage;
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
-    SourcePositionInfo info(
+    infos.push_back(
         GetSourcePositionInfo(code, shared, iterator.source_position()));
+    const SourcePositionInfo& info = infos.back();
     Object current_script = *info.script;
     if (current_script != last_script) {
       std::unique_ptr<char[]> name_storage;
-      auto name = GetScriptName(shared->script(), &name_storage, no_gc);
+      auto name = GetScriptName(current_script, &name_storage, no_gc);
       script_names.push_back(name);
+      if (name_storage) script_name_storage.push_back(std::move(name_storage));
       // Add the size of the name after each entry.
       size += name.size() + sizeof(kStringTerminator);
       last_script = current_script;
@@ -386,10 +393,10 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Handle<Code> code,
 
   last_script = Smi::zero();
   int script_names_index = 0;
+  size_t info_index = 0;
   for (SourcePositionTableIterator iterator(source_position_table);
-       !iterator.done(); iterator.Advance()) {
-    SourcePositionInfo info(
-        GetSourcePositionInfo(code, shared, iterator.source_position()));
+       !iterator.done(); iterator.Advance(), info_index++) {
+    const SourcePositionInfo& info = infos[info_index];
     PerfJitDebugEntry entry;
     // The entry point of the function will be placed straight after the ELF
     // header when processed by "perf inject". Adjust the position addresses
@@ -4,9 +4,11 @@
 
 #include "src/execution/futex-emulation.h"
 
+#include <array>
 #include <limits>
 
 #include "src/api/api-inl.h"
+#include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/execution/isolate.h"
@@ -24,12 +26,27 @@ namespace internal {
 
 using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
+// The waiters are spread over a fixed number of FutexWaitLists, selected by
+// their wait location, so that waiting on and notifying unrelated locations
+// doesn't contend on a single process-wide mutex. All nodes waiting on the
+// same location are on the same FutexWaitList.
+//
+// The mutex of a FutexWaitList protects its composition (i.e. no elements may
+// be added or removed without holding this mutex), as well as the `waiting_`
+// field of each individual list node that is currently part of the list. It
+// must be the mutex used together with the `cond_` condition variable of such
+// nodes.
 class FutexWaitList {
  public:
   FutexWaitList() = default;
   FutexWaitList(const FutexWaitList&) = delete;
   FutexWaitList& operator=(const FutexWaitList&) = delete;
 
+  // Returns the FutexWaitList for nodes waiting on |wait_location|.
+  static FutexWaitList* ForLocation(const int8_t* wait_location);
+
+  base::Mutex* mutex() { return &mutex_; }
+
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
@@ -86,6 +103,8 @@ class FutexWaitList {
  private:
   friend class FutexEmulation;
 
+  base::Mutex mutex_;
+
   struct HeadAndTail {
     FutexWaitListNode* head;
     FutexWaitListNode* tail;
@@ -94,21 +113,24 @@ class FutexWaitList {
   // location.
   std::map<int8_t*, HeadAndTail> location_lists_;
 
-  // Isolate* -> linked list of Nodes which are waiting for their Promises to
-  // be resolved.
+  // Isolate* -> linked list of Nodes which were waiting on a location of this
+  // FutexWaitList and are now waiting for their Promises to be resolved.
   std::map<Isolate*, HeadAndTail> isolate_promises_to_resolve_;
 };
 
 namespace {
-// `g_mutex` protects the composition of `g_wait_list` (i.e. no elements may be
-// added or removed without holding this mutex), as well as the `waiting_`
-// and `interrupted_` fields for each individual list node that is currently
-// part of the list. It must be the mutex used together with the `cond_`
-// condition variable of such nodes.
-base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
-base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
+constexpr size_t kNumFutexWaitLists = 64;
+using FutexWaitLists = std::array<FutexWaitList, kNumFutexWaitLists>;
+base::LazyInstance<FutexWaitLists>::type g_wait_lists =
+    LAZY_INSTANCE_INITIALIZER;
 }  // namespace
 
+// static
+FutexWaitList* FutexWaitList::ForLocation(const int8_t* wait_location) {
+  size_t hash = base::hash_value(reinterpret_cast<uintptr_t>(wait_location));
+  return &g_wait_lists.Pointer()->at(hash % kNumFutexWaitLists);
+}
+
 FutexWaitListNode::~FutexWaitListNode() {
   // Assert that the timeout task was cancelled.
   DCHECK_EQ(CancelableTaskManager::kInvalidTaskId, timeout_task_id_);
@@ -125,30 +147,37 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  // Set the interrupted_ flag first; it is tested with the wait list mutex
+  // held before a wait blocks on the condition variable. Since wait_location_
+  // is updated before that test, either the waiter sees the flag, or we see
+  // the location it is (about to be) waiting on here, and lock the mutex of
+  // its wait list before notifying. We know that the mutex will have been
+  // unlocked if the waiter is currently waiting on the condition variable.
+  interrupted_ = true;
+  int8_t* wait_location = wait_location_;
+  if (wait_location == nullptr) return;
+  NoGarbageCollectionMutexGuard lock_guard(
+      FutexWaitList::ForLocation(wait_location)->mutex());
 
   // if not waiting, this will not have any effect.
   cond_.NotifyOne();
-  interrupted_ = true;
 }
 
 class ResolveAsyncWaiterPromisesTask : public CancelableTask {
  public:
   ResolveAsyncWaiterPromisesTask(CancelableTaskManager* cancelable_task_manager,
-                                 Isolate* isolate)
-      : CancelableTask(cancelable_task_manager), isolate_(isolate) {}
+                                 Isolate* isolate, FutexWaitList* wait_list)
+      : CancelableTask(cancelable_task_manager),
+        isolate_(isolate),
+        wait_list_(wait_list) {}
 
   void RunInternal() override {
-    FutexEmulation::ResolveAsyncWaiterPromises(isolate_);
+    FutexEmulation::ResolveAsyncWaiterPromises(isolate_, wait_list_);
   }
 
  private:
   Isolate* isolate_;
+  FutexWaitList* wait_list_;
 };
 
 class AsyncWaiterTimeoutTask : public CancelableTask {
@@ -168,25 +197,27 @@ class AsyncWaiterTimeoutTask : public CancelableTask {
 void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // This function can run in any thread.
 
-  g_mutex.Pointer()->AssertHeld();
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(node->wait_location_);
+  wait_list->mutex()->AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
   // woken up ones.
   node->async_timeout_time_ = base::TimeTicks();
 
-  g_wait_list.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
 
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->isolate_for_async_waiters_);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
     isolate_map.insert(std::make_pair(node->isolate_for_async_waiters_,
                                       FutexWaitList::HeadAndTail{node, node}));
     auto task = std::make_unique<ResolveAsyncWaiterPromisesTask>(
-        node->cancelable_task_manager_, node->isolate_for_async_waiters_);
+        node->cancelable_task_manager_, node->isolate_for_async_waiters_,
+        wait_list);
     node->task_runner_->PostNonNestableTask(std::move(task));
   } else {
     // Add this Node into the existing list.
@@ -202,7 +233,7 @@ void FutexWaitList::AddNode(FutexWaitListNode* node) {
   auto it = location_lists_.find(node->wait_location_);
   if (it == location_lists_.end()) {
     location_lists_.insert(
-        std::make_pair(node->wait_location_, HeadAndTail{node, node}));
+        std::make_pair(node->wait_location_.load(), HeadAndTail{node, node}));
   } else {
     it->second.tail->next_ = node;
     node->prev_ = it->second.tail;
@@ -242,14 +273,11 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 }
 
 void AtomicsWaitWakeHandle::Wake() {
-  // Adding a separate `NotifyWake()` variant that doesn't acquire the lock
-  // itself would likely just add unnecessary complexity..
-  // The split lock by itself isn’t an issue, as long as the caller properly
-  // synchronizes this with the closing `AtomicsWaitCallback`.
-  {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-    stopped_ = true;
-  }
+  // stopped_ is set before NotifyWake() sets the node's interrupted_ flag, so
+  // a waiter that observes the interruption also observes stopped_. This
+  // still needs to be synchronized by the caller with the closing
+  // `AtomicsWaitCallback`.
+  stopped_ = true;
   isolate_->futex_wait_list_node()->NotifyWake();
 }
 
@@ -381,16 +409,17 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
   do {  // Not really a loop, just makes it easier to break out early.
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
     DCHECK(backing_store);
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
-    auto wait_location =
-        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->wait_location_ = wait_location;
     node->waiting_ = true;
 
@@ -421,11 +450,12 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
       timeout_time = current_time + rel_timeout;
     }
 
-    g_wait_list.Pointer()->AddNode(node);
+    wait_list->AddNode(node);
 
     while (true) {
-      bool interrupted = node->interrupted_;
-      node->interrupted_ = false;
+      // NotifyWake() sets interrupted_ without holding the mutex, so test and
+      // clear it in one step to not lose a notification in between.
+      bool interrupted = node->interrupted_.exchange(false);
 
       // Unlock the mutex here to prevent deadlock from lock ordering between
       // mutex and mutexes locked by HandleInterrupts.
@@ -457,6 +487,9 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
 
       if (node->interrupted_) {
         // An interrupt occurred while the mutex was unlocked. Don't wait yet.
+        // The mutex stays locked until cond_ is waited on below, so a
+        // NotifyWake() that sets the flag after this check blocks on the mutex
+        // and can only notify once we are waiting.
         continue;
       }
 
@@ -482,16 +515,16 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
         bool wait_for_result =
-            node->cond_.WaitFor(g_mutex.Pointer(), time_until_timeout);
+            node->cond_.WaitFor(wait_list->mutex(), time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(g_mutex.Pointer());
+        node->cond_.Wait(wait_list->mutex());
       }
 
       // Spurious wakeup, interrupt or timeout.
     }
 
-    g_wait_list.Pointer()->RemoveNode(node);
+    wait_list->RemoveNode(node);
   } while (false);
 
   isolate->RunAtomicsWaitCallback(callback_result, array_buffer, addr, value,
@@ -543,15 +576,17 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
   enum class ResultKind { kNotEqual, kTimedOut, kAsync };
   ResultKind result_kind;
   {
-    // 16. Perform EnterCriticalSection(WL).
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+
+    // 16. Perform EnterCriticalSection(WL).
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
     // 17. Let w be ! AtomicLoad(typedArray, i).
-    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(
-        static_cast<int8_t*>(backing_store->buffer_start()) + addr);
+    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
     // If loading a Wasm value, it needs to be reversed on Big Endian platforms.
@@ -579,7 +614,7 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
             std::move(task), rel_timeout.InSecondsF());
       }
 
-      g_wait_list.Pointer()->AddNode(node);
+      wait_list->AddNode(node);
     }
 
     // Leaving the block collapses the following steps:
@@ -658,10 +693,11 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   int waiters_woken = 0;
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  auto& location_lists = wait_list->location_lists_;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -730,7 +766,7 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
     if (delete_this_node) {
       auto old_node = node;
       node = node->next_;
-      g_wait_list.Pointer()->RemoveNode(old_node);
+      wait_list->RemoveNode(old_node);
       DCHECK_EQ(CancelableTaskManager::kInvalidTaskId,
                 old_node->timeout_task_id_);
       delete old_node;
@@ -744,7 +780,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
 
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding g_mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any
+  // FutexWaitList mutex.
 
   DCHECK(node->IsAsync());
 
@@ -815,14 +852,15 @@ void FutexEmulation::ResolveAsyncWaiterPromise(FutexWaitListNode* node) {
   }
 }
 
-void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
+void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate,
+                                                FutexWaitList* wait_list) {
   // This function must run in the main thread of isolate.
 
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -853,7 +891,9 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList* wait_list =
+        FutexWaitList::ForLocation(node->wait_location_);
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
     node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
     if (!node->waiting_) {
@@ -861,7 +901,7 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
       // resolved. Ignore the timeout.
       return;
     }
-    g_wait_list.Pointer()->RemoveNode(node);
+    wait_list->RemoveNode(node);
   }
 
   // "node" has been taken out of the lists, so it's ok to access it without
@@ -874,44 +914,46 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
-  // Iterate all locations to find nodes belonging to "isolate" and delete them.
-  // The Isolate is going away; don't bother cleaning up the Promises in the
-  // NativeContext. Also we don't need to cancel the timeout tasks, since they
-  // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = g_wait_list.Pointer()->location_lists_;
-    auto it = location_lists.begin();
-    while (it != location_lists.end()) {
-      FutexWaitListNode*& head = it->second.head;
-      FutexWaitListNode*& tail = it->second.tail;
-      FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail);
-      // head and tail are either both nullptr or both non-nullptr.
-      DCHECK_EQ(head == nullptr, tail == nullptr);
-      if (head == nullptr) {
-        location_lists.erase(it++);
-      } else {
-        ++it;
+  for (FutexWaitList& wait_list : g_wait_lists.Get()) {
+    NoGarbageCollectionMutexGuard lock_guard(wait_list.mutex());
+
+    // Iterate all locations to find nodes belonging to "isolate" and delete
+    // them. The Isolate is going away; don't bother cleaning up the Promises
+    // in the NativeContext. Also we don't need to cancel the timeout tasks,
+    // since they will be cancelled by Isolate::Deinit.
+    {
+      auto& location_lists = wait_list.location_lists_;
+      auto it = location_lists.begin();
+      while (it != location_lists.end()) {
+        FutexWaitListNode*& head = it->second.head;
+        FutexWaitListNode*& tail = it->second.tail;
+        FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail);
+        // head and tail are either both nullptr or both non-nullptr.
+        DCHECK_EQ(head == nullptr, tail == nullptr);
+        if (head == nullptr) {
+          location_lists.erase(it++);
+        } else {
+          ++it;
+        }
       }
     }
-  }
 
-  {
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
-    auto it = isolate_map.find(isolate);
-    if (it != isolate_map.end()) {
-      auto node = it->second.head;
-      while (node) {
-        DCHECK_EQ(isolate, node->isolate_for_async_waiters_);
-        node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
-        node = FutexWaitList::DeleteAsyncWaiterNode(node);
+    {
+      auto& isolate_map = wait_list.isolate_promises_to_resolve_;
+      auto it = isolate_map.find(isolate);
+      if (it != isolate_map.end()) {
+        auto node = it->second.head;
+        while (node) {
+          DCHECK_EQ(isolate, node->isolate_for_async_waiters_);
+          node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
+          node = FutexWaitList::DeleteAsyncWaiterNode(node);
+        }
+        isolate_map.erase(it);
       }
-      isolate_map.erase(it);
     }
-  }
 
-  g_wait_list.Pointer()->Verify();
+    wait_list.Verify();
+  }
 }
 
 Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
@@ -919,10 +961,11 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->GetByteLength());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+
+  auto& location_lists = wait_list->location_lists_;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -943,16 +986,17 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
 }
 
 Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   int waiters = 0;
-  for (const auto& it : g_wait_list.Pointer()->location_lists_) {
-    FutexWaitListNode* node = it.second.head;
-    while (node != nullptr) {
-      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-        waiters++;
+  for (FutexWaitList& wait_list : g_wait_lists.Get()) {
+    NoGarbageCollectionMutexGuard lock_guard(wait_list.mutex());
+    for (const auto& it : wait_list.location_lists_) {
+      FutexWaitListNode* node = it.second.head;
+      while (node != nullptr) {
+        if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+          waiters++;
+        }
+        node = node->next_;
       }
-      node = node->next_;
     }
   }
 
@@ -964,10 +1008,12 @@ Object FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   DCHECK_LT(addr, array_buffer->GetByteLength());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+  FutexWaitList* wait_list = FutexWaitList::ForLocation(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   int waiters = 0;
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   for (const auto& it : isolate_map) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <atomic>
+
 #include "include/v8-persistent-handle.h"
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
@@ -52,7 +54,7 @@ class AtomicsWaitWakeHandle {
 
  private:
   Isolate* isolate_;
-  bool stopped_ = false;
+  std::atomic<bool> stopped_{false};
 };
 
 class FutexWaitListNode {
@@ -96,7 +98,8 @@ class FutexWaitListNode {
   CancelableTaskManager* cancelable_task_manager_ = nullptr;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // prev_ and next_ are protected by the mutex of the FutexWaitList for
+  // wait_location_.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -110,14 +113,16 @@ class FutexWaitListNode {
   // while the FutexWaitListNode is still alive. FutexWaitListNode must know its
   // wait location, since they are stored in per-location lists, and to remove
   // the node, we need to be able to find the list it's on (to be able to
-  // update the head and tail of the list).
-  int8_t* wait_location_ = nullptr;
+  // update the head and tail of the list). The location also selects the
+  // FutexWaitList (and thereby the mutex) of the node. It is atomic because
+  // NotifyWake() reads it without holding that mutex.
+  std::atomic<int8_t*> wait_location_{nullptr};
 
-  // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
-  // if this node is currently contained in FutexEmulation::wait_list_
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ is protected by the mutex of the FutexWaitList for
+  // wait_location_ if this node is currently contained in that list.
   bool waiting_ = false;
-  bool interrupted_ = false;
+  // Set by NotifyWake() without holding any mutex; see there.
+  std::atomic<bool> interrupted_{false};
 
   // Only for async FutexWaitListNodes. Weak Global handle. Must not be
   // synchronously resolved by a non-owner Isolate.
@@ -226,8 +231,10 @@ class FutexEmulation : public AllStatic {
                           size_t addr, T value, bool use_timeout,
                           int64_t rel_timeout_ns, CallType call_type);
 
-  // Resolve the Promises of the async waiters which belong to |isolate|.
-  static void ResolveAsyncWaiterPromises(Isolate* isolate);
+  // Resolve the Promises of the async waiters which belong to |isolate| and
+  // were waiting on a location of |wait_list|.
+  static void ResolveAsyncWaiterPromises(Isolate* isolate,
+                                         FutexWaitList* wait_list);
 
   static void ResolveAsyncWaiterPromise(FutexWaitListNode* node);
 
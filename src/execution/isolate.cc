@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -67,6 +68,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/setup-isolate.h"
@@ -108,6 +110,7 @@
 #include "src/strings/string-builder-inl.h"
 #include "src/strings/string-stream.h"
 #include "src/tasks/cancelable-task.h"
+#include "src/tasks/task-utils.h"
 #include "src/tracing/tracing-category-observer.h"
 #include "src/utils/address-map.h"
 #include "src/utils/ostreams.h"
@@ -1184,6 +1187,11 @@ void VisitStack(Isolate* isolate, Visitor* visitor,
 Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
                                            FrameSkipMode mode,
                                            Handle<Object> caller) {
+  // Code that throws for control flow commonly sets Error.stackTraceLimit to
+  // 0. Don't walk and summarize the stack in that case, summarizing even the
+  // first optimized frame decodes its deoptimization data.
+  if (limit == 0) return isolate->factory()->empty_fixed_array();
+
   TRACE_EVENT_BEGIN1(TRACE_DISABLED_BY_DEFAULT("v8.stack_trace"), __func__,
                      "maxFrameCount", limit);
 
@@ -3517,6 +3525,11 @@ void Isolate::Deinit() {
   DisallowHeapAllocation no_allocation;
 
   tracing_cpu_profiler_.reset();
+  if (megamorphic_ic_stats_) {
+    StdoutStream os;
+    megamorphic_ic_stats_->Dump(os);
+    megamorphic_ic_stats_.reset();
+  }
   if (v8_flags.stress_sampling_allocation_profiler > 0) {
     heap_profiler()->StopSamplingHeapProfiler();
   }
@@ -4090,6 +4103,16 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  bool CanPostWorkerTasks() override {
+    return v8_flags.bigint_parallel_multiplication &&
+           V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 1;
+  }
+
+  void PostWorkerTask(std::function<void()> task) override {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        MakeCancelableTask(isolate_, std::move(task)));
+  }
+
  private:
   Isolate* isolate_;
 };
@@ -4342,6 +4365,14 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   // because it makes use of interrupts.
   tracing_cpu_profiler_.reset(new TracingCpuProfilerImpl(this));
 
+  if (v8_flags.megamorphic_ic_stats) {
+    megamorphic_ic_stats_ = std::make_unique<MegamorphicICStats>();
+  }
+  if (v8_flags.function_compilation_stats) {
+    function_compilation_statistics_ =
+        std::make_unique<FunctionCompilationStatistics>();
+  }
+
   bootstrapper_->Initialize(create_heap_objects);
 
   if (create_heap_objects) {
@@ -4477,6 +4508,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
 #ifdef V8_ENABLE_WEBASSEMBLY
   if (v8_flags.experimental_wasm_stack_switching) {
+    wasm_stack_pool_ = std::make_unique<wasm::StackPool>();
     std::unique_ptr<wasm::StackMemory> stack(
         wasm::StackMemory::GetCurrentStackView(this));
     this->wasm_stacks() = stack.get();
@@ -4607,6 +4639,13 @@ void Isolate::DumpAndResetStats() {
     }
     turbo_statistics_.reset();
   }
+  if (function_compilation_statistics_ != nullptr) {
+    StdoutStream os;
+    function_compilation_statistics_->PrintTop(
+        os, std::max(0, v8_flags.function_compilation_stats_count.value()));
+    function_compilation_statistics_ =
+        std::make_unique<FunctionCompilationStatistics>();
+  }
 #if V8_ENABLE_WEBASSEMBLY
   // TODO(7424): There is no public API for the {WasmEngine} yet. So for now we
   // just dump and reset the engines statistics together with the Isolate.
@@ -4615,8 +4654,13 @@ void Isolate::DumpAndResetStats() {
   }
 #endif  // V8_ENABLE_WEBASSEMBLY
 #if V8_RUNTIME_CALL_STATS
-  if (V8_UNLIKELY(TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
-                  v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE)) {
+  unsigned runtime_stats =
+      TracingFlags::runtime_stats.load(std::memory_order_relaxed);
+  if (V8_UNLIKELY(
+          runtime_stats ==
+              v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE ||
+          runtime_stats ==
+              v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING)) {
     counters()->worker_thread_runtime_call_stats()->AddToMainTable(
         counters()->runtime_call_stats());
     counters()->runtime_call_stats()->Print();
@@ -5582,6 +5626,7 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
 void Isolate::IsolateInBackgroundNotification() {
   is_isolate_in_background_ = true;
   heap()->ActivateMemoryReducerIfNeeded();
+  allocator()->ReleasePooledSegments();
 }
 
 void Isolate::IsolateInForegroundNotification() {
@@ -5674,21 +5719,35 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              Handle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
+  ICUObjectCacheEntry* entries =
       icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (int i = 0; i < kICUObjectCacheSize; i++) {
+    if (!entries[i].obj) break;
+    if (StringEqualsLocales(this, entries[i].locales, locales)) {
+      // Move the entry to the front.
+      std::rotate(entries, entries + i, entries + i + 1);
+      return entries[0].obj.get();
+    }
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  ICUObjectCacheEntry* entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  // Drop the least recently used entry and insert the new one at the front.
+  std::rotate(entries, entries + kICUObjectCacheSize - 1,
+              entries + kICUObjectCacheSize);
+  entries[0] = {GetStringFromLocales(this, locales), std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  for (ICUObjectCacheEntry& entry :
+       icu_object_cache_[static_cast<int>(cache_type)]) {
+    entry = ICUObjectCacheEntry{};
+  }
 }
 
 void Isolate::clear_cached_icu_objects() {
@@ -110,6 +110,7 @@ class CodeTracer;
 class CommonFrame;
 class CompilationCache;
 class CompilationStatistics;
+class FunctionCompilationStatistics;
 class Counters;
 class Debug;
 class Deoptimizer;
@@ -126,6 +127,7 @@ class LazyCompileDispatcher;
 class LocalIsolate;
 class V8FileLogger;
 class MaterializedObjectStore;
+class MegamorphicICStats;
 class Microtask;
 class MicrotaskQueue;
 class OptimizingCompileDispatcher;
@@ -174,6 +176,7 @@ class Recorder;
 
 namespace wasm {
 class StackMemory;
+class StackPool;
 }
 
 #define RETURN_FAILURE_IF_SCHEDULED_EXCEPTION(isolate) \
@@ -1450,6 +1453,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       kDefaultCollator, kDefaultNumberFormat, kDefaultSimpleDateFormat,
       kDefaultSimpleDateFormatForTime, kDefaultSimpleDateFormatForDate};
   static constexpr int kICUObjectCacheTypeCount = 5;
+  // The number of {locales,obj} pairs kept for each cache type.
+  static constexpr int kICUObjectCacheSize = 4;
 
   icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type,
                                       Handle<Object> locales);
@@ -1532,6 +1537,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   }
 
   std::shared_ptr<CompilationStatistics> GetTurboStatistics();
+  // Only non-null with --function-compilation-stats.
+  FunctionCompilationStatistics* function_compilation_statistics() const {
+    return function_compilation_statistics_.get();
+  }
   CodeTracer* GetCodeTracer();
 
   void DumpAndResetStats();
@@ -1780,6 +1789,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return lazy_compile_dispatcher_.get();
   }
 
+  // Only non-null with --megamorphic-ic-stats.
+  MegamorphicICStats* megamorphic_ic_stats() const {
+    return megamorphic_ic_stats_.get();
+  }
+
   bool IsInAnyContext(Object object, uint32_t index);
 
   void ClearKeptObjects();
@@ -2023,6 +2037,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
 #ifdef V8_ENABLE_WEBASSEMBLY
   wasm::StackMemory*& wasm_stacks() { return wasm_stacks_; }
+  wasm::StackPool* wasm_stack_pool() { return wasm_stack_pool_.get(); }
 #endif
 
   // Access to the global "locals block list cache". Caches outer-stack
@@ -2268,8 +2283,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the kICUObjectCacheSize most recently accessed
+  // {locales,obj} pairs for each cache type, most recently used first.
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2279,7 +2294,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount]
+                                       [kICUObjectCacheSize];
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -2400,6 +2416,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   v8::Isolate::UseCounterCallback use_counter_callback_ = nullptr;
 
   std::shared_ptr<CompilationStatistics> turbo_statistics_;
+  std::unique_ptr<FunctionCompilationStatistics>
+      function_compilation_statistics_;
   std::shared_ptr<metrics::Recorder> metrics_recorder_;
   uintptr_t last_recorder_context_id_ = 0;
   std::unordered_map<uintptr_t, v8::Global<v8::Context>>
@@ -2462,6 +2480,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::unique_ptr<TracingCpuProfilerImpl> tracing_cpu_profiler_;
 
+  std::unique_ptr<MegamorphicICStats> megamorphic_ic_stats_;
+
   EmbeddedFileWriterInterface* embedded_file_writer_ = nullptr;
 
   // The top entry of the v8::Context::BackupIncumbentScope stack.
@@ -2516,6 +2536,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
 #ifdef V8_ENABLE_WEBASSEMBLY
   wasm::StackMemory* wasm_stacks_;
+  std::unique_ptr<wasm::StackPool> wasm_stack_pool_;
 #endif
 
   // Enables the host application to provide a mechanism for recording a
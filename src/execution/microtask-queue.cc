@@ -11,6 +11,8 @@
 #include "src/base/logging.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
+#include "src/logging/counters-scopes.h"
+#include "src/logging/counters.h"
 #include "src/objects/microtask-inl.h"
 #include "src/objects/visitors.h"
 #include "src/roots/roots-inl.h"
@@ -168,6 +170,7 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
         isolate->handle_scope_implementer());
     TRACE_EVENT_BEGIN0("v8.execute", "RunMicrotasks");
     {
+      TimedHistogramScope timer(isolate->counters()->microtask_checkpoint());
       TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.RunMicrotasks");
       maybe_result = Execution::TryRunMicrotasks(isolate, this);
       processed_microtask_count =
@@ -175,6 +178,8 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     }
     TRACE_EVENT_END1("v8.execute", "RunMicrotasks", "microtask_count",
                      processed_microtask_count);
+    isolate->counters()->microtasks_per_checkpoint()->AddSample(
+        processed_microtask_count);
   }
 
   if (isolate->is_execution_terminating()) {
@@ -338,7 +338,10 @@ Object StackGuard::HandleInterrupts() {
   if (TestAndClear(&interrupt_flags, INSTALL_MAGLEV_CODE)) {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.FinalizeMaglevConcurrentCompilation");
-    isolate_->maglev_concurrent_dispatcher()->FinalizeFinishedJobs();
+    const int budget_ms = v8_flags.maglev_finalization_budget_ms;
+    isolate_->maglev_concurrent_dispatcher()->FinalizeFinishedJobs(
+        budget_ms > 0 ? base::TimeDelta::FromMilliseconds(budget_ms)
+                      : base::TimeDelta::Max());
   }
 #endif  // V8_ENABLE_MAGLEV
 
@@ -481,6 +481,9 @@ DEFINE_BOOL(trace_maglev_regalloc, false, "trace maglev register allocation")
 DEFINE_BOOL(maglev_function_context_specialization, true,
             "enable function context specialization in maglev")
 DEFINE_BOOL(maglev_ool_prologue, false, "use the Maglev out of line prologue")
+DEFINE_INT(maglev_finalization_budget_ms, 1,
+           "time budget (in ms) for finalizing concurrent maglev jobs per "
+           "install interrupt (0 = unlimited)")
 
 #if ENABLE_SPARKPLUG
 DEFINE_WEAK_IMPLICATION(future, sparkplug)
@@ -566,14 +569,26 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(pretenuring_remember_tenured_sites, true,
+            "allow allocation sites that were tenured before their decision "
+            "was reset to tenure again without a maximum size young GC")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
+DEFINE_INT(page_promotion_survival_gcs, 3,
+           "number of GCs a new space page has to go through "
+           "before it can be promoted based on its survival rate (0 disables)")
+DEFINE_INT(page_promotion_survival_threshold, 30,
+           "min survival rate (decayed average percentage of live bytes over "
+           "GCs) to promote a new space page as a whole")
 DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
 DEFINE_BOOL(trace_pretenuring_statistics, false,
             "trace allocation site pretenuring statistics")
 DEFINE_BOOL(track_field_types, true, "track field types")
+DEFINE_BOOL(slack_tracking_growth_reserve, false,
+            "keep in-object slack for properties that objects are observed to "
+            "gain after construction when completing slack tracking")
 DEFINE_BOOL(trace_block_coverage, false,
             "trace collected block coverage information")
 DEFINE_BOOL(trace_protector_invalidation, false,
@@ -629,6 +644,9 @@ DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_reo_across_conditional_jumps, false,
+            "keep register equivalences on the fall-through path of "
+            "conditional jumps")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
@@ -713,6 +731,10 @@ DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "--short-builtin-calls are also enabled")
 DEFINE_INT(baseline_batch_compilation_threshold, 4 * KB,
            "the estimated instruction size of a batch to trigger compilation")
+DEFINE_INT(baseline_batch_compilation_time_budget_us, 0,
+           "if positive, derive the batch size threshold from the measured "
+           "main-thread compile throughput so that a batch takes about this "
+           "long to compile (ignored with --concurrent-sparkplug)")
 DEFINE_BOOL(trace_baseline, false, "trace baseline compilation")
 DEFINE_BOOL(trace_baseline_batch_compilation, false,
             "trace baseline batch compilation")
@@ -755,6 +777,15 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_recompilation_prioritize, true,
+            "compile queued functions with the most invocations first instead "
+            "of in FIFO order")
+DEFINE_INT(concurrent_recompilation_max_bypass, 8,
+           "number of times the oldest queued function can be passed over by "
+           "hotter ones before it is compiled")
+DEFINE_INT(concurrent_recompilation_batch_size, 4,
+           "maximum number of queued functions compiled by a single "
+           "background task, amortizing the per-task setup cost")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -869,6 +900,9 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "be considered for optimization; too high values may cause "
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
+DEFINE_BOOL(turbo_inlining_frequency_per_size, false,
+            "rank inlining candidates by call frequency per bytecode size "
+            "rather than by call frequency alone")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
@@ -963,6 +997,9 @@ DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
 DEFINE_BOOL(turbo_optimize_apply, true, "optimize Function.prototype.apply")
 DEFINE_BOOL(turbo_optimize_math_minmax, true,
             "optimize call math.min/max with double array")
+DEFINE_BOOL(optimize_proxy_loads, true,
+            "call the proxy [[Get]] builtin directly from optimized code for "
+            "monomorphic loads from proxies")
 
 DEFINE_BOOL(turbo_collect_feedback_in_generic_lowering, true,
             "enable experimental feedback collection in generic lowering.")
@@ -1058,8 +1095,14 @@ DEFINE_DEBUG_BOOL(trace_wasm_stack_switching, false,
                   "trace wasm stack switching")
 DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stacks for wasm stack-switching (in kB)")
+DEFINE_INT(wasm_stack_pool_size, 4,
+           "maximum number of segments of retired wasm stacks that are kept "
+           "per isolate for reuse by new stacks")
 DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
+DEFINE_BOOL(liftoff_loop_locals_in_registers, false,
+            "keep locals that are cached in registers in those registers "
+            "across loop headers in Liftoff instead of spilling them")
 DEFINE_BOOL(liftoff_only, false,
             "disallow TurboFan compilation for WebAssembly (for testing)")
 DEFINE_IMPLICATION(liftoff_only, liftoff)
@@ -1165,6 +1208,10 @@ DEFINE_WEAK_IMPLICATION(experimental_wasm_gc, wasm_speculative_inlining)
 
 DEFINE_BOOL(wasm_loop_unrolling, true,
             "enable loop unrolling for wasm functions")
+DEFINE_UINT(wasm_loop_unrolling_size_budget, 50,
+            "code size budget, in nodes, for unrolling an unnested loop")
+DEFINE_UINT(wasm_loop_unrolling_max_count, 5,
+            "maximum number of times a loop is unrolled")
 DEFINE_BOOL(wasm_loop_peeling, false, "enable loop peeling for wasm functions")
 DEFINE_SIZE_T(wasm_loop_peeling_max_size, 1000, "maximum size for peeling")
 DEFINE_BOOL(wasm_fuzzer_gen_test, false,
@@ -1270,6 +1317,9 @@ DEFINE_BOOL(trace_gc_nvp, false,
             "after each garbage collection")
 DEFINE_BOOL(trace_gc_ignore_scavenger, false,
             "do not print trace line after scavenger collection")
+DEFINE_BOOL(idle_time_scavenge, false,
+            "perform scavenges during idle notifications when the young "
+            "generation is sufficiently full")
 DEFINE_BOOL(trace_idle_notification, false,
             "print one trace line following each idle notification")
 DEFINE_BOOL(trace_idle_notification_verbose, false,
@@ -1337,6 +1387,10 @@ DEFINE_BOOL(cppgc_young_generation, false,
             "run young generation garbage collections in Oilpan")
 DEFINE_IMPLICATION(cppgc_young_generation, minor_mc)
 DEFINE_BOOL(write_protect_code_memory, true, "write protect code memory")
+DEFINE_BOOL(memory_protection_keys, true,
+            "protect JS code memory with PKU if available in a build with "
+            "v8_enable_heap_pku_jit_write_protect (takes precedence over "
+            "--write-protect-code-memory)")
 #if defined(V8_ATOMIC_OBJECT_FIELD_WRITES)
 DEFINE_BOOL(concurrent_marking, true, "use concurrent marking")
 #else
@@ -1351,7 +1405,13 @@ DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
+DEFINE_UINT(concurrent_allocator_max_lab_size_kb, 128,
+            "max size of the linear allocation areas that background threads "
+            "refill from the space free lists (in KBytes)")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
+DEFINE_BOOL(numa_aware_marking, false,
+            "let concurrent marking tasks prefer stealing marking worklist "
+            "segments published from their own NUMA node")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
@@ -1360,6 +1420,9 @@ DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(parallel_weak_collection_clearing, true,
+            "remove dead entries from weak collections in parallel in the "
+            "atomic pause")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -1370,6 +1433,9 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_BOOL(trace_gc_live_bytes_by_type, false,
+            "print the bytes visited by the full GC marker per instance type "
+            "after each full GC")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -1383,6 +1449,9 @@ DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
     TracingFlags::zone_stats.store(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_SIZE_T(zone_segment_pool_size, 4 * MB,
+              "maximum size of freed zone segments kept for reuse by later "
+              "zones (0 to disable)")
 DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
 DEFINE_DEBUG_BOOL(trace_backing_store, false, "trace backing store events")
@@ -1420,7 +1489,13 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
+DEFINE_FLOAT(target_gc_cpu_fraction, 0.0,
+             "fraction of CPU time, in (0, 1), the heap growing controller "
+             "should budget for garbage collection (0 uses the default)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back the pointer compression cage with "
+            "transparent huge pages (Linux only)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1428,6 +1503,11 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_UINT(compaction_pause_budget_ms, 0,
+            "Time budget for evacuating old space compaction candidates in the "
+            "atomic pause, based on the traced compaction speed. Fragmented "
+            "pages that do not fit into the budget are compacted in later "
+            "GCs (0 uses a fixed quota)")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(
@@ -1444,6 +1524,9 @@ DEFINE_BOOL(flush_baseline_code, false,
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_INT(bytecode_old_age, 5, "number of gcs before we flush code")
+DEFINE_INT(bytecode_old_age_for_memory_reduction, 2,
+           "number of gcs before we flush code in gcs that reduce memory, "
+           "e.g. on memory pressure")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -1451,6 +1534,8 @@ DEFINE_BOOL(use_marking_progress_bar, true,
             "incremental marking is active.")
 DEFINE_BOOL(stress_per_context_marking_worklist, false,
             "Use per-context worklist for marking")
+DEFINE_BOOL(continuous_memory_attribution, false,
+            "attribute live bytes to native contexts during every full GC")
 DEFINE_BOOL(force_marking_deque_overflows, false,
             "force overflows of marking deque by reducing it's size "
             "to 64 words")
@@ -1770,6 +1855,12 @@ DEFINE_IMPLICATION(log_ic, log_code)
 DEFINE_GENERIC_IMPLICATION(
     log_ic, TracingFlags::ic_stats.store(
                 v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_BOOL(megamorphic_ic_stats, false,
+            "aggregate megamorphic IC transitions and stub cache misses per "
+            "IC site and print them on isolate teardown")
+DEFINE_INT(megamorphic_ic_stats_sampling_interval, 1,
+           "only record every n-th stub cache miss for "
+           "--megamorphic-ic-stats")
 DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
@@ -1863,6 +1954,8 @@ DEFINE_BOOL(adjust_os_scheduling_parameters, true,
             "adjust OS specific scheduling params for the isolate")
 DEFINE_BOOL(experimental_flush_embedded_blob_icache, true,
             "Used in an experiment to evaluate icache flushing on certain CPUs")
+DEFINE_BOOL(bigint_parallel_multiplication, false,
+            "use worker threads for multiplying (and dividing) huge BigInts")
 
 // Flags for short builtin calls feature
 #if V8_SHORT_BUILTIN_CALLS
@@ -1887,6 +1980,16 @@ DEFINE_IMPLICATION(rcs, runtime_call_stats)
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
+// Implies --runtime-call-stats for the reporting, and is defined after it so
+// that its generic implication below takes precedence.
+DEFINE_BOOL(rcs_sampling, false,
+            "count runtime calls without timing them, and attribute profiler "
+            "ticks (e.g. with --prof) to the active runtime call counter")
+DEFINE_IMPLICATION(rcs_sampling, runtime_call_stats)
+DEFINE_GENERIC_IMPLICATION(
+    rcs_sampling,
+    TracingFlags::runtime_stats.store(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
 
 // snapshot-common.cc
 DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
@@ -1912,6 +2015,9 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_INT(regexp_tier_up_backtracks, 100000,
+           "tier up to the compiler after a single execution in the regexp "
+           "interpreter needs at least this many backtracks (0 to disable)")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -2002,6 +2108,11 @@ DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
 DEFINE_IMPLICATION(minor_mc, separate_gc_phases)
+DEFINE_BOOL(sticky_young_generation, false,
+            "treat every object surviving a minor mark compact GC as old by "
+            "promoting its page in place (experimental)")
+DEFINE_IMPLICATION(sticky_young_generation, minor_mc)
+DEFINE_IMPLICATION(sticky_young_generation, page_promotion)
 
 DEFINE_BOOL(concurrent_minor_mc_marking, false,
             "perform young generation marking concurrently")
@@ -2079,6 +2190,11 @@ DEFINE_BOOL(trap_on_abort, false, "replace aborts by breakpoints")
 
 // compiler.cc
 DEFINE_BOOL(print_scopes, false, "print scopes")
+DEFINE_BOOL(function_compilation_stats, false,
+            "account compile time per function and tier and print the "
+            "functions with the highest compile time")
+DEFINE_INT(function_compilation_stats_count, 20,
+           "number of functions printed by --function-compilation-stats")
 
 // contexts.cc
 DEFINE_BOOL(trace_contexts, false, "trace contexts operations")
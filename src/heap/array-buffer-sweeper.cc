@@ -4,8 +4,10 @@
 
 #include "src/heap/array-buffer-sweeper.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
+#include <utility>
 
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
@@ -257,14 +259,30 @@ void ArrayBufferSweeper::IncrementExternalMemoryCounters(size_t bytes) {
   if (bytes == 0) return;
   heap_->IncrementExternalBackingStoreBytes(
       ExternalBackingStoreType::kArrayBuffer, bytes);
+  pending_external_memory_bytes_ += bytes;
+  if (pending_external_memory_bytes_ >= kExternalMemoryReportingBatchSize) {
+    ReportPendingExternalMemory();
+  }
+}
+
+void ArrayBufferSweeper::ReportPendingExternalMemory() {
+  if (pending_external_memory_bytes_ == 0) return;
+  const int64_t bytes =
+      static_cast<int64_t>(std::exchange(pending_external_memory_bytes_, 0));
   reinterpret_cast<v8::Isolate*>(heap_->isolate())
-      ->AdjustAmountOfExternalAllocatedMemory(static_cast<int64_t>(bytes));
+      ->AdjustAmountOfExternalAllocatedMemory(bytes);
 }
 
 void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
   if (bytes == 0) return;
   heap_->DecrementExternalBackingStoreBytes(
       ExternalBackingStoreType::kArrayBuffer, bytes);
+  // Bytes that are still pending were never reported, so cancel them out
+  // first to keep the external memory accounting symmetric.
+  const size_t unreported = std::min(bytes, pending_external_memory_bytes_);
+  pending_external_memory_bytes_ -= unreported;
+  bytes -= unreported;
+  if (bytes == 0) return;
   // Unlike IncrementExternalMemoryCounters we don't use
   // AdjustAmountOfExternalAllocatedMemory such that we never start a GC here.
   heap_->update_external_memory(-static_cast<int64_t>(bytes));
@@ -296,14 +314,14 @@ ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
     ArrayBufferList* list) {
   ArrayBufferExtension* current = list->head_;
   ArrayBufferList survivor_list;
+  size_t freed_bytes = 0;
 
   while (current) {
     ArrayBufferExtension* next = current->next();
 
     if (!current->IsMarked()) {
-      const size_t bytes = current->accounting_length();
+      freed_bytes += current->accounting_length();
       delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
     } else {
       current->Unmark();
       survivor_list.Append(current);
@@ -312,6 +330,10 @@ ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
     current = next;
   }
 
+  // Publish the freed bytes once per list instead of once per extension.
+  if (freed_bytes) {
+    freed_bytes_.fetch_add(freed_bytes, std::memory_order_relaxed);
+  }
   *list = ArrayBufferList();
   return survivor_list;
 }
@@ -322,14 +344,14 @@ void ArrayBufferSweeper::SweepingJob::SweepYoung() {
 
   ArrayBufferList new_young;
   ArrayBufferList new_old;
+  size_t freed_bytes = 0;
 
   while (current) {
     ArrayBufferExtension* next = current->next();
 
     if (!current->IsYoungMarked()) {
-      size_t bytes = current->accounting_length();
+      freed_bytes += current->accounting_length();
       delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
     } else if (current->IsYoungPromoted()) {
       current->YoungUnmark();
       new_old.Append(current);
@@ -341,6 +363,9 @@ void ArrayBufferSweeper::SweepingJob::SweepYoung() {
     current = next;
   }
 
+  if (freed_bytes) {
+    freed_bytes_.fetch_add(freed_bytes, std::memory_order_relaxed);
+  }
   old_ = new_old;
   young_ = new_young;
 }
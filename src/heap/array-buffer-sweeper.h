@@ -78,8 +78,12 @@ class ArrayBufferSweeper final {
   void FinishIfDone();
 
   // Increments external memory counters outside of ArrayBufferSweeper.
-  // Increment may trigger GC.
+  // Increment may trigger GC. Increments for small backing stores are batched
+  // and only reported to the embedder-visible external memory accounting once
+  // kExternalMemoryReportingBatchSize bytes are pending. Pending bytes are
+  // only reported from increments, as those are never called during GC.
   void IncrementExternalMemoryCounters(size_t bytes);
+  void ReportPendingExternalMemory();
   void DecrementExternalMemoryCounters(size_t bytes);
 
   void Prepare(SweepingType type);
@@ -87,12 +91,15 @@ class ArrayBufferSweeper final {
 
   void ReleaseAll(ArrayBufferList* extension);
 
+  static constexpr size_t kExternalMemoryReportingBatchSize = 64 * KB;
+
   Heap* const heap_;
   std::unique_ptr<SweepingJob> job_;
   base::Mutex sweeping_mutex_;
   base::ConditionVariable job_finished_;
   ArrayBufferList young_;
   ArrayBufferList old_;
+  size_t pending_external_memory_bytes_ = 0;
 };
 
 }  // namespace internal
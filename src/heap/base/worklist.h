@@ -53,6 +53,14 @@ class Worklist final {
 
   static constexpr int kMinSegmentSizeForTesting = MinSegmentSize;
 
+  // Segments are tagged with the locality (e.g. the NUMA node) of the local
+  // view that published them. Local views with a locality prefer stealing
+  // segments with the same tag.
+  static constexpr int kNoLocality = -1;
+  // Number of published segments that are inspected for a matching locality
+  // before falling back to the top-most segment.
+  static constexpr size_t kMaxLocalityProbes = 4;
+
   Worklist() = default;
   ~Worklist() { CHECK(IsEmpty()); }
 
@@ -85,7 +93,7 @@ class Worklist final {
 
  private:
   void Push(Segment* segment);
-  bool Pop(Segment** segment);
+  bool Pop(Segment** segment, int preferred_locality = kNoLocality);
 
   mutable v8::base::Mutex lock_;
   Segment* top_ = nullptr;
@@ -102,11 +110,26 @@ void Worklist<EntryType, MinSegmentSize>::Push(Segment* segment) {
 }
 
 template <typename EntryType, uint16_t MinSegmentSize>
-bool Worklist<EntryType, MinSegmentSize>::Pop(Segment** segment) {
+bool Worklist<EntryType, MinSegmentSize>::Pop(Segment** segment,
+                                              int preferred_locality) {
   v8::base::MutexGuard guard(&lock_);
   if (top_ == nullptr) return false;
   DCHECK_LT(0U, size_);
   size_.fetch_sub(1, std::memory_order_relaxed);
+  if (preferred_locality != kNoLocality &&
+      top_->locality() != preferred_locality) {
+    Segment* prev = top_;
+    Segment* current = top_->next();
+    for (size_t i = 1; current != nullptr && i < kMaxLocalityProbes; i++) {
+      if (current->locality() == preferred_locality) {
+        prev->set_next(current->next());
+        *segment = current;
+        return true;
+      }
+      prev = current;
+      current = current->next();
+    }
+  }
   *segment = top_;
   top_ = top_->next();
   return true;
@@ -225,6 +248,9 @@ class Worklist<EntryType, MinSegmentSize>::Segment final
   Segment* next() const { return next_; }
   void set_next(Segment* segment) { next_ = segment; }
 
+  int locality() const { return locality_; }
+  void set_locality(int locality) { locality_ = locality; }
+
  private:
   static constexpr size_t MallocSizeForCapacity(size_t num_entries) {
     return sizeof(Segment) + sizeof(EntryType) * num_entries;
@@ -244,6 +270,7 @@ class Worklist<EntryType, MinSegmentSize>::Segment final
   }
 
   Segment* next_ = nullptr;
+  int locality_ = kNoLocality;
 };
 
 template <typename EntryType, uint16_t MinSegmentSize>
@@ -306,6 +333,10 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
 
   size_t PushSegmentSize() const { return push_segment_->Size(); }
 
+  // Sets the locality that published segments are tagged with and that is
+  // preferred when stealing segments from the global worklist.
+  void SetLocality(int locality) { locality_ = locality; }
+
   void Publish();
 
   void Merge(Worklist<EntryType, MinSegmentSize>::Local& other);
@@ -349,6 +380,7 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
   Worklist<EntryType, MinSegmentSize>& worklist_;
   internal::SegmentBase* push_segment_ = nullptr;
   internal::SegmentBase* pop_segment_ = nullptr;
+  int locality_ = kNoLocality;
 };
 
 template <typename EntryType, uint16_t MinSegmentSize>
@@ -417,15 +449,19 @@ void Worklist<EntryType, MinSegmentSize>::Local::Merge(
 
 template <typename EntryType, uint16_t MinSegmentSize>
 void Worklist<EntryType, MinSegmentSize>::Local::PublishPushSegment() {
-  if (push_segment_ != internal::SegmentBase::GetSentinelSegmentAddress())
+  if (push_segment_ != internal::SegmentBase::GetSentinelSegmentAddress()) {
+    push_segment()->set_locality(locality_);
     worklist_.Push(push_segment());
+  }
   push_segment_ = NewSegment();
 }
 
 template <typename EntryType, uint16_t MinSegmentSize>
 void Worklist<EntryType, MinSegmentSize>::Local::PublishPopSegment() {
-  if (pop_segment_ != internal::SegmentBase::GetSentinelSegmentAddress())
+  if (pop_segment_ != internal::SegmentBase::GetSentinelSegmentAddress()) {
+    pop_segment()->set_locality(locality_);
     worklist_.Push(pop_segment());
+  }
   pop_segment_ = NewSegment();
 }
 
@@ -433,7 +469,7 @@ template <typename EntryType, uint16_t MinSegmentSize>
 bool Worklist<EntryType, MinSegmentSize>::Local::StealPopSegment() {
   if (worklist_.IsEmpty()) return false;
   Segment* new_segment = nullptr;
-  if (worklist_.Pop(&new_segment)) {
+  if (worklist_.Pop(&new_segment, locality_)) {
     DeleteSegment(pop_segment_);
     pop_segment_ = new_segment;
     return true;
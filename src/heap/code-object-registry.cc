@@ -4,25 +4,36 @@
 
 #include "src/heap/code-object-registry.h"
 
-#include <algorithm>
+#include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/logging.h"
 
 namespace v8 {
 namespace internal {
 
-void CodeObjectRegistry::RegisterNewlyAllocatedCodeObject(Address code) {
-  base::RecursiveMutexGuard guard(&code_object_registry_mutex_);
-  if (is_sorted_) {
-    is_sorted_ =
-        (code_object_registry_.empty() || code_object_registry_.back() < code);
+CodeObjectRegistry::CodeObjectRegistry(Address chunk_start)
+    : chunk_start_(chunk_start) {
+  DCHECK(IsAligned(chunk_start, size_t{1} << kPageSizeBits));
+  for (std::atomic<Cell>& cell : cells_) {
+    cell.store(0, std::memory_order_relaxed);
   }
-  code_object_registry_.push_back(code);
 }
 
-void CodeObjectRegistry::ReinitializeFrom(std::vector<Address>&& code_objects) {
-  base::RecursiveMutexGuard guard(&code_object_registry_mutex_);
+int CodeObjectRegistry::BitIndex(Address address) const {
+  DCHECK_LE(chunk_start_, address);
+  DCHECK_LT(address - chunk_start_, size_t{1} << kPageSizeBits);
+  return static_cast<int>((address - chunk_start_) >> kCodeAlignmentBits);
+}
+
+void CodeObjectRegistry::RegisterNewlyAllocatedCodeObject(Address code) {
+  DCHECK(IsAligned(code, kCodeAlignment));
+  int index = BitIndex(code);
+  cells_[index / kBitsPerCell].fetch_or(Cell{1} << (index % kBitsPerCell),
+                                        std::memory_order_relaxed);
+}
 
+void CodeObjectRegistry::ReinitializeFrom(std::vector<Address>&& code_objects) {
 #if DEBUG
   Address last_start = kNullAddress;
   for (Address object_start : code_objects) {
@@ -31,40 +42,44 @@ void CodeObjectRegistry::ReinitializeFrom(std::vector<Address>&& code_objects) {
   }
 #endif  // DEBUG
 
-  is_sorted_ = true;
-  code_object_registry_ = std::move(code_objects);
+  // Build the new bitmap first and then store it cell by cell, so that
+  // concurrent lookups never observe a cell with live starts missing.
+  auto cells = std::make_unique<Cell[]>(kCellCount);
+  for (Address code : code_objects) {
+    DCHECK(IsAligned(code, kCodeAlignment));
+    int index = BitIndex(code);
+    cells[index / kBitsPerCell] |= Cell{1} << (index % kBitsPerCell);
+  }
+  for (int i = 0; i < kCellCount; i++) {
+    cells_[i].store(cells[i], std::memory_order_relaxed);
+  }
 }
 
 bool CodeObjectRegistry::Contains(Address object) const {
-  base::RecursiveMutexGuard guard(&code_object_registry_mutex_);
-  if (!is_sorted_) {
-    std::sort(code_object_registry_.begin(), code_object_registry_.end());
-    is_sorted_ = true;
-  }
-  return (std::binary_search(code_object_registry_.begin(),
-                             code_object_registry_.end(), object));
+  if (!IsAligned(object, kCodeAlignment)) return false;
+  int index = BitIndex(object);
+  return cells_[index / kBitsPerCell].load(std::memory_order_relaxed) &
+         (Cell{1} << (index % kBitsPerCell));
 }
 
 Address CodeObjectRegistry::GetCodeObjectStartFromInnerAddress(
     Address address) const {
-  base::RecursiveMutexGuard guard(&code_object_registry_mutex_);
-  if (!is_sorted_) {
-    std::sort(code_object_registry_.begin(), code_object_registry_.end());
-    is_sorted_ = true;
+  int index = BitIndex(address);
+  int cell_index = index / kBitsPerCell;
+  // Keep the bits up to and including the one for {address}.
+  int shift = kBitsPerCell - 1 - index % kBitsPerCell;
+  Cell cell = (cells_[cell_index].load(std::memory_order_relaxed) << shift) >>
+              shift;
+  while (cell == 0) {
+    // The address has to be contained in a code object, so there is a start
+    // at or before it.
+    DCHECK_GT(cell_index, 0);
+    cell = cells_[--cell_index].load(std::memory_order_relaxed);
   }
-
-  // The code registry can't be empty, else the code object can't exist.
-  DCHECK(!code_object_registry_.empty());
-
-  // std::upper_bound returns the first code object strictly greater than
-  // address, so the code object containing the address has to be the previous
-  // one.
-  auto it = std::upper_bound(code_object_registry_.begin(),
-                             code_object_registry_.end(), address);
-  // The address has to be contained in a code object, so necessarily the
-  // address can't be smaller than the first code object.
-  DCHECK_NE(it, code_object_registry_.begin());
-  return *(--it);
+  int bit = kBitsPerCell - 1 - base::bits::CountLeadingZeros(cell);
+  return chunk_start_ +
+         ((static_cast<Address>(cell_index) * kBitsPerCell + bit)
+          << kCodeAlignmentBits);
 }
 
 }  // namespace internal
@@ -5,10 +5,10 @@
 #ifndef V8_HEAP_CODE_OBJECT_REGISTRY_H_
 #define V8_HEAP_CODE_OBJECT_REGISTRY_H_
 
+#include <atomic>
 #include <vector>
 
 #include "src/base/macros.h"
-#include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 
 namespace v8 {
@@ -18,23 +18,36 @@ namespace internal {
 // MemoryChunk. Each MemoryChunk owns a separate CodeObjectRegistry. The
 // CodeObjectRegistry allows fast lookup from an inner pointer of a code object
 // to the actual code object.
+//
+// Start addresses are recorded in a bitmap with one bit per kCodeAlignment
+// bytes of the page, so lookups scan backwards over at most the size of the
+// code object containing the address. Cells are accessed atomically, so no
+// lock is needed: registering may race with stack walks from the profiler,
+// and ReinitializeFrom only ever drops the starts of dead objects, which
+// can't lie between a live object's start and an inner pointer into it.
 class V8_EXPORT_PRIVATE CodeObjectRegistry {
  public:
+  explicit CodeObjectRegistry(Address chunk_start);
+  CodeObjectRegistry(const CodeObjectRegistry&) = delete;
+  CodeObjectRegistry& operator=(const CodeObjectRegistry&) = delete;
+
   void RegisterNewlyAllocatedCodeObject(Address code);
+  // Replaces the registered code objects with the given sorted addresses.
   void ReinitializeFrom(std::vector<Address>&& code_objects);
   bool Contains(Address code) const;
   Address GetCodeObjectStartFromInnerAddress(Address address) const;
 
  private:
-  // A vector of addresses, which may be sorted. This is set to 'mutable' so
-  // that it can be lazily sorted during GetCodeObjectStartFromInnerAddress.
-  mutable std::vector<Address> code_object_registry_;
-  mutable bool is_sorted_ = true;
-  // The mutex has to be recursive because profiler tick might happen while
-  // holding this lock, then the profiler will try to iterate the call stack
-  // which might end up calling GetCodeObjectStartFromInnerAddress() and thus
-  // trying to lock the mutex for a second time.
-  mutable base::RecursiveMutex code_object_registry_mutex_;
+  using Cell = uintptr_t;
+  static constexpr int kBitsPerCell = sizeof(Cell) * kBitsPerByte;
+  static constexpr int kCellCount =
+      static_cast<int>((size_t{1} << kPageSizeBits) / kCodeAlignment /
+                       kBitsPerCell);
+
+  inline int BitIndex(Address address) const;
+
+  const Address chunk_start_;
+  std::atomic<Cell> cells_[kCellCount];
 };
 
 }  // namespace internal
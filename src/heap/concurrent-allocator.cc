@@ -151,9 +151,16 @@ AllocationResult ConcurrentAllocator::AllocateInLabSlow(
 }
 
 bool ConcurrentAllocator::AllocateLab(AllocationOrigin origin) {
-  auto result = AllocateFromSpaceFreeList(kMinLabSize, kMaxLabSize, origin);
+  auto result = AllocateFromSpaceFreeList(kMinLabSize, max_lab_size_, origin);
   if (!result) return false;
 
+  // Objects that do not fit into the current LAB are at most
+  // kMaxLabObjectSize large, so the memory wasted when retiring a LAB does not
+  // grow with the LAB size.
+  const size_t max_lab_size_limit = std::max<size_t>(
+      kMaxLabSize, v8_flags.concurrent_allocator_max_lab_size_kb * KB);
+  max_lab_size_ = std::min(2 * max_lab_size_, max_lab_size_limit);
+
   owning_heap()->StartIncrementalMarkingIfAllocationLimitIsReachedBackground();
 
   FreeLinearAllocationArea();
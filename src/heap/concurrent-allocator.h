@@ -96,6 +96,10 @@ class ConcurrentAllocator {
   PagedSpace* const space_;
   Heap* const owning_heap_;
   LinearAllocationArea lab_;
+  // Upper bound for the size of the next LAB. Starts at kMaxLabSize and grows
+  // with every refill up to --concurrent-allocator-max-lab-size-kb, such that
+  // threads that allocate a lot acquire the space mutex less often.
+  size_t max_lab_size_ = kMaxLabSize;
 };
 
 }  // namespace internal
@@ -738,6 +738,9 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       marking_worklists_, cpp_heap
                               ? cpp_heap->CreateCppMarkingState()
                               : MarkingWorklists::Local::kNoCppMarkingState);
+  if (v8_flags.numa_aware_marking) {
+    local_marking_worklists.SetLocality(base::OS::GetCurrentNumaNode());
+  }
   WeakObjects::Local local_weak_objects(weak_objects_);
   ConcurrentMarkingVisitor visitor(
       task_id, &local_marking_worklists, &local_weak_objects, heap_,
@@ -747,6 +750,8 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
   NativeContextInferrer& native_context_inferrer =
       task_state->native_context_inferrer;
   NativeContextStats& native_context_stats = task_state->native_context_stats;
+  InstanceTypeStats& instance_type_stats = task_state->instance_type_stats;
+  const bool track_instance_types = v8_flags.trace_gc_live_bytes_by_type;
   double time_ms;
   size_t marked_bytes = 0;
   Isolate* isolate = heap_->isolate();
@@ -815,6 +820,9 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
             native_context_stats.IncrementSize(
                 local_marking_worklists.Context(), map, object, visited_size);
           }
+          if (track_instance_types) {
+            instance_type_stats.IncrementSize(map, visited_size);
+          }
           current_marked_bytes += visited_size;
         }
       }
@@ -862,6 +870,9 @@ void ConcurrentMarking::RunMinor(JobDelegate* delegate) {
   TaskState* task_state = task_state_[task_id].get();
   MarkingWorklists::Local local_marking_worklists(
       marking_worklists_, MarkingWorklists::Local::kNoCppMarkingState);
+  if (v8_flags.numa_aware_marking) {
+    local_marking_worklists.SetLocality(base::OS::GetCurrentNumaNode());
+  }
   YoungGenerationConcurrentMarkingVisitor visitor(
       heap_, &local_marking_worklists, &task_state->memory_chunk_data);
   double time_ms;
@@ -1035,6 +1046,14 @@ void ConcurrentMarking::FlushNativeContexts(NativeContextStats* main_stats) {
   }
 }
 
+void ConcurrentMarking::FlushInstanceTypeStats(InstanceTypeStats* main_stats) {
+  DCHECK(!job_handle_ || !job_handle_->IsValid());
+  for (size_t i = 1; i < task_state_.size(); i++) {
+    main_stats->Merge(task_state_[i]->instance_type_stats);
+    task_state_[i]->instance_type_stats.Clear();
+  }
+}
+
 void ConcurrentMarking::FlushMemoryChunkData(
     NonAtomicMarkingState* marking_state) {
   DCHECK(!job_handle_ || !job_handle_->IsValid());
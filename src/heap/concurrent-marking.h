@@ -77,6 +77,8 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
       TaskPriority priority = TaskPriority::kUserVisible);
   // Flushes native context sizes to the given table of the main thread.
   void FlushNativeContexts(NativeContextStats* main_stats);
+  // Flushes instance type sizes to the given table of the main thread.
+  void FlushInstanceTypeStats(InstanceTypeStats* main_stats);
   // Flushes memory chunk data using the given marking state.
   void FlushMemoryChunkData(NonAtomicMarkingState* marking_state);
   // This function is called for a new space page that was cleared after
@@ -104,6 +106,7 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
     MemoryChunkDataMap memory_chunk_data;
     NativeContextInferrer native_context_inferrer;
     NativeContextStats native_context_stats;
+    InstanceTypeStats instance_type_stats;
     char cache_line_padding[64];
   };
   class JobTaskMinor;
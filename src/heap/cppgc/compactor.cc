@@ -27,6 +27,11 @@ namespace {
 // Freelist size threshold that must be exceeded before compaction
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
+// Per-space freelist size threshold that must be exceeded for a space to be
+// compacted once compaction has been triggered. Spaces below the threshold are
+// swept instead, which keeps the atomic pause proportional to the amount of
+// fragmentation that is actually removed.
+static constexpr size_t kSpaceFreeListSizeThreshold = 64 * kKB;
 
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
@@ -515,9 +520,14 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   const bool young_gen_enabled = heap_.heap()->generational_gc_supported();
 
   for (NormalPageSpace* space : compactable_spaces_) {
+    if (!enable_for_next_gc_for_testing_ &&
+        space->free_list().Size() <= kSpaceFreeListSizeThreshold) {
+      continue;
+    }
     CompactSpace(
         space, movable_references,
         young_gen_enabled ? StickyBits::kEnabled : StickyBits::kDisabled);
+    space->set_was_compacted(true);
   }
 
   enable_for_next_gc_for_testing_ = false;
@@ -45,11 +45,15 @@ class HeapGrowing::HeapGrowingImpl final
 
   size_t limit_for_atomic_gc() const { return limit_for_atomic_gc_; }
   size_t limit_for_incremental_gc() const { return limit_for_incremental_gc_; }
+  size_t limit_for_minor_gc() const { return limit_for_minor_gc_; }
+
+  void EnableMinorGCScheduling() { minor_gc_scheduling_enabled_ = true; }
 
   void DisableForTesting();
 
  private:
   void ConfigureLimit(size_t allocated_object_size);
+  void ConfigureMinorGCLimit(size_t allocated_object_size);
 
   GarbageCollector* collector_;
   StatsCollector* stats_collector_;
@@ -57,10 +61,13 @@ class HeapGrowing::HeapGrowingImpl final
   size_t initial_heap_size_ = 1 * kMB;
   size_t limit_for_atomic_gc_ = 0;       // See ConfigureLimit().
   size_t limit_for_incremental_gc_ = 0;  // See ConfigureLimit().
+  size_t limit_for_minor_gc_ = 0;        // See ConfigureMinorGCLimit().
 
   SingleThreadedHandle gc_task_handle_;
 
   bool disabled_for_testing_ = false;
+  bool minor_gc_scheduling_enabled_ = false;
+  bool minor_gc_in_progress_ = false;
 
   const cppgc::Heap::MarkingType marking_support_;
   const cppgc::Heap::SweepingType sweeping_support_;
@@ -100,14 +107,35 @@ void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
     collector_->StartIncrementalGarbageCollection(
         {CollectionType::kMajor, StackState::kMayContainHeapPointers,
          marking_support_, sweeping_support_});
+  } else if (minor_gc_scheduling_enabled_ &&
+             allocated_object_size > limit_for_minor_gc_ &&
+             !stats_collector_->IsMarking()) {
+    // Minor GCs are atomic and reclaim short-lived objects without marking
+    // the old generation.
+    minor_gc_in_progress_ = true;
+    collector_->CollectGarbage(
+        {CollectionType::kMinor, StackState::kMayContainHeapPointers,
+         GCConfig::MarkingType::kAtomic, sweeping_support_});
+    minor_gc_in_progress_ = false;
   }
 }
 
 void HeapGrowing::HeapGrowingImpl::ResetAllocatedObjectSize(
     size_t allocated_object_size) {
+  // A minor GC only reclaims young objects. Keep the major GC limits so that
+  // the old generation is still collected once it has grown enough.
+  if (minor_gc_in_progress_) {
+    ConfigureMinorGCLimit(allocated_object_size);
+    return;
+  }
   ConfigureLimit(allocated_object_size);
 }
 
+void HeapGrowing::HeapGrowingImpl::ConfigureMinorGCLimit(
+    size_t allocated_object_size) {
+  limit_for_minor_gc_ = allocated_object_size + kMinorGCAllocationLimit;
+}
+
 void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
     size_t allocated_object_size) {
   const size_t size = std::max(allocated_object_size, initial_heap_size_);
@@ -136,6 +164,7 @@ void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
       std::max(minimum_limit_incremental_gc,
                std::min(maximum_limit_incremental_gc,
                         limit_incremental_gc_based_on_allocation_rate));
+  ConfigureMinorGCLimit(allocated_object_size);
 }
 
 void HeapGrowing::HeapGrowingImpl::DisableForTesting() {
@@ -159,6 +188,13 @@ size_t HeapGrowing::limit_for_atomic_gc() const {
 size_t HeapGrowing::limit_for_incremental_gc() const {
   return impl_->limit_for_incremental_gc();
 }
+size_t HeapGrowing::limit_for_minor_gc() const {
+  return impl_->limit_for_minor_gc();
+}
+
+void HeapGrowing::EnableMinorGCScheduling() {
+  impl_->EnableMinorGCScheduling();
+}
 
 void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
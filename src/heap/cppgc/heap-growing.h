@@ -32,6 +32,9 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
   // before triggering GC again.
   static constexpr size_t kMinLimitIncrease =
       kPageSize * RawHeap::kNumberOfRegularSpaces;
+  // Bytes that may be allocated after a GC before a minor GC is triggered,
+  // if generational GC is enabled.
+  static constexpr size_t kMinorGCAllocationLimit = 4 * kMinLimitIncrease;
 
   HeapGrowing(GarbageCollector*, StatsCollector*,
               cppgc::Heap::ResourceConstraints, cppgc::Heap::MarkingType,
@@ -43,6 +46,10 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
 
   size_t limit_for_atomic_gc() const;
   size_t limit_for_incremental_gc() const;
+  size_t limit_for_minor_gc() const;
+
+  // Starts triggering minor GCs once the heap supports generational GC.
+  void EnableMinorGCScheduling();
 
   void DisableForTesting();
 
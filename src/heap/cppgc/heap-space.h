@@ -108,9 +108,16 @@ class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
   FreeList& free_list() { return free_list_; }
   const FreeList& free_list() const { return free_list_; }
 
+  // Set by the Compactor for compactable spaces that were compacted in the
+  // current GC cycle. The sweeper skips such spaces and resets the bit on
+  // every cycle.
+  bool was_compacted() const { return was_compacted_; }
+  void set_was_compacted(bool value) { was_compacted_ = value; }
+
  private:
   LinearAllocationBuffer current_lab_;
   FreeList free_list_;
+  bool was_compacted_ = false;
 };
 
 class V8_EXPORT_PRIVATE LargePageSpace final : public BaseSpace {
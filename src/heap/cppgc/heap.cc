@@ -176,6 +176,7 @@ void Heap::FinalizeGarbageCollection(StackState stack_state) {
   // for old objects are registered in the remembered set.
   if (generational_gc_enabled_) {
     HeapBase::EnableGenerationalGC();
+    growing_.EnableMinorGCScheduling();
   }
 #endif  // defined(CPPGC_YOUNG_GENERATION)
   {
@@ -36,6 +36,11 @@ class StatsCollector;
 class PageBackend;
 class GarbageCollector;
 
+// Allocates objects on the normal and large page spaces of a RawHeap. Objects
+// are segregated by size into the regular normal page spaces, each of which
+// owns a single linear allocation buffer and free list. None of this state is
+// synchronized: the allocator must only be used from the thread that owns the
+// heap.
 class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
  public:
   static constexpr size_t kSmallestSpaceSize = 32;
@@ -258,6 +258,13 @@ MetricRecorder::GCCycle GetCycleEventForMetricRecorder(
 
 }  // namespace
 
+void StatsCollector::NotifyFinalizationBatch(size_t finalized_objects) {
+  DCHECK_EQ(GarbageCollectionState::kSweeping, gc_state_);
+  current_.finalized_objects += finalized_objects;
+  current_.max_finalization_batch_size =
+      std::max(current_.max_finalization_batch_size, finalized_objects);
+}
+
 void StatsCollector::NotifySweepingCompleted(SweepingType sweeping_type) {
   DCHECK_EQ(GarbageCollectionState::kSweeping, gc_state_);
   gc_state_ = GarbageCollectionState::kNotRunning;
@@ -117,6 +117,10 @@ class V8_EXPORT_PRIVATE StatsCollector final {
     size_t marked_bytes = 0;
     size_t object_size_before_sweep_bytes = -1;
     size_t memory_size_before_sweep_bytes = -1;
+    // Finalizers of objects on concurrently swept pages are run in batches on
+    // the mutator thread, one batch per page.
+    size_t finalized_objects = 0;
+    size_t max_finalization_batch_size = 0;
   };
 
  private:
@@ -286,6 +290,9 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // Indicates the end of a garbage collection cycle. This means that sweeping
   // is finished at this point.
   void NotifySweepingCompleted(SweepingType);
+  // Indicates that a batch of finalizers collected by concurrent sweeping was
+  // run on the mutator thread.
+  void NotifyFinalizationBatch(size_t finalized_objects);
 
   size_t allocated_memory_size() const;
   // Size of live objects in bytes  on the heap. Based on the most recent marked
@@ -307,6 +314,13 @@ class V8_EXPORT_PRIVATE StatsCollector final {
 
   double GetRecentAllocationSpeedInBytesPerMs() const;
 
+  // Returns whether a garbage collection cycle is currently in its unmarking
+  // or marking phase.
+  bool IsMarking() const {
+    return gc_state_ == GarbageCollectionState::kUnmarking ||
+           gc_state_ == GarbageCollectionState::kMarking;
+  }
+
   const Event& GetPreviousEventForTesting() const { return previous_; }
 
   void NotifyAllocatedMemory(int64_t);
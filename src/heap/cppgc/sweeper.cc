@@ -448,11 +448,14 @@ class SweepFinalizer final {
     BasePage* page = page_state->page;
 
     // Call finalizers.
-    const auto finalize_header = [](HeapObjectHeader* header) {
-      const size_t size = header->AllocatedSize();
-      header->Finalize();
-      SetMemoryInaccessible(header, size);
-    };
+    size_t finalized_objects = 0;
+    const auto finalize_header =
+        [&finalized_objects](HeapObjectHeader* header) {
+          const size_t size = header->AllocatedSize();
+          header->Finalize();
+          SetMemoryInaccessible(header, size);
+          ++finalized_objects;
+        };
 #if defined(CPPGC_CAGED_HEAP)
     const uint64_t cage_base = CagedHeapBase::GetBase();
     HeapObjectHeader* next_unfinalized = nullptr;
@@ -468,6 +471,10 @@ class SweepFinalizer final {
       finalize_header(unfinalized_header);
     }
 #endif  // !defined(CPPGC_CAGED_HEAP)
+    if (finalized_objects) {
+      page->heap().stats_collector()->NotifyFinalizationBatch(
+          finalized_objects);
+    }
 
     // Unmap page if empty.
     if (page_state->is_empty) {
@@ -730,9 +737,13 @@ class PrepareForSweepVisitor final
 
  protected:
   bool VisitNormalPageSpace(NormalPageSpace& space) {
+    const bool was_compacted = space.was_compacted();
+    space.set_was_compacted(false);
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
-        space.is_compactable())
+        was_compacted) {
+      DCHECK(space.is_compactable());
       return true;
+    }
     DCHECK(!space.linear_allocation_buffer().size());
     space.free_list().Clear();
 #ifdef V8_USE_ADDRESS_SANITIZER
@@ -1260,6 +1260,7 @@ Handle<NativeContext> Factory::NewNativeContext() {
   context.set_previous(Context());
   context.set_extension(*undefined_value());
   context.set_errors_thrown(Smi::zero());
+  context.set_live_kb_at_last_gc(Smi::zero());
   context.set_math_random_index(Smi::zero());
   context.set_serialized_objects(*empty_fixed_array());
   context.init_microtask_queue(isolate(), nullptr);
@@ -4001,6 +4002,7 @@ Handle<JSAtomicsMutex> Factory::NewJSAtomicsMutex() {
       NewJSObjectFromMap(map, AllocationType::kSharedOld));
   mutex->set_state(JSAtomicsMutex::kUnlocked);
   mutex->set_owner_thread_id(ThreadId::Invalid().ToInteger());
+  mutex->set_spin_count_estimate(0);
   return mutex;
 }
 
@@ -11,10 +11,14 @@ namespace v8 {
 namespace internal {
 
 const double GCIdleTimeHandler::kConservativeTimeRatio = 0.9;
+const double GCIdleTimeHandler::kScavengeNewSpaceFullnessRatio = 0.5;
 
 void GCIdleTimeHeapState::Print() {
   PrintF("size_of_objects=%zu ", size_of_objects);
   PrintF("incremental_marking_stopped=%d ", incremental_marking_stopped);
+  PrintF("new_space_size=%zu ", new_space_size);
+  PrintF("new_space_capacity=%zu ", new_space_capacity);
+  PrintF("scavenge_speed=%.f ", scavenge_speed_in_bytes_per_ms);
 }
 
 size_t GCIdleTimeHandler::EstimateMarkingStepSize(
@@ -32,13 +36,29 @@ size_t GCIdleTimeHandler::EstimateMarkingStepSize(
   return static_cast<size_t>(marking_step_size * kConservativeTimeRatio);
 }
 
+bool GCIdleTimeHandler::ShouldDoScavenge(
+    double idle_time_in_ms, size_t new_space_size, size_t new_space_capacity,
+    double scavenge_speed_in_bytes_per_ms) {
+  if (new_space_size == 0 ||
+      new_space_size < new_space_capacity * kScavengeNewSpaceFullnessRatio) {
+    return false;
+  }
+  if (scavenge_speed_in_bytes_per_ms == 0) {
+    scavenge_speed_in_bytes_per_ms = kInitialConservativeScavengeSpeed;
+  }
+  const double estimated_scavenge_time_in_ms =
+      new_space_size / scavenge_speed_in_bytes_per_ms;
+  return estimated_scavenge_time_in_ms <=
+         idle_time_in_ms * kConservativeTimeRatio;
+}
+
 // The following logic is implemented by the controller:
-// (1) If we don't have any idle time, do nothing, unless a context was
-// disposed, incremental marking is stopped, and the heap is small. Then do
-// a full GC.
-// (2) If the context disposal rate is high and we cannot perform a full GC,
-// we do nothing until the context disposal rate becomes lower.
-// (3) If incremental marking is in progress, we perform a marking step.
+// (1) If we don't have any idle time, do nothing.
+// (2) If incremental marking is in progress, we perform a marking step.
+// (3) With --idle-time-scavenge, if new space is at least
+// kScavengeNewSpaceFullnessRatio full and the estimated scavenge time fits
+// into the idle time, we perform a scavenge.
+// (4) Otherwise, do nothing.
 GCIdleTimeAction GCIdleTimeHandler::Compute(double idle_time_in_ms,
                                             GCIdleTimeHeapState heap_state) {
   if (static_cast<int>(idle_time_in_ms) <= 0) {
@@ -49,10 +69,19 @@ GCIdleTimeAction GCIdleTimeHandler::Compute(double idle_time_in_ms,
     return GCIdleTimeAction::kIncrementalStep;
   }
 
+  if (v8_flags.idle_time_scavenge &&
+      ShouldDoScavenge(idle_time_in_ms, heap_state.new_space_size,
+                       heap_state.new_space_capacity,
+                       heap_state.scavenge_speed_in_bytes_per_ms)) {
+    return GCIdleTimeAction::kScavenge;
+  }
+
   return GCIdleTimeAction::kDone;
 }
 
-bool GCIdleTimeHandler::Enabled() { return v8_flags.incremental_marking; }
+bool GCIdleTimeHandler::Enabled() {
+  return v8_flags.incremental_marking || v8_flags.idle_time_scavenge;
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -13,6 +13,7 @@ namespace internal {
 enum class GCIdleTimeAction : uint8_t {
   kDone,
   kIncrementalStep,
+  kScavenge,
 };
 
 class GCIdleTimeHeapState {
@@ -21,6 +22,9 @@ class GCIdleTimeHeapState {
 
   size_t size_of_objects;
   bool incremental_marking_stopped;
+  size_t new_space_size = 0;
+  size_t new_space_capacity = 0;
+  double scavenge_speed_in_bytes_per_ms = 0;
 };
 
 
@@ -35,6 +39,15 @@ class V8_EXPORT_PRIVATE GCIdleTimeHandler {
   // Maximum marking step size returned by EstimateMarkingStepSize.
   static const size_t kMaximumMarkingStepSize = 700 * MB;
 
+  // If we haven't recorded any scavenger events yet, we use a conservative
+  // lower bound for the scavenger speed.
+  static const size_t kInitialConservativeScavengeSpeed = 100 * KB;
+
+  // An idle time scavenge is only worth it once the new space is at least
+  // this full; otherwise the next allocation-triggered scavenge would do
+  // hardly more work.
+  static const double kScavengeNewSpaceFullnessRatio;
+
   // We have to make sure that we finish the IdleNotification before
   // idle_time_in_ms. Hence, we conservatively prune our workload estimate.
   static const double kConservativeTimeRatio;
@@ -57,6 +70,10 @@ class V8_EXPORT_PRIVATE GCIdleTimeHandler {
 
   static double EstimateFinalIncrementalMarkCompactTime(
       size_t size_of_objects, double mark_compact_speed_in_bytes_per_ms);
+
+  static bool ShouldDoScavenge(double idle_time_in_ms, size_t new_space_size,
+                               size_t new_space_capacity,
+                               double scavenge_speed_in_bytes_per_ms);
 };
 
 }  // namespace internal
@@ -1500,6 +1500,21 @@ void CopySizeMetrics(
   metrics.bytes_freed = cppgc_metrics.freed_bytes;
 }
 
+::v8::metrics::GarbageCollectionDetailedPhases DetailedPhasesFromScopes(
+    double roots_ms, double weak_ms, double evacuate_ms,
+    double update_pointers_ms, double sweep_ms) {
+  auto to_us = [](double ms) {
+    return static_cast<int64_t>(ms * base::Time::kMicrosecondsPerMillisecond);
+  };
+  ::v8::metrics::GarbageCollectionDetailedPhases phases;
+  phases.roots_wall_clock_duration_in_us = to_us(roots_ms);
+  phases.weak_wall_clock_duration_in_us = to_us(weak_ms);
+  phases.evacuate_wall_clock_duration_in_us = to_us(evacuate_ms);
+  phases.update_pointers_wall_clock_duration_in_us = to_us(update_pointers_ms);
+  phases.sweep_wall_clock_duration_in_us = to_us(sweep_ms);
+  return phases;
+}
+
 ::v8::metrics::Recorder::ContextId GetContextId(
     v8::internal::Isolate* isolate) {
   DCHECK_NOT_NULL(isolate);
@@ -1661,6 +1676,12 @@ void GCTracer::ReportFullCycleToRecorder() {
   event.main_thread_incremental.sweep_wall_clock_duration_in_us =
       static_cast<int64_t>(incremental_sweeping *
                            base::Time::kMicrosecondsPerMillisecond);
+  // Detailed atomic pause phases:
+  event.main_thread_atomic_detailed = DetailedPhasesFromScopes(
+      current_.scopes[Scope::MC_MARK_ROOTS], current_.scopes[Scope::MC_CLEAR],
+      current_.scopes[Scope::MC_EVACUATE_COPY],
+      current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS],
+      current_.scopes[Scope::MC_SWEEP]);
 
   // TODO(chromium:1154636): Populate the following:
   // - event.objects
@@ -1780,6 +1801,17 @@ void GCTracer::ReportYoungCycleToRecorder() {
       base::Time::kMicrosecondsPerMillisecond;
   event.main_thread_wall_clock_duration_in_us =
       static_cast<int64_t>(main_thread_wall_clock_duration_in_us);
+  // Detailed phases. Only the scopes of the collector that ran are non-zero.
+  event.main_thread_detailed = DetailedPhasesFromScopes(
+      current_.scopes[Scope::SCAVENGER_SCAVENGE_ROOTS] +
+          current_.scopes[Scope::MINOR_MC_MARK_ROOTS],
+      current_.scopes[Scope::SCAVENGER_SCAVENGE_WEAK] +
+          current_.scopes[Scope::MINOR_MC_CLEAR],
+      current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL] +
+          current_.scopes[Scope::MINOR_MC_EVACUATE_COPY],
+      current_.scopes[Scope::SCAVENGER_SCAVENGE_UPDATE_REFS] +
+          current_.scopes[Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS],
+      current_.scopes[Scope::MINOR_MC_SWEEP]);
   // Collection Rate:
   if (current_.young_object_size == 0) {
     event.collection_rate_in_percent = 0;
@@ -427,6 +427,8 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, MutatorUtilization);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
+  FRIEND_TEST(GCTracerTest, ReportFullCycleDetailedPhases);
+  FRIEND_TEST(GCTracerTest, ReportYoungCycleDetailedPhases);
 
   struct BackgroundCounter {
     double total_duration_ms;
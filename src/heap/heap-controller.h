@@ -49,10 +49,13 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
 
  private:
   static double MaxGrowingFactor(size_t max_heap_size);
-  static double DynamicGrowingFactor(double gc_speed, double mutator_speed,
-                                     double max_factor);
+  static double DynamicGrowingFactor(
+      double gc_speed, double mutator_speed, double max_factor,
+      double target_mutator_utilization = Trait::kTargetMutatorUtilization);
 
   FRIEND_TEST(MemoryControllerTest, HeapGrowingFactor);
+  FRIEND_TEST(MemoryControllerTest,
+              HeapGrowingFactorWithTargetMutatorUtilization);
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
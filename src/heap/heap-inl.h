@@ -94,6 +94,12 @@ base::EnumSet<CodeFlushMode> Heap::GetCodeFlushMode(Isolate* isolate) {
     code_flush_mode.Add(CodeFlushMode::kStressFlushCode);
   }
 
+  // GCs that reduce memory (e.g. on memory pressure) flush code that is younger
+  // than --bytecode-old-age.
+  if (!code_flush_mode.empty() && isolate->heap()->ShouldReduceMemory()) {
+    code_flush_mode.Add(CodeFlushMode::kReduceMemoryFlushCode);
+  }
+
   return code_flush_mode;
 }
 
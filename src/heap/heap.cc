@@ -115,6 +115,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -1511,6 +1512,7 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
 
   set_current_gc_flags(kNoGCFlags);
   EagerlyFreeExternalMemory();
+  isolate()->allocator()->ReleasePooledSegments();
 
   if (v8_flags.trace_duplicate_threshold_kb) {
     std::map<int, std::vector<HeapObject>> objects_by_size;
@@ -3939,6 +3941,12 @@ GCIdleTimeHeapState Heap::ComputeHeapState() {
   GCIdleTimeHeapState heap_state;
   heap_state.size_of_objects = static_cast<size_t>(SizeOfObjects());
   heap_state.incremental_marking_stopped = incremental_marking()->IsStopped();
+  if (new_space()) {
+    heap_state.new_space_size = new_space()->Size();
+    heap_state.new_space_capacity = new_space()->Capacity();
+    heap_state.scavenge_speed_in_bytes_per_ms =
+        tracer()->ScavengeSpeedInBytesPerMillisecond();
+  }
   return heap_state;
 }
 
@@ -3951,10 +3959,20 @@ bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
       result = true;
       break;
     case GCIdleTimeAction::kIncrementalStep: {
-      incremental_marking()->AdvanceAndFinalizeIfComplete();
+      // Use the whole idle period for marking instead of a single default
+      // sized step.
+      const double remaining_idle_time_in_ms =
+          (deadline_in_ms - MonotonicallyIncreasingTimeInMs()) *
+          GCIdleTimeHandler::kConservativeTimeRatio;
+      incremental_marking()->AdvanceAndFinalizeIfComplete(std::max(
+          remaining_idle_time_in_ms, IncrementalMarking::kStepSizeInMs));
       result = incremental_marking()->IsStopped();
       break;
     }
+    case GCIdleTimeAction::kScavenge:
+      CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTask);
+      result = false;
+      break;
   }
 
   return result;
@@ -3966,7 +3984,6 @@ void Heap::IdleNotificationEpilogue(GCIdleTimeAction action,
   const double idle_time_in_ms = deadline_in_ms - start_ms;
   const double deadline_difference =
       deadline_in_ms - MonotonicallyIncreasingTimeInMs();
-
   if (v8_flags.trace_idle_notification) {
     isolate_->PrintWithTimestamp(
         "Idle notification: requested idle time %.2f ms, used idle time %.2f "
@@ -3980,6 +3997,9 @@ void Heap::IdleNotificationEpilogue(GCIdleTimeAction action,
       case GCIdleTimeAction::kIncrementalStep:
         PrintF("incremental step");
         break;
+      case GCIdleTimeAction::kScavenge:
+        PrintF("scavenge");
+        break;
     }
     PrintF("]");
     if (v8_flags.trace_idle_notification_verbose) {
@@ -4029,6 +4049,11 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
   GCIdleTimeAction action =
       gc_idle_time_handler_->Compute(idle_time_in_ms, heap_state);
   bool result = PerformIdleTimeAction(action, heap_state, deadline_in_ms);
+  // Zone segments kept for reuse by compile jobs aren't worth holding on to
+  // once there is nothing left to do in idle time.
+  if (action == GCIdleTimeAction::kDone) {
+    isolate()->allocator()->ReleasePooledSegments();
+  }
   IdleNotificationEpilogue(action, heap_state, start_ms, deadline_in_ms);
   return result;
 }
@@ -4054,6 +4079,7 @@ void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
     isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+    isolate()->allocator()->ReleasePooledSegments();
   }
   // Reset the memory pressure level to avoid recursive GCs triggered by
   // CheckMemoryPressure from AdjustAmountOfExternalMemory called by
@@ -5034,6 +5060,16 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
 
   code_range_size_ = constraints.code_range_size_in_bytes();
 
+  {
+    double target_gc_cpu_fraction = constraints.target_gc_cpu_fraction();
+    if (v8_flags.target_gc_cpu_fraction > 0) {
+      target_gc_cpu_fraction = v8_flags.target_gc_cpu_fraction;
+    }
+    if (target_gc_cpu_fraction > 0 && target_gc_cpu_fraction < 1) {
+      target_mutator_utilization_ = 1 - target_gc_cpu_fraction;
+    }
+  }
+
   configured_ = true;
 }
 
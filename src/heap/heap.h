@@ -1297,6 +1297,11 @@ class Heap {
   size_t MaxSemiSpaceSize() { return max_semi_space_size_; }
   size_t InitialSemiSpaceSize() { return initial_semispace_size_; }
   size_t MaxOldGenerationSize() { return max_old_generation_size(); }
+  // Returns the mutator utilization the heap growing controllers aim for, or 0
+  // if the default of the controller should be used.
+  double target_mutator_utilization() const {
+    return target_mutator_utilization_;
+  }
 
   // Limit on the max old generation size imposed by the underlying allocator.
   V8_EXPORT_PRIVATE static size_t AllocatorLimitOnMaxOldGenerationSize();
@@ -2136,6 +2141,9 @@ class Heap {
   // configurable limit into account.
   size_t min_global_memory_size_ = 0;
   size_t max_global_memory_size_ = 0;
+  // Mutator utilization configured through ResourceConstraints or
+  // --target-gc-cpu-fraction. 0 means the controller default is used.
+  double target_mutator_utilization_ = 0.0;
 
   size_t initial_max_old_generation_size_ = 0;
   size_t initial_max_old_generation_size_threshold_ = 0;
@@ -757,12 +757,13 @@ void IncrementalMarking::ScheduleBytesToMarkBasedOnTime(double time_ms) {
   }
 }
 
-void IncrementalMarking::AdvanceAndFinalizeIfComplete() {
+void IncrementalMarking::AdvanceAndFinalizeIfComplete(
+    double max_step_size_in_ms) {
   ScheduleBytesToMarkBasedOnTime(heap()->MonotonicallyIncreasingTimeInMs());
   if (v8_flags.fast_forward_schedule) {
     FastForwardScheduleIfCloseToFinalization();
   }
-  Step(kStepSizeInMs, StepOrigin::kTask);
+  Step(max_step_size_in_ms, StepOrigin::kTask);
   heap()->FinalizeIncrementalMarkingIfComplete(
       GarbageCollectionReason::kFinalizeMarkingViaTask);
 }
@@ -111,7 +111,7 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   void UpdateMarkedBytesAfterScavenge(size_t dead_bytes_in_new_space);
 
   // Performs incremental marking step and finalizes marking if complete.
-  void AdvanceAndFinalizeIfComplete();
+  void AdvanceAndFinalizeIfComplete(double max_step_size_in_ms = kStepSizeInMs);
 
   // Performs incremental marking step and finalizes marking if the stack guard
   // was already armed. If marking is complete but the stack guard wasn't armed
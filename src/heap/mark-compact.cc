@@ -4,6 +4,7 @@
 
 #include "src/heap/mark-compact.h"
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -560,7 +561,8 @@ bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
 void MarkCompactCollector::StartMarking() {
   std::vector<Address> contexts =
       heap()->memory_measurement()->StartProcessing();
-  if (v8_flags.stress_per_context_marking_worklist) {
+  if (v8_flags.stress_per_context_marking_worklist ||
+      v8_flags.continuous_memory_attribution) {
     contexts.clear();
     HandleScope handle_scope(heap()->isolate());
     for (auto context : heap()->FindAllNativeContexts()) {
@@ -597,6 +599,8 @@ void MarkCompactCollector::CollectGarbage() {
   ClearNonLiveReferences();
   VerifyMarking();
   heap()->memory_measurement()->FinishProcessing(native_context_stats_);
+  RecordNativeContextLiveBytes();
+  RecordInstanceTypeLiveBytes();
   RecordObjectStats();
 
   Sweep();
@@ -701,6 +705,21 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (v8_flags.compaction_pause_budget_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // Bound the evacuation work per GC by time instead of a fixed quota.
+      // Evacuation runs on all worker threads, while the traced speed is
+      // measured per task. The most fragmented pages are selected first; the
+      // remaining ones qualify again in the next GC, which spreads compaction
+      // of large heaps over several bounded pauses.
+      const size_t tasks =
+          v8_flags.parallel_compaction
+              ? V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1
+              : 1;
+      *max_evacuated_bytes = static_cast<size_t>(
+          estimated_compaction_speed * v8_flags.compaction_pause_budget_ms *
+          tasks);
+    }
   }
 }
 
@@ -934,6 +953,7 @@ void MarkCompactCollector::FinishConcurrentMarking() {
     heap()->concurrent_marking()->FlushMemoryChunkData(
         non_atomic_marking_state());
     heap()->concurrent_marking()->FlushNativeContexts(&native_context_stats_);
+    heap()->concurrent_marking()->FlushInstanceTypeStats(&instance_type_stats_);
   }
   if (auto* cpp_heap = CppHeap::From(heap_->cpp_heap())) {
     cpp_heap->FinishConcurrentMarkingIfNeeded();
@@ -1024,6 +1044,7 @@ void MarkCompactCollector::Finish() {
   local_marking_worklists_.reset();
   marking_worklists_.ReleaseContextWorklists();
   native_context_stats_.Clear();
+  instance_type_stats_.Clear();
 
   CHECK(weak_objects_.current_ephemerons.IsEmpty());
   CHECK(weak_objects_.discovered_ephemerons.IsEmpty());
@@ -2480,6 +2501,7 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
   size_t bytes_processed = 0;
   size_t objects_processed = 0;
   bool is_per_context_mode = local_marking_worklists()->IsPerContextMode();
+  const bool track_instance_types = v8_flags.trace_gc_live_bytes_by_type;
   Isolate* isolate = heap()->isolate();
   PtrComprCageBase cage_base(isolate);
   CodePageHeaderModificationScope rwx_write_scope(
@@ -2524,6 +2546,9 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
       native_context_stats_.IncrementSize(local_marking_worklists()->Context(),
                                           map, object, visited_size);
     }
+    if (track_instance_types) {
+      instance_type_stats_.IncrementSize(map, visited_size);
+    }
     bytes_processed += visited_size;
     objects_processed++;
     if (bytes_to_process && bytes_processed >= bytes_to_process) {
@@ -2593,6 +2618,25 @@ void MarkCompactCollector::ProcessTopOptimizedFrame(ObjectVisitor* visitor,
   }
 }
 
+void MarkCompactCollector::RecordNativeContextLiveBytes() {
+  if (!v8_flags.continuous_memory_attribution) return;
+  // Dead native contexts were already removed from the list when clearing
+  // non-live references.
+  Object context = heap()->native_contexts_list();
+  while (!context.IsUndefined(isolate())) {
+    NativeContext native_context = NativeContext::cast(context);
+    const size_t live_kb = native_context_stats_.Get(native_context.ptr()) / KB;
+    native_context.set_live_kb_at_last_gc(Smi::FromInt(static_cast<int>(
+        std::min(live_kb, static_cast<size_t>(Smi::kMaxValue)))));
+    context = native_context.next_context_link();
+  }
+}
+
+void MarkCompactCollector::RecordInstanceTypeLiveBytes() {
+  if (!v8_flags.trace_gc_live_bytes_by_type) return;
+  instance_type_stats_.Print(isolate());
+}
+
 void MarkCompactCollector::RecordObjectStats() {
   if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
   // Cannot run during bootstrapping due to incomplete objects.
@@ -2838,6 +2882,28 @@ class ClearStringTableJobItem final : public ParallelClearingJob::ClearingItem {
   Isolate* const isolate_;
 };
 
+#ifdef V8_ENABLE_SANDBOX
+class SweepExternalPointerTableJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  SweepExternalPointerTableJobItem(Isolate* isolate,
+                                   ExternalPointerTable* table)
+      : isolate_(isolate), table_(table) {}
+
+  void Run(JobDelegate* delegate) final {
+    TRACE_GC1(isolate_->heap()->tracer(),
+              GCTracer::Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE,
+              delegate->IsJoiningThread() ? ThreadKind::kMain
+                                          : ThreadKind::kBackground);
+    table_->SweepAndCompact(isolate_);
+  }
+
+ private:
+  Isolate* const isolate_;
+  ExternalPointerTable* const table_;
+};
+#endif  // V8_ENABLE_SANDBOX
+
 class StringForwardingTableCleaner final {
  public:
   explicit StringForwardingTableCleaner(Heap* heap)
@@ -2965,6 +3031,25 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     heap()->isolate()->traced_handles()->ResetDeadNodes(&IsUnmarkedHeapObject);
   }
 
+#ifdef V8_ENABLE_SANDBOX
+  // External pointer tables are swept in the background while the main thread
+  // clears weak references below. This has to wait until dead external strings
+  // have been finalized and phantom handles have been processed above: string
+  // finalization reads resources through the table, and phantom callbacks are
+  // passed the embedder fields of dead objects, which are read through it as
+  // well. The remaining clearing phases neither read entries of dead objects
+  // nor allocate new entries.
+  auto sweeping_job = std::make_unique<ParallelClearingJob>();
+  sweeping_job->Add(std::make_unique<SweepExternalPointerTableJobItem>(
+      isolate(), &isolate()->external_pointer_table()));
+  if (isolate()->owns_shareable_data()) {
+    sweeping_job->Add(std::make_unique<SweepExternalPointerTableJobItem>(
+        isolate(), &isolate()->shared_external_pointer_table()));
+  }
+  auto sweeping_job_handle = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::move(sweeping_job));
+#endif  // V8_ENABLE_SANDBOX
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_FLUSHABLE_BYTECODE);
     // `ProcessFlushedBaselineCandidates()` must be called after
@@ -3003,23 +3088,15 @@ void MarkCompactCollector::ClearNonLiveReferences() {
 
   MarkDependentCodeForDeoptimization();
 
-#ifdef V8_ENABLE_SANDBOX
   {
-    TRACE_GC(heap()->tracer(),
-             GCTracer::Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE);
-    // External pointer table sweeping needs to happen before evacuating live
+    TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_JOIN_JOB);
+    clearing_job_handle->Join();
+#ifdef V8_ENABLE_SANDBOX
+    // External pointer table sweeping needs to finish before evacuating live
     // objects as it may perform table compaction, which requires objects to
     // still be at the same location as during marking.
-    isolate()->external_pointer_table().SweepAndCompact(isolate());
-    if (isolate()->owns_shareable_data()) {
-      isolate()->shared_external_pointer_table().SweepAndCompact(isolate());
-    }
-  }
+    sweeping_job_handle->Join();
 #endif  // V8_ENABLE_SANDBOX
-
-  {
-    TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_JOIN_JOB);
-    clearing_job_handle->Join();
   }
 
   DCHECK(weak_objects_.transition_arrays.IsEmpty());
@@ -3455,31 +3532,109 @@ void MarkCompactCollector::TrimEnumCache(Map map, DescriptorArray descriptors) {
   heap_->RightTrimFixedArray(indices, to_trim);
 }
 
+// Removes dead entries from EphemeronHashTables on several threads. Tables
+// are split into ranges of entries so that a single large WeakMap is shared
+// between threads. The element counts of the tables are updated by the main
+// thread afterwards, from the number of entries removed in each range.
+class ClearEphemeronHashTablesJob final : public v8::JobTask {
+ public:
+  struct Item {
+    EphemeronHashTable table;
+    int start;
+    int end;
+    int removed;
+  };
+
+  ClearEphemeronHashTablesJob(MarkCompactCollector* collector,
+                              std::vector<Item>* items)
+      : collector_(collector), items_(items) {}
+
+  ClearEphemeronHashTablesJob(const ClearEphemeronHashTablesJob&) = delete;
+  ClearEphemeronHashTablesJob& operator=(const ClearEphemeronHashTablesJob&) =
+      delete;
+
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= items_->size()) return;
+      Item& item = (*items_)[index];
+      item.removed = collector_->ClearDeadEphemeronHashTableEntries(
+          item.table, item.start, item.end);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_item = next_item_.load(std::memory_order_relaxed);
+    return next_item >= items_->size() ? 0 : items_->size() - next_item;
+  }
+
+ private:
+  MarkCompactCollector* const collector_;
+  std::vector<Item>* const items_;
+  std::atomic<size_t> next_item_{0};
+};
+
+int MarkCompactCollector::ClearDeadEphemeronHashTableEntries(
+    EphemeronHashTable table, int start, int end) {
+  int removed = 0;
+  for (int entry = start; entry < end; entry++) {
+    InternalIndex i(entry);
+    HeapObject key = HeapObject::cast(table.KeyAt(i));
+#ifdef VERIFY_HEAP
+    if (v8_flags.verify_heap) {
+      Object value = table.ValueAt(i);
+      if (value.IsHeapObject()) {
+        HeapObject heap_object = HeapObject::cast(value);
+        CHECK_IMPLIES(
+            !ShouldMarkObject(key) ||
+                non_atomic_marking_state()->IsBlackOrGrey(key),
+            !ShouldMarkObject(heap_object) ||
+                non_atomic_marking_state()->IsBlackOrGrey(heap_object));
+      }
+    }
+#endif
+    if (!ShouldMarkObject(key)) continue;
+    if (!non_atomic_marking_state()->IsBlackOrGrey(key)) {
+      // Like RemoveEntry, but the element counts are updated by the caller.
+      table.set_the_hole(EphemeronHashTable::EntryToIndex(i));
+      table.set_the_hole(EphemeronHashTable::EntryToValueIndex(i));
+      removed++;
+    }
+  }
+  return removed;
+}
+
 void MarkCompactCollector::ClearWeakCollections() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+  static constexpr int kEntriesPerItem = 16 * KB;
+  std::vector<ClearEphemeronHashTablesJob::Item> items;
+  // A table may have been pushed more than once. Ranges must be disjoint for
+  // the per-range removal counts to add up.
+  std::unordered_set<Address> tables;
   EphemeronHashTable table;
   while (local_weak_objects()->ephemeron_hash_tables_local.Pop(&table)) {
-    for (InternalIndex i : table.IterateEntries()) {
-      HeapObject key = HeapObject::cast(table.KeyAt(i));
-#ifdef VERIFY_HEAP
-      if (v8_flags.verify_heap) {
-        Object value = table.ValueAt(i);
-        if (value.IsHeapObject()) {
-          HeapObject heap_object = HeapObject::cast(value);
-          CHECK_IMPLIES(
-              !ShouldMarkObject(key) ||
-                  non_atomic_marking_state()->IsBlackOrGrey(key),
-              !ShouldMarkObject(heap_object) ||
-                  non_atomic_marking_state()->IsBlackOrGrey(heap_object));
-        }
-      }
-#endif
-      if (!ShouldMarkObject(key)) continue;
-      if (!non_atomic_marking_state()->IsBlackOrGrey(key)) {
-        table.RemoveEntry(i);
-      }
+    if (!tables.insert(table.ptr()).second) continue;
+    const int capacity = table.Capacity();
+    for (int start = 0; start < capacity; start += kEntriesPerItem) {
+      items.push_back(
+          {table, start, std::min(start + kEntriesPerItem, capacity), 0});
     }
   }
+  if (v8_flags.parallel_weak_collection_clearing && items.size() > 1) {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<ClearEphemeronHashTablesJob>(this, &items))
+        ->Join();
+  } else {
+    for (auto& item : items) {
+      item.removed =
+          ClearDeadEphemeronHashTableEntries(item.table, item.start, item.end);
+    }
+  }
+  for (auto& item : items) {
+    if (item.removed > 0) item.table.ElementsRemoved(item.removed);
+  }
   for (auto it = heap_->ephemeron_remembered_set_.begin();
        it != heap_->ephemeron_remembered_set_.end();) {
     if (!non_atomic_marking_state()->IsBlackOrGrey(it->first)) {
@@ -4084,6 +4239,15 @@ class Evacuator : public Malloced {
            MemoryChunkLayout::AllocatableMemoryInDataPage() / 100;
   }
 
+  // The live bytes of a NewSpacePage as a percentage of its allocatable
+  // memory, as recorded in the page's survival rate.
+  static int NewSpacePageLivePercentage(intptr_t live_bytes) {
+    return static_cast<int>(std::min<intptr_t>(
+        100, live_bytes * 100 /
+                 static_cast<intptr_t>(
+                     MemoryChunkLayout::AllocatableMemoryInDataPage())));
+  }
+
   Evacuator(Heap* heap, RecordMigratedSlotVisitor* record_visitor,
             EvacuationAllocator* local_allocator,
             AlwaysPromoteYoung always_promote_young)
@@ -4402,11 +4566,24 @@ bool ShouldMovePage(Page* p, intptr_t live_bytes, intptr_t wasted_bytes,
                     AlwaysPromoteYoung always_promote_young,
                     PromoteUnusablePages promote_unusable_pages) {
   Heap* heap = p->heap();
+  // Pages that keep a lot of live bytes over several GCs are likely to do so
+  // in the next one as well, so promote them instead of copying their objects
+  // again.
+  const bool high_survival_rate =
+      v8_flags.page_promotion_survival_gcs > 0 &&
+      p->SurvivalSamples() >= v8_flags.page_promotion_survival_gcs &&
+      p->SurvivalRate() >= v8_flags.page_promotion_survival_threshold;
+  // With a sticky young generation, being marked once is enough to be
+  // considered old. Non-empty pages are promoted without copying and empty
+  // pages are swept and reused for allocation.
+  const bool sticky_survivors =
+      v8_flags.sticky_young_generation && live_bytes > 0;
   return v8_flags.page_promotion &&
          (memory_reduction_mode == MemoryReductionMode::kNone) &&
          !p->NeverEvacuate() &&
          ((live_bytes + wasted_bytes >
            Evacuator::NewSpacePageEvacuationThreshold()) ||
+          high_survival_rate || sticky_survivors ||
           (promote_unusable_pages == PromoteUnusablePages::kYes &&
            !p->WasUsedForAllocation())) &&
          (always_promote_young == AlwaysPromoteYoung::kYes ||
@@ -4445,6 +4622,8 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     DCHECK_LT(0, live_bytes_on_page);
     live_bytes += live_bytes_on_page;
+    page->RecordSurvival(
+        Evacuator::NewSpacePageLivePercentage(live_bytes_on_page));
     MemoryReductionMode memory_reduction_mode =
         heap()->ShouldReduceMemory() ? MemoryReductionMode::kShouldReduceMemory
                                      : MemoryReductionMode::kNone;
@@ -5590,7 +5769,13 @@ void MinorMarkCompactCollector::FinishConcurrentMarking() {
   if (v8_flags.concurrent_minor_mc_marking) {
     DCHECK_EQ(heap()->concurrent_marking()->garbage_collector(),
               GarbageCollector::MINOR_MARK_COMPACTOR);
-    heap()->concurrent_marking()->Cancel();
+    // Instead of cancelling the concurrent job and leaving the remaining
+    // worklist (including the delta published by the marking barriers) to the
+    // atomic pause, bump the job to user-blocking priority and let the
+    // concurrent markers finish the transitive closure.
+    heap()->concurrent_marking()->RescheduleJobIfNeeded(
+        GarbageCollector::MINOR_MARK_COMPACTOR, TaskPriority::kUserBlocking);
+    heap()->concurrent_marking()->Join();
     heap()->concurrent_marking()->FlushMemoryChunkData(
         non_atomic_marking_state());
   }
@@ -6311,10 +6496,11 @@ void MinorMarkCompactCollector::MarkLiveObjects() {
     TRACE_GC(heap()->tracer(),
              GCTracer::Scope::MINOR_MC_MARK_FINISH_INCREMENTAL);
     if (heap_->incremental_marking()->Stop()) {
+      // Publish the marking barrier worklists before joining concurrent
+      // marking such that the concurrent markers also process the delta that
+      // was recorded while the mutator was running.
       MarkingBarrier::PublishAll(heap());
       // TODO(v8:13012): TRACE_GC with MINOR_MC_MARK_FULL_CLOSURE_PARALLEL_JOIN.
-      // TODO(v8:13012): Instead of finishing concurrent marking here, we could
-      // continue running it to replace parallel marking.
       FinishConcurrentMarking();
       was_marked_incrementally = true;
     }
@@ -6526,6 +6712,8 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     DCHECK_LT(0, live_bytes_on_page);
     live_bytes += live_bytes_on_page;
+    page->RecordSurvival(
+        Evacuator::NewSpacePageLivePercentage(live_bytes_on_page));
     if (ShouldMovePage(page, live_bytes_on_page, page->wasted_memory(),
                        MemoryReductionMode::kNone, AlwaysPromoteYoung::kNo,
                        heap()->tracer()->IsCurrentGCDueToAllocationFailure()
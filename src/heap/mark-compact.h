@@ -473,6 +473,13 @@ class MarkCompactCollector final : public CollectorBase {
 
   void RecordObjectStats();
 
+  // Stores the live bytes attributed to each native context during marking
+  // on the native context itself (--continuous-memory-attribution).
+  void RecordNativeContextLiveBytes();
+  // Prints the live bytes per instance type counted during marking
+  // (--trace-gc-live-bytes-by-type).
+  void RecordInstanceTypeLiveBytes();
+
   // Finishes GC, performs heap verification if enabled.
   void Finish() final;
 
@@ -575,6 +582,11 @@ class MarkCompactCollector final : public CollectorBase {
   // with an unreachable key are removed from all encountered weak maps.
   // The linked list of all encountered weak maps is destroyed.
   void ClearWeakCollections();
+  // Removes the entries in [start, end) whose keys are dead and returns how
+  // many were removed, without updating the table's element counts. Safe to
+  // call from background threads for disjoint ranges.
+  int ClearDeadEphemeronHashTableEntries(EphemeronHashTable table, int start,
+                                         int end);
 
   // Goes through the list of encountered weak references and clears those with
   // dead values. If the value is a dead map and the parent map transitions to
@@ -645,6 +657,7 @@ class MarkCompactCollector final : public CollectorBase {
   std::unique_ptr<WeakObjects::Local> local_weak_objects_;
   NativeContextInferrer native_context_inferrer_;
   NativeContextStats native_context_stats_;
+  InstanceTypeStats instance_type_stats_;
 
   // Candidates for pages that should be evacuated.
   std::vector<Page*> evacuation_candidates_;
@@ -672,6 +685,7 @@ class MarkCompactCollector final : public CollectorBase {
   // the start of each GC.
   base::EnumSet<CodeFlushMode> code_flush_mode_;
 
+  friend class ClearEphemeronHashTablesJob;
   friend class FullEvacuator;
   friend class RecordMigratedSlotVisitor;
 };
@@ -128,6 +128,10 @@ void MarkingWorklists::Local::Publish() {
   PublishWrapper();
 }
 
+void MarkingWorklists::Local::SetLocality(int locality) {
+  shared_.SetLocality(locality);
+}
+
 bool MarkingWorklists::Local::IsEmpty() {
   // This function checks the on_hold_ worklist, so it works only for the main
   // thread.
@@ -178,6 +178,9 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local final {
   void ShareWork();
   // Merges the on-hold worklist to the shared worklist.
   void MergeOnHold();
+  // Sets the locality that is used to tag published segments of the shared
+  // worklist and that is preferred when stealing from it.
+  void SetLocality(int locality);
 
   // Returns true if wrapper objects could be directly pushed. Otherwise,
   // objects need to be processed one by one.
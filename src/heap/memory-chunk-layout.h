@@ -78,6 +78,7 @@ class V8_EXPORT_PRIVATE MemoryChunkLayout {
     FIELD(ObjectStartBitmap, ObjectStartBitmap),
 #endif  // V8_ENABLE_INNER_POINTER_RESOLUTION_OSB
     FIELD(size_t, WasUsedForAllocation),
+    FIELD(size_t, SurvivalStats),
     kMarkingBitmapOffset,
     kMemoryChunkHeaderSize =
         kMarkingBitmapOffset +
@@ -103,6 +104,7 @@ class V8_EXPORT_PRIVATE MemoryChunkLayout {
   static int MaxRegularCodeObjectSize();
 
   static_assert(kMemoryChunkHeaderSize % alignof(size_t) == 0);
+  static_assert(kMarkingBitmapOffset % kSystemPointerSize == 0);
 };
 
 }  // namespace internal
@@ -179,7 +179,7 @@ MemoryChunk::MemoryChunk(Heap* heap, BaseSpace* space, size_t chunk_size,
   }
 
   if (owner()->identity() == CODE_SPACE) {
-    code_object_registry_ = new CodeObjectRegistry();
+    code_object_registry_ = new CodeObjectRegistry(address());
   } else {
     code_object_registry_ = nullptr;
   }
@@ -523,6 +523,9 @@ void MemoryChunk::ValidateOffsets(MemoryChunk* chunk) {
   DCHECK_EQ(reinterpret_cast<Address>(&chunk->was_used_for_allocation_) -
                 chunk->address(),
             MemoryChunkLayout::kWasUsedForAllocationOffset);
+  DCHECK_EQ(reinterpret_cast<Address>(&chunk->survival_stats_) -
+                chunk->address(),
+            MemoryChunkLayout::kSurvivalStatsOffset);
 }
 #endif
 
@@ -227,6 +227,24 @@ class MemoryChunk : public BasicMemoryChunk {
   void ClearWasUsedForAllocation() { was_used_for_allocation_ = false; }
   bool WasUsedForAllocation() const { return was_used_for_allocation_; }
 
+  // Folds the percentage of live bytes this page had when it was last
+  // evacuated, by either the minor or the full GC, into its survival rate, an
+  // average in which each older GC weighs half as much as the next one. Used
+  // only for new space pages.
+  void RecordSurvival(int live_percentage) {
+    DCHECK_LE(0, live_percentage);
+    DCHECK_LE(live_percentage, 100);
+    survival_stats_.rate = static_cast<uint8_t>(
+        survival_stats_.samples == 0
+            ? live_percentage
+            : (survival_stats_.rate + live_percentage) / 2);
+    if (survival_stats_.samples < kMaxUInt8) survival_stats_.samples++;
+  }
+  void ClearSurvivalHistory() { survival_stats_ = SurvivalStats(); }
+  int SurvivalRate() const { return survival_stats_.rate; }
+  // The number of GCs recorded in the survival rate, saturating at kMaxUInt8.
+  int SurvivalSamples() const { return survival_stats_.samples; }
+
  protected:
   // Release all memory allocated by the chunk. Should be called when memory
   // chunk is about to be freed.
@@ -298,6 +316,15 @@ class MemoryChunk : public BasicMemoryChunk {
   // only for new space pages.
   size_t was_used_for_allocation_ = false;
 
+  // See RecordSurvival(). Used only for new space pages. Padded to a full word
+  // so that the marking bitmap following the header stays aligned.
+  struct alignas(size_t) SurvivalStats {
+    uint8_t rate = 0;
+    uint8_t samples = 0;
+  };
+  static_assert(sizeof(SurvivalStats) == sizeof(size_t));
+  SurvivalStats survival_stats_;
+
  private:
   friend class ConcurrentMarkingState;
   friend class MarkingState;
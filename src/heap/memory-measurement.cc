@@ -4,6 +4,9 @@
 
 #include "src/heap/memory-measurement.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include "include/v8-local-handle.h"
 #include "src/api/api-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -397,6 +400,35 @@ void NativeContextStats::Merge(const NativeContextStats& other) {
   }
 }
 
+void InstanceTypeStats::Merge(const InstanceTypeStats& other) {
+  if (other.size_by_type_.empty()) return;
+  if (size_by_type_.empty()) {
+    size_by_type_ = other.size_by_type_;
+    return;
+  }
+  for (size_t i = 0; i < size_by_type_.size(); i++) {
+    size_by_type_[i] += other.size_by_type_[i];
+  }
+}
+
+void InstanceTypeStats::Print(Isolate* isolate) const {
+  std::vector<std::pair<size_t, InstanceType>> sizes;
+  size_t total = 0;
+  for (size_t i = 0; i < size_by_type_.size(); i++) {
+    if (size_by_type_[i] == 0) continue;
+    sizes.emplace_back(size_by_type_[i], static_cast<InstanceType>(i));
+    total += size_by_type_[i];
+  }
+  std::sort(sizes.begin(), sizes.end(),
+            [](auto& a, auto& b) { return a.first > b.first; });
+  std::stringstream stream;
+  stream << "Live bytes by instance type (" << total / KB << " KB):\n";
+  for (const auto& entry : sizes) {
+    stream << "  " << entry.second << ": " << entry.first / KB << " KB\n";
+  }
+  isolate->PrintWithTimestamp("%s", stream.str().c_str());
+}
+
 void NativeContextStats::IncrementExternalSize(Address context, Map map,
                                                HeapObject object) {
   InstanceType instance_type = map.instance_type();
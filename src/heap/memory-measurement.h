@@ -7,6 +7,7 @@
 
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "include/v8-statistics.h"
 #include "src/base/platform/elapsed-timer.h"
@@ -102,6 +103,28 @@ class V8_EXPORT_PRIVATE NativeContextStats {
   std::unordered_map<Address, size_t> size_by_context_;
 };
 
+// Maintains the sizes of marked objects per instance type. Unlike ObjectStats
+// this is filled in by the marking visitors while they mark, so it costs one
+// increment per visited object instead of another heap iteration.
+class V8_EXPORT_PRIVATE InstanceTypeStats {
+ public:
+  void IncrementSize(Map map, size_t size) {
+    if (V8_UNLIKELY(size_by_type_.empty())) size_by_type_.resize(LAST_TYPE + 1);
+    size_by_type_[map.instance_type()] += size;
+  }
+
+  size_t Get(InstanceType type) const {
+    return size_by_type_.empty() ? 0 : size_by_type_[type];
+  }
+  void Clear() { size_by_type_.clear(); }
+  void Merge(const InstanceTypeStats& other);
+  // Prints the non-empty instance types, largest first.
+  void Print(Isolate* isolate) const;
+
+ private:
+  std::vector<size_t> size_by_type_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -59,8 +59,12 @@ inline bool MakePretenureDecision(
        current_decision == AllocationSite::kMaybeTenure)) {
     if (ratio >= AllocationSite::kPretenureRatio) {
       // We just transition into tenure state when the semi-space was at
-      // maximum capacity.
-      if (maximum_size_scavenge) {
+      // maximum capacity, unless the site was already tenured before its
+      // decision got reset. In that case the earlier decision is trusted and
+      // the site does not have to warm up again.
+      if (maximum_size_scavenge ||
+          (v8_flags.pretenuring_remember_tenured_sites &&
+           site.previously_tenured())) {
         site.set_deopt_dependent_code(true);
         site.set_pretenure_decision(AllocationSite::kTenure);
         // Currently we just need to deopt when we make a state transition to
@@ -9,6 +9,7 @@
 #include "src/builtins/builtins-constructor-gen.h"
 #include "src/codegen/code-factory.h"
 #include "src/codegen/interface-descriptors-inl.h"
+#include "src/heap/memory-chunk.h"
 #include "src/ic/handler-configuration.h"
 #include "src/ic/ic.h"
 #include "src/ic/keyed-store-generic.h"
@@ -2976,6 +2977,112 @@ void AccessorAssembler::TryProbeStubCacheTable(
   Goto(if_handler);
 }
 
+void AccessorAssembler::StubCacheSet(StubCache* stub_cache, TNode<Name> name,
+                                     TNode<Map> map,
+                                     TNode<MaybeObject> handler) {
+  // See v8::internal::StubCache::Set().
+  Label done(this), update_primary(this);
+
+  // The stub cache is not visited by the scavenger, so it must not point to
+  // young objects.
+  TNode<IntPtrT> name_page = PageFromAddress(BitcastTaggedToWord(name));
+  TNode<IntPtrT> name_page_flags =
+      Load<IntPtrT>(name_page, IntPtrConstant(MemoryChunk::kFlagsOffset));
+  GotoIf(WordNotEqual(
+             WordAnd(name_page_flags,
+                     IntPtrConstant(MemoryChunk::kIsInYoungGenerationMask)),
+             IntPtrConstant(0)),
+         &done);
+
+  // See TryProbeStubCacheTable() for the {kMultiplier}.
+  const int kMultiplier =
+      sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
+  DCHECK_EQ(0, offsetof(StubCache::Entry, key));
+  TNode<IntPtrT> map_offset = IntPtrConstant(offsetof(StubCache::Entry, map));
+  TNode<IntPtrT> value_offset =
+      IntPtrConstant(offsetof(StubCache::Entry, value));
+  TNode<ExternalReference> primary_base =
+      ExternalConstant(ExternalReference::Create(
+          stub_cache->key_reference(StubCache::kPrimary)));
+  TNode<IntPtrT> primary_offset = IntPtrMul(StubCachePrimaryOffset(name, map),
+                                            IntPtrConstant(kMultiplier));
+
+  // If the primary entry has useful data in it, retire it to the secondary
+  // table before overwriting it.
+  TNode<Object> old_map =
+      Load<Object>(primary_base, IntPtrAdd(primary_offset, map_offset));
+  GotoIf(TaggedIsSmi(old_map), &update_primary);
+  TNode<MaybeObject> old_handler = ReinterpretCast<MaybeObject>(
+      Load(MachineType::AnyTagged(), primary_base,
+           IntPtrAdd(primary_offset, value_offset)));
+  GotoIf(
+      TaggedEqual(old_handler, HeapConstant(BUILTIN_CODE(isolate(), Illegal))),
+      &update_primary);
+  {
+    TNode<Name> old_name =
+        CAST(Load(MachineType::TaggedPointer(), primary_base, primary_offset));
+    TNode<ExternalReference> secondary_base =
+        ExternalConstant(ExternalReference::Create(
+            stub_cache->key_reference(StubCache::kSecondary)));
+    TNode<IntPtrT> secondary_offset =
+        IntPtrMul(StubCacheSecondaryOffset(old_name, CAST(old_map)),
+                  IntPtrConstant(kMultiplier));
+    StoreNoWriteBarrier(MachineRepresentation::kTagged, secondary_base,
+                        secondary_offset, old_name);
+    StoreNoWriteBarrier(MachineRepresentation::kTagged, secondary_base,
+                        IntPtrAdd(secondary_offset, map_offset), old_map);
+    StoreNoWriteBarrier(MachineRepresentation::kTagged, secondary_base,
+                        IntPtrAdd(secondary_offset, value_offset), old_handler);
+    Goto(&update_primary);
+  }
+
+  BIND(&update_primary);
+  StoreNoWriteBarrier(MachineRepresentation::kTagged, primary_base,
+                      primary_offset, name);
+  StoreNoWriteBarrier(MachineRepresentation::kTagged, primary_base,
+                      IntPtrAdd(primary_offset, map_offset), map);
+  StoreNoWriteBarrier(MachineRepresentation::kTagged, primary_base,
+                      IntPtrAdd(primary_offset, value_offset), handler);
+  IncrementCounter(isolate()->counters()->megamorphic_stub_cache_updates(), 1);
+  Goto(&done);
+
+  BIND(&done);
+}
+
+TNode<Smi> AccessorAssembler::MakeLoadFieldHandler(TNode<Map> map,
+                                                   TNode<Uint32T> details) {
+  // See LoadHandler::LoadField() and FieldIndex::ForPropertyIndex().
+  TNode<IntPtrT> field_index = IntPtrAdd(
+      Signed(DecodeWordFromWord32<PropertyDetails::FieldIndexField>(details)),
+      LoadMapInobjectPropertiesStartInWords(map));
+  TNode<IntPtrT> instance_size_in_words = LoadMapInstanceSizeInWords(map);
+  TNode<BoolT> is_inobject =
+      UintPtrLessThan(field_index, instance_size_in_words);
+  // Out-of-object fields are indexed in words from the start of the
+  // PropertyArray.
+  TNode<IntPtrT> index = Select<IntPtrT>(
+      is_inobject, [=] { return field_index; },
+      [=] {
+        return IntPtrAdd(IntPtrSub(field_index, instance_size_in_words),
+                         IntPtrConstant(PropertyArray::kHeaderSize /
+                                        kTaggedSize));
+      });
+  TNode<BoolT> is_double = Word32Equal(
+      DecodeWord32<PropertyDetails::RepresentationField>(details),
+      Int32Constant(Representation::kDouble));
+
+  TNode<IntPtrT> config = IntPtrConstant(
+      LoadHandler::KindBits::encode(LoadHandler::Kind::kField));
+  config = WordOr(config, SelectIntPtrConstant(
+                              is_inobject, LoadHandler::IsInobjectBits::kMask,
+                              0));
+  config = WordOr(config, SelectIntPtrConstant(
+                              is_double, LoadHandler::IsDoubleBits::kMask, 0));
+  config = WordOr(config,
+                  Signed(WordShl(index, LoadHandler::FieldIndexBits::kShift)));
+  return SmiTag(config);
+}
+
 void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
                                           TNode<Object> lookup_start_object,
                                           TNode<Name> name, Label* if_handler,
@@ -4208,13 +4315,70 @@ void AccessorAssembler::GenerateLoadIC_Megamorphic() {
 
   ExitPoint direct_exit(this);
   TVARIABLE(MaybeObject, var_handler);
-  Label if_handler(this, &var_handler), miss(this, Label::kDeferred);
+  Label if_handler(this, &var_handler), stub_cache_miss(this),
+      miss(this, Label::kDeferred);
 
   CSA_DCHECK(this, TaggedEqual(LoadFeedbackVectorSlot(CAST(vector), slot),
                                MegamorphicSymbolConstant()));
 
   TryProbeStubCache(isolate()->load_stub_cache(), receiver, CAST(name),
-                    &if_handler, &var_handler, &miss);
+                    &if_handler, &var_handler, &stub_cache_miss);
+
+  BIND(&stub_cache_miss);
+  {
+    // Before going to the runtime, look for an own data property of an
+    // ordinary fast-mode receiver directly in its DescriptorArray, which is
+    // sorted by name hash. This keeps megamorphic sites with a high map churn
+    // (and thus a high stub cache miss rate) out of the runtime for the most
+    // common case; everything else still goes through the LoadIC miss handler.
+    // Fields get the same handler that the miss handler would create, and it
+    // is entered into the stub cache, so that the next load with this map
+    // hits the stub cache again.
+    GotoIf(TaggedIsSmi(receiver), &miss);
+    TNode<Map> receiver_map = LoadMap(CAST(receiver));
+    GotoIf(IsDeprecatedMap(receiver_map), &miss);
+    GotoIf(IsSpecialReceiverInstanceType(LoadMapInstanceType(receiver_map)),
+           &miss);
+    TNode<Uint32T> bitfield3 = LoadMapBitField3(receiver_map);
+    GotoIf(IsSetWord32<Map::Bits3::IsDictionaryMapBit>(bitfield3), &miss);
+
+    TNode<DescriptorArray> descriptors = LoadMapDescriptors(receiver_map);
+    TVARIABLE(IntPtrT, var_name_index);
+    Label if_descriptor_found(this);
+    DescriptorLookup(CAST(name), descriptors, bitfield3, &if_descriptor_found,
+                     &var_name_index, &miss);
+
+    BIND(&if_descriptor_found);
+    TNode<Uint32T> details =
+        LoadDetailsByKeyIndex(descriptors, var_name_index.value());
+    // Accessors need the full handler machinery.
+    TNode<Uint32T> kind = DecodeWord32<PropertyDetails::KindField>(details);
+    GotoIfNot(
+        Word32Equal(kind, Int32Constant(static_cast<int>(PropertyKind::kData))),
+        &miss);
+    Label if_in_field(this), if_in_descriptor(this);
+    Branch(Word32Equal(DecodeWord32<PropertyDetails::LocationField>(details),
+                       Int32Constant(static_cast<int32_t>(
+                           PropertyLocation::kField))),
+           &if_in_field, &if_in_descriptor);
+
+    BIND(&if_in_field);
+    {
+      TNode<Smi> handler = MakeLoadFieldHandler(receiver_map, details);
+      StubCacheSet(isolate()->load_stub_cache(), CAST(name), receiver_map,
+                   handler);
+      var_handler = handler;
+      Goto(&if_handler);
+    }
+
+    BIND(&if_in_descriptor);
+    {
+      TVARIABLE(Object, var_value);
+      LoadPropertyFromFastObject(CAST(receiver), receiver_map, descriptors,
+                                 var_name_index.value(), details, &var_value);
+      direct_exit.Return(var_value.value());
+    }
+  }
 
   BIND(&if_handler);
   LazyLoadICParameters p(
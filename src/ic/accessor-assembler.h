@@ -545,6 +545,12 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   enum StubCacheTable : int;
 
   TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
+  // Enters {handler} into the stub cache, like StubCache::Set().
+  void StubCacheSet(StubCache* stub_cache, TNode<Name> name, TNode<Map> map,
+                    TNode<MaybeObject> handler);
+  // Returns the Smi handler that loads the own field described by {details}
+  // from objects with {map}, like LoadHandler::LoadField().
+  TNode<Smi> MakeLoadFieldHandler(TNode<Map> map, TNode<Uint32T> details);
   TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name, TNode<Map> map);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
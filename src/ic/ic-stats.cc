@@ -4,8 +4,13 @@
 
 #include "src/ic/ic-stats.h"
 
+#include <algorithm>
+
+#include "include/v8-script.h"
+#include "src/flags/flags.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
+#include "src/objects/feedback-vector.h"
 #include "src/objects/objects-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/tracing/traced-value.h"
@@ -142,5 +147,59 @@ void ICInfo::AppendToTracedValue(v8::tracing::TracedValue* value) const {
   value->EndDictionary();
 }
 
+// static
+MegamorphicICStats::Site MegamorphicICStats::SiteFor(SharedFunctionInfo shared,
+                                                     FeedbackSlot slot) {
+  Object script = shared.script();
+  int script_id = script.IsScript() ? Script::cast(script).id()
+                                    : v8::UnboundScript::kNoScriptId;
+  return {script_id, shared.StartPosition(), slot.ToInt()};
+}
+
+void MegamorphicICStats::RecordTransition(SharedFunctionInfo shared,
+                                          FeedbackSlot slot) {
+  Site site = SiteFor(shared, slot);
+  base::MutexGuard guard(&mutex_);
+  sites_[site].transitions++;
+}
+
+void MegamorphicICStats::RecordStubCacheMiss(SharedFunctionInfo shared,
+                                             FeedbackSlot slot) {
+  uint64_t interval = std::max(
+      1, v8_flags.megamorphic_ic_stats_sampling_interval.value());
+  base::MutexGuard guard(&mutex_);
+  if (misses_until_sample_ > 0) {
+    misses_until_sample_--;
+    return;
+  }
+  misses_until_sample_ = interval - 1;
+  sites_[SiteFor(shared, slot)].stub_cache_misses += interval;
+}
+
+void MegamorphicICStats::Dump(std::ostream& os) const {
+  std::vector<std::pair<Site, Counts>> sorted;
+  {
+    base::MutexGuard guard(&mutex_);
+    sorted.assign(sites_.begin(), sites_.end());
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+    return a.second.stub_cache_misses > b.second.stub_cache_misses;
+  });
+  os << "Megamorphic IC sites (script id, function position, slot): "
+        "transitions, stub cache misses\n";
+  for (const auto& entry : sorted) {
+    os << "  (" << entry.first.script_id << ", "
+       << entry.first.function_position << ", " << entry.first.slot
+       << "): " << entry.second.transitions << ", "
+       << entry.second.stub_cache_misses << "\n";
+  }
+}
+
+void MegamorphicICStats::Reset() {
+  base::MutexGuard guard(&mutex_);
+  sites_.clear();
+  misses_until_sample_ = 0;
+}
+
 }  // namespace internal
 }  // namespace v8
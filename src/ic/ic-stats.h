@@ -5,7 +5,9 @@
 #ifndef V8_IC_IC_STATS_H_
 #define V8_IC_IC_STATS_H_
 
+#include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -13,6 +15,7 @@
 #include "include/v8-internal.h"  // For Address.
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 
 namespace v8 {
 
@@ -22,8 +25,10 @@ class TracedValue;
 
 namespace internal {
 
+class FeedbackSlot;
 class JSFunction;
 class Script;
+class SharedFunctionInfo;
 
 struct ICInfo {
   ICInfo();
@@ -75,6 +80,56 @@ class ICStats {
   int pos_;
 };
 
+// In-memory aggregation of megamorphic IC activity, enabled by
+// --megamorphic-ic-stats. Unlike --log-ic it does not record every transition
+// but keeps one entry per IC site, which makes it cheap enough to find the
+// sites responsible for StubCache misses in long running workloads.
+class MegamorphicICStats {
+ public:
+  // An IC site is identified by its function (script id and start position)
+  // and by its feedback slot within that function.
+  struct Site {
+    int script_id;
+    int function_position;
+    int slot;
+    bool operator<(const Site& other) const {
+      if (script_id != other.script_id) return script_id < other.script_id;
+      if (function_position != other.function_position) {
+        return function_position < other.function_position;
+      }
+      return slot < other.slot;
+    }
+  };
+  struct Counts {
+    // Number of times the site transitioned to MEGAMORPHIC.
+    uint64_t transitions = 0;
+    // Estimated number of StubCache misses while the site was MEGAMORPHIC.
+    // Only every --megamorphic-ic-stats-sampling-interval'th miss is
+    // recorded, weighted by the interval.
+    uint64_t stub_cache_misses = 0;
+  };
+
+  void RecordTransition(SharedFunctionInfo shared, FeedbackSlot slot);
+  void RecordStubCacheMiss(SharedFunctionInfo shared, FeedbackSlot slot);
+
+  // Calls |callback| with each site and its counts.
+  template <typename Callback>
+  void ForEachSite(Callback callback) const {
+    base::MutexGuard guard(&mutex_);
+    for (const auto& entry : sites_) callback(entry.first, entry.second);
+  }
+  // Prints the sites, the ones with the most StubCache misses first.
+  void Dump(std::ostream& os) const;
+  void Reset();
+
+ private:
+  static Site SiteFor(SharedFunctionInfo shared, FeedbackSlot slot);
+
+  mutable base::Mutex mutex_;
+  std::map<Site, Counts> sites_;
+  uint64_t misses_until_sample_ = 0;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -364,6 +364,10 @@ bool IC::ConfigureVectorState(IC::State new_state, Handle<Object> key) {
   // functions doesn't improve performance.
   bool changed = nexus()->ConfigureMegamorphic(
       key->IsName() ? IcCheckType::kProperty : IcCheckType::kElement);
+  if (V8_UNLIKELY(isolate()->megamorphic_ic_stats() != nullptr) && changed) {
+    isolate()->megamorphic_ic_stats()->RecordTransition(
+        nexus()->vector().shared_function_info(), nexus()->slot());
+  }
   OnFeedbackChanged("Megamorphic");
   return changed;
 }
@@ -865,6 +869,13 @@ StubCache* IC::stub_cache() {
 void IC::UpdateMegamorphicCache(Handle<Map> map, Handle<Name> name,
                                 const MaybeObjectHandle& handler) {
   if (!IsAnyHas() && !IsAnyDefineOwn()) {
+    // Reaching the runtime for an IC that already was megamorphic means that
+    // the StubCache probe in the megamorphic handler missed.
+    if (V8_UNLIKELY(isolate()->megamorphic_ic_stats() != nullptr) &&
+        old_state_ == MEGAMORPHIC) {
+      isolate()->megamorphic_ic_stats()->RecordStubCacheMiss(
+          nexus()->vector().shared_function_info(), nexus()->slot());
+    }
     stub_cache()->Set(*name, *map, *handler);
   }
 }
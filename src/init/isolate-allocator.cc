@@ -27,6 +27,18 @@ inline size_t GetIsolateRootBiasPageSize(
                  platform_page_allocator->AllocatePageSize());
 }
 
+// Heap pages are carved out of the cage by a bounded page allocator that
+// hands out the lowest free addresses first, so pages in use end up grouped
+// in the same huge-page-sized regions.
+void AdviseHugePagesForCage(VirtualMemoryCage* cage) {
+  if (!v8_flags.transparent_huge_pages) return;
+  if (!base::OS::AdviseHugePages(reinterpret_cast<void*>(cage->base()),
+                                 cage->size()) &&
+      v8_flags.trace_gc_verbose) {
+    PrintF("Transparent huge pages are not available for the V8 heap\n");
+  }
+}
+
 }  // namespace
 
 struct PtrComprCageReservationParams
@@ -94,6 +106,7 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  AdviseHugePagesForCage(GetProcessWidePtrComprCage());
 #endif
 }
 
@@ -105,6 +118,7 @@ IsolateAllocator::IsolateAllocator() {
         nullptr,
         "Failed to reserve memory for Isolate V8 pointer compression cage");
   }
+  AdviseHugePagesForCage(&isolate_ptr_compr_cage_);
   page_allocator_ = isolate_ptr_compr_cage_.page_allocator();
   CommitPagesForIsolate();
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
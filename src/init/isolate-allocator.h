@@ -31,6 +31,11 @@ namespace internal {
 // the Isolate object takes ownership of the IsolateAllocator object to keep
 // the memory alive.
 // Isolate::Delete() takes care of the proper order of the objects destruction.
+//
+// With a shared cage there is exactly one cage per process: the read-only
+// heap, the code range and (with the sandbox) the sandbox itself are all
+// process-wide and placed relative to it, so isolates can't be spread over
+// several cages without giving each group its own copies of those.
 class V8_EXPORT_PRIVATE IsolateAllocator final {
  public:
   IsolateAllocator();
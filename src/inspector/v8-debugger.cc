@@ -24,6 +24,7 @@ namespace v8_inspector {
 namespace {
 
 static const size_t kMaxAsyncTaskStacks = 8 * 1024;
+static const size_t kLazyAsyncTaskBufferSize = 1024;
 static const int kNoBreakpointId = 0;
 
 template <typename Map>
@@ -67,6 +68,15 @@ class MatchPrototypePredicate : public v8::debug::QueryObjectPredicate {
   v8::Local<v8::Value> m_prototype;
 };
 
+bool equalsStringView(const String16& string, const StringView& view) {
+  if (string.length() != view.length()) return false;
+  for (size_t i = 0; i < view.length(); ++i) {
+    UChar c = view.is8Bit() ? view.characters8()[i] : view.characters16()[i];
+    if (string[i] != c) return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 V8Debugger::V8Debugger(v8::Isolate* isolate, V8InspectorImpl* inspector)
@@ -682,7 +692,13 @@ void V8Debugger::AsyncEventOccurred(v8::debug::DebugAsyncActionType type,
 }
 
 std::shared_ptr<AsyncStackTrace> V8Debugger::currentAsyncParent() {
-  return m_currentAsyncParent.empty() ? nullptr : m_currentAsyncParent.back();
+  if (m_currentAsyncParent.empty()) return nullptr;
+  if (!m_currentAsyncParent.back() && m_currentLazyAsyncParent.back()) {
+    m_currentAsyncParent.back() =
+        materializeLazyAsyncTask(m_currentLazyAsyncParent.back());
+    m_currentLazyAsyncParent.back() = 0;
+  }
+  return m_currentAsyncParent.back();
 }
 
 V8StackTraceId V8Debugger::currentExternalParent() {
@@ -982,6 +998,7 @@ void V8Debugger::externalAsyncTaskStarted(const V8StackTraceId& parent) {
   if (!m_maxAsyncCallStackDepth || parent.IsInvalid()) return;
   m_currentExternalParent.push_back(parent);
   m_currentAsyncParent.emplace_back();
+  m_currentLazyAsyncParent.push_back(0);
   m_currentTasks.push_back(reinterpret_cast<void*>(parent.id));
 
   if (!parent.should_pause) return;
@@ -996,6 +1013,7 @@ void V8Debugger::externalAsyncTaskFinished(const V8StackTraceId& parent) {
   if (!m_maxAsyncCallStackDepth || m_currentExternalParent.empty()) return;
   m_currentExternalParent.pop_back();
   m_currentAsyncParent.pop_back();
+  m_currentLazyAsyncParent.pop_back();
   DCHECK(m_currentTasks.back() == reinterpret_cast<void*>(parent.id));
   m_currentTasks.pop_back();
 
@@ -1030,6 +1048,10 @@ void V8Debugger::asyncTaskScheduledForStack(const StringView& taskName,
                                             void* task, bool recurring,
                                             bool skipTopFrame) {
   if (!m_maxAsyncCallStackDepth) return;
+  if (m_lazyAsyncStackTraces) {
+    lazyAsyncTaskScheduled(taskName, task, recurring, skipTopFrame);
+    return;
+  }
   v8::HandleScope scope(m_isolate);
   std::shared_ptr<AsyncStackTrace> asyncStack =
       AsyncStackTrace::capture(this, toString16(taskName), skipTopFrame);
@@ -1043,6 +1065,14 @@ void V8Debugger::asyncTaskScheduledForStack(const StringView& taskName,
 
 void V8Debugger::asyncTaskCanceledForStack(void* task) {
   if (!m_maxAsyncCallStackDepth) return;
+  if (m_lazyAsyncStackTraces) {
+    // Keep the entry itself, it may still be the async parent of the running
+    // task or of tasks scheduled from it.
+    if (LazyAsyncTask* entry = findLazyAsyncTask(task)) {
+      forgetLazyAsyncTask(entry);
+    }
+    return;
+  }
   m_asyncTaskStacks.erase(task);
   m_recurringTasks.erase(task);
 }
@@ -1057,6 +1087,13 @@ void V8Debugger::asyncTaskStartedForStack(void* task) {
   //   <-- async stack requested here -->
   // - asyncTaskFinished
   m_currentTasks.push_back(task);
+  if (m_lazyAsyncStackTraces) {
+    LazyAsyncTask* entry = findLazyAsyncTask(task);
+    m_currentAsyncParent.emplace_back();
+    m_currentLazyAsyncParent.push_back(entry ? entry->id : 0);
+    m_currentExternalParent.emplace_back();
+    return;
+  }
   AsyncTaskToStackTrace::iterator stackIt = m_asyncTaskStacks.find(task);
   if (stackIt != m_asyncTaskStacks.end() && !stackIt->second.expired()) {
     std::shared_ptr<AsyncStackTrace> stack(stackIt->second);
@@ -1064,6 +1101,7 @@ void V8Debugger::asyncTaskStartedForStack(void* task) {
   } else {
     m_currentAsyncParent.emplace_back();
   }
+  m_currentLazyAsyncParent.push_back(0);
   m_currentExternalParent.emplace_back();
 }
 
@@ -1075,13 +1113,124 @@ void V8Debugger::asyncTaskFinishedForStack(void* task) {
   m_currentTasks.pop_back();
 
   m_currentAsyncParent.pop_back();
+  m_currentLazyAsyncParent.pop_back();
   m_currentExternalParent.pop_back();
 
+  if (m_lazyAsyncStackTraces) {
+    LazyAsyncTask* entry = findLazyAsyncTask(task);
+    if (entry && !entry->recurring) forgetLazyAsyncTask(entry);
+    return;
+  }
   if (m_recurringTasks.find(task) == m_recurringTasks.end()) {
     asyncTaskCanceledForStack(task);
   }
 }
 
+void V8Debugger::setLazyAsyncStackTraces(bool lazy) {
+  if (m_lazyAsyncStackTraces == lazy) return;
+  m_lazyAsyncStackTraces = lazy;
+  // Tasks scheduled in the other mode lose their async stack, just like
+  // tasks scheduled before the debugger was attached.
+  m_asyncTaskStacks.clear();
+  m_recurringTasks.clear();
+  clearLazyAsyncTasks();
+  if (lazy) {
+    m_lazyAsyncTasks.resize(kLazyAsyncTaskBufferSize);
+    m_lazyAsyncTaskIds.reserve(kLazyAsyncTaskBufferSize);
+  }
+}
+
+void V8Debugger::lazyAsyncTaskScheduled(const StringView& taskName,
+                                        void* task, bool recurring,
+                                        bool skipTopFrame) {
+  v8::HandleScope scope(m_isolate);
+  uint64_t id = ++m_lastLazyAsyncTaskId;
+  LazyAsyncTask& entry = m_lazyAsyncTasks[id % m_lazyAsyncTasks.size()];
+  // The task that was recorded in this slot loses its async stack trace.
+  forgetLazyAsyncTask(&entry);
+  entry.id = id;
+  entry.task = task;
+  if (task) m_lazyAsyncTaskIds[task] = id;
+  entry.recurring = recurring;
+  // Most slots are reused for the same kind of task, so avoid reallocating
+  // the description if possible.
+  if (!equalsStringView(entry.description, taskName)) {
+    entry.description = toString16(taskName);
+  }
+  AsyncStackTrace::captureFrames(this, skipTopFrame, &entry.frames);
+  entry.asyncParent.reset();
+  entry.lazyParent = 0;
+  if (!m_currentAsyncParent.empty()) {
+    entry.asyncParent = m_currentAsyncParent.back();
+    entry.lazyParent = m_currentLazyAsyncParent.back();
+  }
+  entry.externalParent = currentExternalParent();
+  entry.materialized.reset();
+}
+
+V8Debugger::LazyAsyncTask* V8Debugger::lazyAsyncTaskFor(uint64_t id) {
+  if (!id || m_lazyAsyncTasks.empty()) return nullptr;
+  LazyAsyncTask& entry = m_lazyAsyncTasks[id % m_lazyAsyncTasks.size()];
+  return entry.id == id ? &entry : nullptr;
+}
+
+V8Debugger::LazyAsyncTask* V8Debugger::findLazyAsyncTask(void* task) {
+  auto it = m_lazyAsyncTaskIds.find(task);
+  if (it == m_lazyAsyncTaskIds.end()) return nullptr;
+  LazyAsyncTask* entry = lazyAsyncTaskFor(it->second);
+  DCHECK(entry && entry->task == task);
+  return entry;
+}
+
+void V8Debugger::forgetLazyAsyncTask(LazyAsyncTask* entry) {
+  if (!entry->task) return;
+  auto it = m_lazyAsyncTaskIds.find(entry->task);
+  // A later recording of the same task owns the index entry.
+  if (it != m_lazyAsyncTaskIds.end() && it->second == entry->id) {
+    m_lazyAsyncTaskIds.erase(it);
+  }
+  entry->task = nullptr;
+}
+
+std::shared_ptr<AsyncStackTrace> V8Debugger::materializeLazyAsyncTask(
+    uint64_t id) {
+  // Collect the not yet materialized part of the chain, bounded by the
+  // depth that can be reported anyway, and materialize it oldest first.
+  std::vector<LazyAsyncTask*> chain;
+  std::shared_ptr<AsyncStackTrace> asyncParent;
+  while (LazyAsyncTask* entry = lazyAsyncTaskFor(id)) {
+    if ((asyncParent = entry->materialized.lock())) break;
+    chain.push_back(entry);
+    asyncParent = entry->asyncParent.lock();
+    if (asyncParent ||
+        chain.size() > static_cast<size_t>(m_maxAsyncCallStackDepth)) {
+      break;
+    }
+    id = entry->lazyParent;
+  }
+  for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+    LazyAsyncTask* entry = *it;
+    // Only the top stack in the chain may be empty, see calculateAsyncChain.
+    if (asyncParent && asyncParent->isEmpty()) {
+      asyncParent = asyncParent->parent().lock();
+    }
+    std::shared_ptr<AsyncStackTrace> asyncStack =
+        AsyncStackTrace::create(entry->description, entry->frames,
+                                std::move(asyncParent), entry->externalParent);
+    entry->materialized = asyncStack;
+    if (asyncStack) m_allAsyncStacks.push_back(asyncStack);
+    asyncParent = std::move(asyncStack);
+  }
+  collectOldAsyncStacksIfNeeded();
+  return asyncParent;
+}
+
+void V8Debugger::clearLazyAsyncTasks() {
+  m_lazyAsyncTasks.clear();
+  m_lazyAsyncTaskIds.clear();
+  for (uint64_t& id : m_currentLazyAsyncParent) id = 0;
+}
+
 void V8Debugger::asyncTaskCandidateForStepping(void* task) {
   if (!m_pauseOnAsyncCall) return;
   int contextGroupId = currentContextGroupId();
@@ -1118,8 +1267,13 @@ void V8Debugger::allAsyncTasksCanceled() {
   m_asyncTaskStacks.clear();
   m_recurringTasks.clear();
   m_currentAsyncParent.clear();
+  m_currentLazyAsyncParent.clear();
   m_currentExternalParent.clear();
   m_currentTasks.clear();
+  if (m_lazyAsyncStackTraces) {
+    clearLazyAsyncTasks();
+    m_lazyAsyncTasks.resize(kLazyAsyncTaskBufferSize);
+  }
 
   m_allAsyncStacks.clear();
 }
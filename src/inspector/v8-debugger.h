@@ -130,6 +130,13 @@ class V8Debugger : public v8::debug::DebugDelegate,
 
   V8InspectorImpl* inspector() { return m_inspector; }
 
+  // In lazy mode, scheduled async tasks are recorded into a fixed-size ring
+  // buffer that reuses its storage, instead of allocating an AsyncStackTrace
+  // per task. The recorded tasks are only turned into AsyncStackTraces once
+  // an async parent is actually requested, i.e. on pause or when a stack
+  // trace is captured.
+  void setLazyAsyncStackTraces(bool lazy);
+
   void setMaxAsyncTaskStacksForTest(int limit);
   void dumpAsyncTaskStacksStateForTest();
 
@@ -271,6 +278,39 @@ class V8Debugger : public v8::debug::DebugDelegate,
   std::vector<V8StackTraceId> m_currentExternalParent;
 
   void collectOldAsyncStacksIfNeeded();
+
+  // An async task recorded in lazy mode. {id} identifies the recorded task
+  // across ring buffer reuse, and {lazyParent} refers to the (possibly not
+  // yet materialized) recorded task that was running when this one got
+  // scheduled.
+  struct LazyAsyncTask {
+    uint64_t id = 0;
+    void* task = nullptr;
+    bool recurring = false;
+    String16 description;
+    std::vector<std::shared_ptr<StackFrame>> frames;
+    std::weak_ptr<AsyncStackTrace> asyncParent;
+    uint64_t lazyParent = 0;
+    V8StackTraceId externalParent;
+    std::weak_ptr<AsyncStackTrace> materialized;
+  };
+  void lazyAsyncTaskScheduled(const StringView& taskName, void* task,
+                              bool recurring, bool skipTopFrame);
+  LazyAsyncTask* lazyAsyncTaskFor(uint64_t id);
+  LazyAsyncTask* findLazyAsyncTask(void* task);
+  void forgetLazyAsyncTask(LazyAsyncTask* entry);
+  std::shared_ptr<AsyncStackTrace> materializeLazyAsyncTask(uint64_t id);
+  void clearLazyAsyncTasks();
+
+  bool m_lazyAsyncStackTraces = false;
+  std::vector<LazyAsyncTask> m_lazyAsyncTasks;
+  // The id of the latest recorded entry for each task that is still pending.
+  std::unordered_map<void*, uint64_t> m_lazyAsyncTaskIds;
+  uint64_t m_lastLazyAsyncTaskId = 0;
+  // Parallel to {m_currentAsyncParent}; non-zero if the current task was
+  // recorded lazily and its AsyncStackTrace has not been requested yet.
+  std::vector<uint64_t> m_currentLazyAsyncParent;
+
   // V8Debugger owns all the async stacks, while most of the other references
   // are weak, which allows to collect some stacks when there are too many.
   std::list<std::shared_ptr<AsyncStackTrace>> m_allAsyncStacks;
@@ -353,6 +353,10 @@ void V8InspectorImpl::allAsyncTasksCanceled() {
   m_debugger->allAsyncTasksCanceled();
 }
 
+void V8InspectorImpl::setLazyAsyncStackTraces(bool lazy) {
+  m_debugger->setLazyAsyncStackTraces(lazy);
+}
+
 v8::MaybeLocal<v8::Context> V8InspectorImpl::regexContext() {
   if (m_regexContext.IsEmpty()) {
     m_regexContext.Reset(m_isolate, v8::Context::New(m_isolate));
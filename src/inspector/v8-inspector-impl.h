@@ -109,6 +109,7 @@ class V8InspectorImpl : public V8Inspector {
   void asyncTaskStarted(void* task) override;
   void asyncTaskFinished(void* task) override;
   void allAsyncTasksCanceled() override;
+  void setLazyAsyncStackTraces(bool lazy) override;
 
   V8StackTraceId storeCurrentStackTrace(StringView description) override;
   void externalAsyncTaskStarted(const V8StackTraceId& parent) override;
@@ -407,19 +407,40 @@ std::shared_ptr<AsyncStackTrace> AsyncStackTrace::capture(
   v8::HandleScope handleScope(isolate);
 
   std::vector<std::shared_ptr<StackFrame>> frames;
-  if (isolate->InContext()) {
-    v8::Local<v8::StackTrace> v8StackTrace = v8::StackTrace::CurrentStackTrace(
-        isolate, maxStackSize, stackTraceOptions);
-    frames = toFramesVector(debugger, v8StackTrace, maxStackSize);
-    if (skipTopFrame && !frames.empty()) {
-      frames.erase(frames.begin());
-    }
-  }
+  captureFrames(debugger, skipTopFrame, &frames);
 
   std::shared_ptr<AsyncStackTrace> asyncParent;
   V8StackTraceId externalParent;
   calculateAsyncChain(debugger, &asyncParent, &externalParent, nullptr);
 
+  return create(description, std::move(frames), std::move(asyncParent),
+                externalParent);
+}
+
+// static
+void AsyncStackTrace::captureFrames(
+    V8Debugger* debugger, bool skipTopFrame,
+    std::vector<std::shared_ptr<StackFrame>>* frames) {
+  frames->clear();
+  v8::Isolate* isolate = debugger->isolate();
+  if (!isolate->InContext()) return;
+  int maxStackSize = debugger->maxCallStackSizeToCapture();
+  v8::Local<v8::StackTrace> v8StackTrace = v8::StackTrace::CurrentStackTrace(
+      isolate, maxStackSize, stackTraceOptions);
+  int frameCount = std::min(v8StackTrace->GetFrameCount(), maxStackSize);
+  // Fill {frames} in place, so that callers which reuse the vector (like the
+  // lazy async task buffer in V8Debugger) don't reallocate its storage.
+  for (int i = skipTopFrame ? 1 : 0; i < frameCount; ++i) {
+    frames->push_back(debugger->symbolize(v8StackTrace->GetFrame(isolate, i)));
+  }
+}
+
+// static
+std::shared_ptr<AsyncStackTrace> AsyncStackTrace::create(
+    const String16& description,
+    std::vector<std::shared_ptr<StackFrame>> frames,
+    std::shared_ptr<AsyncStackTrace> asyncParent,
+    const V8StackTraceId& externalParent) {
   if (frames.empty() && !asyncParent && externalParent.IsInvalid())
     return nullptr;
 
@@ -117,6 +117,17 @@ class AsyncStackTrace {
   static std::shared_ptr<AsyncStackTrace> capture(V8Debugger*,
                                                   const String16& description,
                                                   bool skipTopFrame = false);
+  // Symbolizes the current JavaScript stack into {frames}, which is cleared
+  // first but keeps its capacity.
+  static void captureFrames(V8Debugger*, bool skipTopFrame,
+                            std::vector<std::shared_ptr<StackFrame>>* frames);
+  // Creates an async stack trace from previously captured frames, or returns
+  // nullptr (or {asyncParent}) if there is nothing worth recording.
+  static std::shared_ptr<AsyncStackTrace> create(
+      const String16& description,
+      std::vector<std::shared_ptr<StackFrame>> frames,
+      std::shared_ptr<AsyncStackTrace> asyncParent,
+      const V8StackTraceId& externalParent);
   static uintptr_t store(V8Debugger* debugger,
                          std::shared_ptr<AsyncStackTrace> stack);
 
@@ -4,6 +4,8 @@
 
 #include "src/interpreter/bytecode-register-optimizer.h"
 
+#include "src/flags/flags.h"
+
 namespace v8 {
 namespace internal {
 namespace interpreter {
@@ -252,6 +254,8 @@ BytecodeRegisterOptimizer::BytecodeRegisterOptimizer(
       equivalence_id_(0),
       bytecode_writer_(bytecode_writer),
       flush_required_(false),
+      keep_equivalences_across_conditional_jumps_(
+          v8_flags.ignition_reo_across_conditional_jumps),
       zone_(zone) {
   register_allocator->set_observer(this);
 
@@ -341,6 +345,32 @@ void BytecodeRegisterOptimizer::Flush() {
   flush_required_ = false;
 }
 
+void BytecodeRegisterOptimizer::MaterializeAllRegisters() {
+  if (!flush_required_) {
+    return;
+  }
+
+  for (RegisterInfo* reg_info : registers_needing_flushed_) {
+    if (!reg_info->needs_flush()) continue;
+
+    RegisterInfo* materialized = reg_info->materialized()
+                                     ? reg_info
+                                     : reg_info->GetMaterializedEquivalent();
+    if (materialized == nullptr) continue;
+
+    // Unlike Flush, leave every equivalent in its set (and in
+    // registers_needing_flushed_) so that the set is broken up by the next
+    // Flush.
+    for (RegisterInfo* equivalent = materialized->GetEquivalent();
+         equivalent != materialized;
+         equivalent = equivalent->GetEquivalent()) {
+      if (equivalent->allocated() && !equivalent->materialized()) {
+        OutputRegisterTransfer(materialized, equivalent);
+      }
+    }
+  }
+}
+
 void BytecodeRegisterOptimizer::OutputRegisterTransfer(
     RegisterInfo* input_info, RegisterInfo* output_info) {
   Register input = input_info->register_value();
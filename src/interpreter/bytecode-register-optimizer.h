@@ -65,12 +65,20 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
 
   // Materialize all live registers and flush equivalence sets.
   void Flush();
+  // Materialize all live registers, but keep the equivalence sets.
+  void MaterializeAllRegisters();
   bool EnsureAllRegistersAreFlushed() const;
 
   // Prepares for |bytecode|.
   template <Bytecode bytecode, ImplicitRegisterUse implicit_register_use>
   V8_INLINE void PrepareForBytecode() {
-    if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode) ||
+    if (Bytecodes::IsConditionalJump(bytecode) &&
+        keep_equivalences_across_conditional_jumps_) {
+      // The jump target only needs all registers to be materialized; it is
+      // flushed when its label is bound. Registers don't change on the
+      // fall-through path, so their equivalences still hold there.
+      MaterializeAllRegisters();
+    } else if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode) ||
         bytecode == Bytecode::kDebugger ||
         bytecode == Bytecode::kSuspendGenerator ||
         bytecode == Bytecode::kResumeGenerator) {
@@ -214,6 +222,7 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
 
   BytecodeWriter* bytecode_writer_;
   bool flush_required_;
+  const bool keep_equivalences_across_conditional_jumps_;
   Zone* zone_;
 };
 
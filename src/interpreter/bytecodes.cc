@@ -309,6 +309,9 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kConstructWithSpread:
       case Bytecode::kCreateObjectLiteral:
       case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateClosure:
       case Bytecode::kThrowReferenceErrorIfHole:
       case Bytecode::kGetTemplateObject:
         return true;
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/memory.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -119,6 +120,50 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Skips whole words of one-byte characters as long as none of them may
+// terminate a JSON string, i.e. none is '"', '\\' or a control character.
+// Returns the start of the first word that may contain such a character, or of
+// the last partial word before {end}.
+const uint8_t* SkipOneByteWordsInJsonString(const uint8_t* cursor,
+                                            const uint8_t* end) {
+  constexpr uintptr_t kOnes = ~static_cast<uintptr_t>(0) / 0xFF;
+  constexpr uintptr_t kHighBits = kOnes * 0x80;
+  while (end - cursor >= static_cast<ptrdiff_t>(sizeof(uintptr_t))) {
+    uintptr_t word =
+        base::ReadUnalignedValue<uintptr_t>(reinterpret_cast<Address>(cursor));
+    // Each term has the high bit of a byte set if that byte is zero (after
+    // the xor) or below 0x20, respectively. There are no false negatives.
+    uintptr_t quotes = word ^ (kOnes * '"');
+    uintptr_t backslashes = word ^ (kOnes * '\\');
+    uintptr_t candidates = ((quotes - kOnes) & ~quotes) |
+                           ((backslashes - kOnes) & ~backslashes) |
+                           ((word - kOnes * 0x20) & ~word);
+    if (candidates & kHighBits) break;
+    cursor += sizeof(uintptr_t);
+  }
+  return cursor;
+}
+
+// Skips whole words of one-byte characters as long as all of them are decimal
+// digits. Returns the start of the first word that contains another
+// character, or of the last partial word before {end}.
+const uint8_t* SkipOneByteWordsOfDecimalDigits(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  constexpr uintptr_t kOnes = ~static_cast<uintptr_t>(0) / 0xFF;
+  constexpr uintptr_t kHighNibbles = kOnes * 0xF0;
+  while (end - cursor >= static_cast<ptrdiff_t>(sizeof(uintptr_t))) {
+    uintptr_t word =
+        base::ReadUnalignedValue<uintptr_t>(reinterpret_cast<Address>(cursor));
+    // A byte is a digit iff its high nibble is 3 both before and after adding
+    // 6 to it. Carries only leave bytes that already fail the check.
+    uintptr_t high_nibbles = (word & kHighNibbles) |
+                             (((word + kOnes * 0x06) & kHighNibbles) >> 4);
+    if (high_nibbles != kOnes * 0x33) break;
+    cursor += sizeof(uintptr_t);
+  }
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -1224,6 +1269,11 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
 
 template <typename Char>
 void JsonParser<Char>::AdvanceToNonDecimal() {
+  if (sizeof(Char) == 1) {
+    cursor_ = reinterpret_cast<const Char*>(SkipOneByteWordsOfDecimalDigits(
+        reinterpret_cast<const uint8_t*>(cursor_),
+        reinterpret_cast<const uint8_t*>(end_)));
+  }
   cursor_ =
       std::find_if(cursor_, end_, [](Char c) { return !IsDecimalDigit(c); });
 }
@@ -1463,6 +1513,11 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if (sizeof(Char) == 1) {
+      cursor_ = reinterpret_cast<const Char*>(SkipOneByteWordsInJsonString(
+          reinterpret_cast<const uint8_t*>(cursor_),
+          reinterpret_cast<const uint8_t*>(end_)));
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -4,6 +4,7 @@
 
 #include "src/json/json-stringifier.h"
 
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
@@ -69,6 +70,12 @@ class JsonStringifier {
   V8_INLINE void SerializeDeferredKey(bool deferred_comma,
                                       Handle<Object> deferred_key);
 
+  // Property keys of objects with the same shape repeat, so keys that were
+  // found to need no escaping are remembered in {key_cache_} and written as
+  // '"key":' in one go.
+  V8_INLINE bool TrySerializeCachedKey(String key);
+  void MaybeCacheKey(String key);
+
   Result SerializeSmi(Smi object);
 
   Result SerializeDouble(double number);
@@ -135,6 +142,12 @@ class JsonStringifier {
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
 
+  // A direct-mapped cache of the addresses of internalized one-byte keys which
+  // need no escaping. Since objects may move, it is cleared after every GC.
+  static constexpr int kKeyCacheSize = 64;
+  Address key_cache_[kKeyCacheSize] = {};
+  int key_cache_gc_count_ = -1;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -1097,11 +1110,57 @@ void JsonStringifier::Separator(bool first) {
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
                                            Handle<Object> deferred_key) {
   Separator(!deferred_comma);
-  SerializeString(Handle<String>::cast(deferred_key));
-  builder_.AppendCharacter(':');
+  Handle<String> key = Handle<String>::cast(deferred_key);
+  if (!TrySerializeCachedKey(*key)) {
+    SerializeString(key);
+    builder_.AppendCharacter(':');
+    MaybeCacheKey(*key);
+  }
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
 
+namespace {
+int KeyCacheIndex(String key, int cache_size) {
+  return static_cast<int>((key.ptr() >> kTaggedSizeLog2) & (cache_size - 1));
+}
+}  // namespace
+
+bool JsonStringifier::TrySerializeCachedKey(String key) {
+  static_assert(base::bits::IsPowerOfTwo(kKeyCacheSize));
+  if (key_cache_gc_count_ != isolate_->heap()->gc_count()) return false;
+  if (key_cache_[KeyCacheIndex(key, kKeyCacheSize)] != key.ptr()) return false;
+  // The key may have been externalized in place since it was cached.
+  if (!key.IsSeqOneByteString()) return false;
+  if (builder_.CurrentEncoding() != String::ONE_BYTE_ENCODING) return false;
+  // Account for the quotes and the colon.
+  int length = key.length();
+  if (!builder_.CurrentPartCanFit(length + 3)) return false;
+  DisallowGarbageCollection no_gc;
+  const uint8_t* chars = SeqOneByteString::cast(key).GetChars(no_gc);
+  IncrementalStringBuilder::NoExtendBuilder<uint8_t> no_extend(
+      &builder_, length + 3, no_gc);
+  no_extend.Append('"');
+  for (int i = 0; i < length; i++) no_extend.Append(chars[i]);
+  no_extend.Append('"');
+  no_extend.Append(':');
+  return true;
+}
+
+void JsonStringifier::MaybeCacheKey(String key) {
+  DisallowGarbageCollection no_gc;
+  if (!key.IsInternalizedString() || !key.IsSeqOneByteString()) return;
+  const uint8_t* chars = SeqOneByteString::cast(key).GetChars(no_gc);
+  for (int i = 0; i < key.length(); i++) {
+    if (!DoNotEscape(chars[i])) return;
+  }
+  int gc_count = isolate_->heap()->gc_count();
+  if (key_cache_gc_count_ != gc_count) {
+    std::fill(std::begin(key_cache_), std::end(key_cache_), kNullAddress);
+    key_cache_gc_count_ = gc_count;
+  }
+  key_cache_[KeyCacheIndex(key, kKeyCacheSize)] = key.ptr();
+}
+
 void JsonStringifier::SerializeString(Handle<String> object) {
   object = String::Flatten(isolate_, object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
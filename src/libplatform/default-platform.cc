@@ -31,11 +31,13 @@ void PrintStackTrace() {
 }
 
 constexpr int kMaxThreadPoolSize = 16;
+// Best effort jobs don't need the full thread pool.
+constexpr int kMaxBestEffortThreadPoolSize = 2;
 
 int GetActualThreadPoolSize(int thread_pool_size) {
   DCHECK_GE(thread_pool_size, 0);
   if (thread_pool_size < 1) {
-    thread_pool_size = base::SysInfo::NumberOfProcessors() - 1;
+    thread_pool_size = base::SysInfo::NumberOfAvailableProcessors() - 1;
   }
   return std::max(std::min(thread_pool_size, kMaxThreadPoolSize), 1);
 }
@@ -200,14 +202,29 @@ std::shared_ptr<TaskRunner> DefaultPlatform::GetForegroundTaskRunner(
   return foreground_task_runner_map_[isolate];
 }
 
-void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
+void DefaultPlatform::PostTaskOnWorkerThread(TaskPriority priority,
+                                             std::unique_ptr<Task> task) {
   // If this DCHECK fires, then this means that either
   // - V8 is running without the --single-threaded flag but
   //   but the platform was created as a single-threaded platform.
   // - or some component in V8 is ignoring --single-threaded
   //   and posting a background task.
   DCHECK_NOT_NULL(worker_threads_task_runner_);
-  worker_threads_task_runner_->PostTask(std::move(task));
+  worker_threads_task_runner_->PostTask(priority, std::move(task));
+}
+
+void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
+  PostTaskOnWorkerThread(TaskPriority::kUserVisible, std::move(task));
+}
+
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  PostTaskOnWorkerThread(TaskPriority::kUserBlocking, std::move(task));
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  PostTaskOnWorkerThread(TaskPriority::kBestEffort, std::move(task));
 }
 
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
@@ -236,8 +253,9 @@ std::unique_ptr<JobHandle> DefaultPlatform::PostJob(
 std::unique_ptr<JobHandle> DefaultPlatform::CreateJob(
     TaskPriority priority, std::unique_ptr<JobTask> job_task) {
   size_t num_worker_threads = NumberOfWorkerThreads();
-  if (priority == TaskPriority::kBestEffort && num_worker_threads > 2) {
-    num_worker_threads = 2;
+  if (priority == TaskPriority::kBestEffort) {
+    num_worker_threads = std::min(
+        num_worker_threads, static_cast<size_t>(kMaxBestEffortThreadPoolSize));
   }
   return NewDefaultJobHandle(this, priority, std::move(job_task),
                              num_worker_threads);
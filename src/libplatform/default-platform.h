@@ -56,6 +56,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   std::shared_ptr<TaskRunner> GetForegroundTaskRunner(
       v8::Isolate* isolate) override;
   void CallOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) override;
   void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                  double delay_in_seconds) override;
   bool IdleTasksEnabled(Isolate* isolate) override;
@@ -72,9 +74,15 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   void NotifyIsolateShutdown(Isolate* isolate);
 
  private:
+  void PostTaskOnWorkerThread(TaskPriority priority,
+                              std::unique_ptr<Task> task);
+
   base::Mutex lock_;
   const int thread_pool_size_;
   IdleTaskSupport idle_task_support_;
+  // All worker threads share one runner. Its queue hands out tasks in order
+  // of their TaskPriority, so lower priority tasks can't delay higher
+  // priority ones that are already queued.
   std::shared_ptr<DefaultWorkerThreadsTaskRunner> worker_threads_task_runner_;
   std::map<v8::Isolate*, std::shared_ptr<DefaultForegroundTaskRunner>>
       foreground_task_runner_map_;
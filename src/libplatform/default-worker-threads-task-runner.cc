@@ -31,10 +31,15 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
   thread_pool_.clear();
 }
 
-void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+void DefaultWorkerThreadsTaskRunner::PostTask(TaskPriority priority,
+                                              std::unique_ptr<Task> task) {
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
-  queue_.Append(std::move(task));
+  queue_.Append(priority, std::move(task));
+}
+
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+  PostTask(TaskPriority::kUserVisible, std::move(task));
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
@@ -31,6 +31,9 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
+  // Posts {task} to be run before all queued tasks of lower {priority}.
+  void PostTask(TaskPriority priority, std::unique_ptr<Task> task);
+
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
@@ -17,17 +17,20 @@ DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function)
 DelayedTaskQueue::~DelayedTaskQueue() {
   base::MutexGuard guard(&lock_);
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+#ifdef DEBUG
+  for (const auto& task_queue : task_queues_) DCHECK(task_queue.empty());
+#endif  // DEBUG
 }
 
 double DelayedTaskQueue::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
-void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
+void DelayedTaskQueue::Append(TaskPriority priority,
+                              std::unique_ptr<Task> task) {
   base::MutexGuard guard(&lock_);
   DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+  task_queues_[static_cast<int>(priority)].push(std::move(task));
   queues_condition_var_.NotifyOne();
 }
 
@@ -46,25 +49,22 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
 std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   base::MutexGuard guard(&lock_);
   for (;;) {
-    // Move delayed tasks that have hit their deadline to the main queue.
+    // Move delayed tasks that have hit their deadline to the main queues.
     double now = MonotonicallyIncreasingTime();
     std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
     while (task) {
-      task_queue_.push(std::move(task));
+      task_queues_[static_cast<int>(TaskPriority::kUserVisible)].push(
+          std::move(task));
       task = PopTaskFromDelayedQueue(now);
     }
-    if (!task_queue_.empty()) {
-      std::unique_ptr<Task> result = std::move(task_queue_.front());
-      task_queue_.pop();
-      return result;
-    }
+    if (std::unique_ptr<Task> result = PopTaskFromQueues()) return result;
 
     if (terminated_) {
       queues_condition_var_.NotifyAll();
       return nullptr;
     }
 
-    if (task_queue_.empty() && !delayed_task_queue_.empty()) {
+    if (!delayed_task_queue_.empty()) {
       // Wait for the next delayed task or a newly posted task.
       double wait_in_seconds = delayed_task_queue_.begin()->first - now;
       base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
@@ -94,6 +94,17 @@ std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromDelayedQueue(double now) {
   return result;
 }
 
+std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromQueues() {
+  for (int i = kNumPriorities - 1; i >= 0; i--) {
+    std::queue<std::unique_ptr<Task>>& task_queue = task_queues_[i];
+    if (task_queue.empty()) continue;
+    std::unique_ptr<Task> result = std::move(task_queue.front());
+    task_queue.pop();
+    return result;
+  }
+  return nullptr;
+}
+
 void DelayedTaskQueue::Terminate() {
   base::MutexGuard guard(&lock_);
   DCHECK(!terminated_);
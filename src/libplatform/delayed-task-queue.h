@@ -10,18 +10,18 @@
 #include <queue>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 
 namespace v8 {
 
-class Task;
-
 namespace platform {
 
 // DelayedTaskQueue provides queueing for immediate and delayed tasks. It does
 // not provide any guarantees about ordering of tasks, except that immediate
-// tasks will be run in the order that they are posted.
+// tasks are returned in order of their priority, and in the order that they
+// are posted within one priority.
 class V8_PLATFORM_EXPORT DelayedTaskQueue {
  public:
   using TimeFunction = double (*)();
@@ -34,13 +34,16 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
 
   double MonotonicallyIncreasingTime();
 
-  // Appends an immediate task to the queue. The queue takes ownership of
-  // |task|. Tasks appended via this method will be run in order. Thread-safe.
-  void Append(std::unique_ptr<Task> task);
+  // Appends an immediate task with |priority| to the queue. The queue takes
+  // ownership of |task|. Tasks appended via this method will be run in order
+  // of their priority, and in order within one priority. Thread-safe.
+  void Append(TaskPriority priority, std::unique_ptr<Task> task);
 
   // Appends a delayed task to the queue. There is no ordering guarantee
   // provided regarding delayed tasks, both with respect to other delayed tasks
-  // and non-delayed tasks that were appended using Append(). Thread-safe.
+  // and non-delayed tasks that were appended using Append(). Once their
+  // deadline has passed, delayed tasks are run with TaskPriority::kUserVisible.
+  // Thread-safe.
   void AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds);
 
   // Returns the next task to process. Blocks if no task is available.
@@ -53,11 +56,18 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   void Terminate();
 
  private:
+  static constexpr int kNumPriorities =
+      static_cast<int>(TaskPriority::kUserBlocking) + 1;
+
   std::unique_ptr<Task> PopTaskFromDelayedQueue(double now);
+  // Returns the first task of the highest priority queue that is not empty, or
+  // nullptr if all of them are empty.
+  std::unique_ptr<Task> PopTaskFromQueues();
 
   base::ConditionVariable queues_condition_var_;
   base::Mutex lock_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
+  // Immediate tasks, indexed by their TaskPriority.
+  std::queue<std::unique_ptr<Task>> task_queues_[kNumPriorities];
   std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
   bool terminated_ = false;
   TimeFunction time_function_;
@@ -90,8 +90,10 @@ TracingController::~TracingController() {
 }
 
 #ifdef V8_USE_PERFETTO
-void TracingController::InitializeForPerfetto(std::ostream* output_stream) {
+void TracingController::InitializeForPerfetto(std::ostream* output_stream,
+                                              OutputFormat format) {
   output_stream_ = output_stream;
+  output_format_ = format;
   DCHECK_NOT_NULL(output_stream);
   DCHECK(output_stream->good());
 }
@@ -183,10 +185,12 @@ void TracingController::StartTracing(TraceConfig* trace_config) {
 #ifdef V8_USE_PERFETTO
   DCHECK_NOT_NULL(output_stream_);
   DCHECK(output_stream_->good());
-  perfetto::trace_processor::Config processor_config;
-  trace_processor_ =
-      perfetto::trace_processor::TraceProcessorStorage::CreateInstance(
-          processor_config);
+  if (output_format_ == OutputFormat::kJSON) {
+    perfetto::trace_processor::Config processor_config;
+    trace_processor_ =
+        perfetto::trace_processor::TraceProcessorStorage::CreateInstance(
+            processor_config);
+  }
 
   ::perfetto::TraceConfig perfetto_trace_config;
   perfetto_trace_config.add_buffers()->set_size_kb(4096);
@@ -241,14 +245,23 @@ void TracingController::StopTracing() {
   tracing_session_->StopBlocking();
 
   std::vector<char> trace = tracing_session_->ReadTraceBlocking();
-  std::unique_ptr<uint8_t[]> trace_bytes(new uint8_t[trace.size()]);
-  std::copy(&trace[0], &trace[0] + trace.size(), &trace_bytes[0]);
-  trace_processor_->Parse(std::move(trace_bytes), trace.size());
-  trace_processor_->NotifyEndOfFile();
-  JsonOutputWriter output_writer(output_stream_);
-  auto status = perfetto::trace_processor::json::ExportJson(
-      trace_processor_.get(), &output_writer, nullptr, nullptr, nullptr);
-  DCHECK(status.ok());
+  if (output_format_ == OutputFormat::kProto) {
+    // The session already produces typed TrackEvent packets with interned
+    // names, so they can be written out without going through the trace
+    // processor.
+    output_stream_->write(trace.data(),
+                          static_cast<std::streamsize>(trace.size()));
+    output_stream_->flush();
+  } else {
+    std::unique_ptr<uint8_t[]> trace_bytes(new uint8_t[trace.size()]);
+    std::copy(&trace[0], &trace[0] + trace.size(), &trace_bytes[0]);
+    trace_processor_->Parse(std::move(trace_bytes), trace.size());
+    trace_processor_->NotifyEndOfFile();
+    JsonOutputWriter output_writer(output_stream_);
+    auto status = perfetto::trace_processor::json::ExportJson(
+        trace_processor_.get(), &output_writer, nullptr, nullptr, nullptr);
+    DCHECK(status.ok());
+  }
 
   if (listener_for_testing_) listener_for_testing_->ParseFromArray(trace);
 
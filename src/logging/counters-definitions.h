@@ -117,7 +117,9 @@ namespace internal {
   /* kPartialSuccessor kAbortedDuringSweeping. See */                          \
   /* ExternalPointerTable::TableCompactionOutcome enum for more details */     \
   HR(external_pointer_table_compaction_outcome,                                \
-     V8.ExternalPointerTableCompactionOutcome, 0, 2, 3)
+     V8.ExternalPointerTableCompactionOutcome, 0, 2, 3)                        \
+  /* Number of microtasks run per microtask checkpoint. */                     \
+  HR(microtasks_per_checkpoint, V8.MicrotasksPerCheckpoint, 1, 100000, 50)
 
 #define NESTED_TIMED_HISTOGRAM_LIST(HT)                                       \
   /* Nested timer histograms allow distributions of nested timed results. */  \
@@ -231,6 +233,8 @@ namespace internal {
      MICROSECOND)                                                              \
   HT(wasm_compile_after_deserialize,                                           \
      V8.WasmCompileAfterDeserializeMilliSeconds, 1000000, MILLISECOND)         \
+  HT(microtask_checkpoint, V8.MicrotaskCheckpointMicroSeconds, 1000000,        \
+     MICROSECOND)                                                              \
   /* Total compilation time incl. caching/parsing for various cache states. */ \
   HT(compile_script_with_produce_cache,                                        \
      V8.CompileScriptMicroSeconds.ProduceCache, 1000000, MICROSECOND)          \
@@ -300,16 +304,20 @@ namespace internal {
 // lines) rather than one macro (of length about 80 lines) to work around
 // this problem.  Please avoid using recursive macros of this length when
 // possible.
-#define STATS_COUNTER_LIST_1(SC)                                     \
-  /* Global Handle Count*/                                           \
-  SC(global_handles, V8.GlobalHandles)                               \
-  SC(alive_after_last_gc, V8.AliveAfterLastGC)                       \
-  SC(compilation_cache_hits, V8.CompilationCacheHits)                \
-  SC(compilation_cache_misses, V8.CompilationCacheMisses)            \
-  /* Number of times the cache contained a reusable Script but not   \
-     the root SharedFunctionInfo */                                  \
-  SC(compilation_cache_partial_hits, V8.CompilationCachePartialHits) \
-  SC(objs_since_last_young, V8.ObjsSinceLastYoung)                   \
+#define STATS_COUNTER_LIST_1(SC)                                      \
+  /* Global Handle Count*/                                            \
+  SC(global_handles, V8.GlobalHandles)                                \
+  SC(alive_after_last_gc, V8.AliveAfterLastGC)                        \
+  SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
+  SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
+  /* Number of times the cache contained a reusable Script but not    \
+     the root SharedFunctionInfo */                                   \
+  SC(compilation_cache_partial_hits, V8.CompilationCachePartialHits)  \
+  /* Number of times TurboFan code was installed for a                \
+     SharedFunctionInfo that already had TurboFan code installed for  \
+     another feedback vector (e.g. a closure in another context). */  \
+  SC(turbofan_shared_recompilations, V8.TurbofanSharedRecompilations) \
+  SC(objs_since_last_young, V8.ObjsSinceLastYoung)                    \
   SC(objs_since_last_full, V8.ObjsSinceLastFull)
 
 #define STATS_COUNTER_LIST_2(SC)                                               \
@@ -1811,8 +1811,13 @@ void V8FileLogger::RuntimeCallTimerEvent() {
 
 void V8FileLogger::TickEvent(TickSample* sample, bool overflow) {
   if (!v8_flags.prof_cpp) return;
-  if (V8_UNLIKELY(TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
-                  v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE)) {
+  unsigned runtime_stats =
+      TracingFlags::runtime_stats.load(std::memory_order_relaxed);
+  if (V8_UNLIKELY(
+          runtime_stats ==
+              v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE ||
+          runtime_stats ==
+              v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING)) {
     RuntimeCallTimerEvent();
   }
   MSG_BUILDER();
@@ -82,7 +82,12 @@ class RuntimeCallTimer final {
   void Snapshot();
 
   inline RuntimeCallTimer* Stop() {
-    if (!IsStarted()) return parent();
+    if (!IsStarted()) {
+      // In sampling mode the timer is never started, so only count the call;
+      // the time is attributed by the sampler walking the timer chain.
+      counter_->Increment();
+      return parent();
+    }
     base::TimeTicks now = RuntimeCallTimer::Now();
     Pause(now);
     counter_->Increment();
@@ -219,6 +224,7 @@ class RuntimeCallTimer final {
   V(Object_SetPrototype)                                   \
   V(ObjectTemplate_New)                                    \
   V(ObjectTemplate_NewInstance)                            \
+  V(ObjectTemplate_NewInstances)                           \
   V(Object_ToArrayIndex)                                   \
   V(Object_ToBigInt)                                       \
   V(Object_ToDetailString)                                 \
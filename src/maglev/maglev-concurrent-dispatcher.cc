@@ -4,6 +4,7 @@
 
 #include "src/maglev/maglev-concurrent-dispatcher.h"
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/codegen/compiler.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
@@ -195,8 +196,11 @@ void MaglevConcurrentDispatcher::EnqueueJob(
   job_handle_->NotifyConcurrencyIncrease();
 }
 
-void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
+void MaglevConcurrentDispatcher::FinalizeFinishedJobs(
+    base::TimeDelta budget) {
   HandleScope handle_scope(isolate_);
+  base::ElapsedTimer timer;
+  timer.Start();
   while (!outgoing_queue_.IsEmpty()) {
     std::unique_ptr<MaglevCompilationJob> job;
     outgoing_queue_.Dequeue(&job);
@@ -204,6 +208,12 @@ void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
                            "V8.MaglevConcurrentFinalize", job.get(),
                            TRACE_EVENT_FLAG_FLOW_IN);
     Compiler::FinalizeMaglevCompilationJob(job.get(), isolate_);
+    if (!outgoing_queue_.IsEmpty() && timer.Elapsed() > budget) {
+      // Spread the remaining jobs over later interrupts to avoid long pauses
+      // on the main thread when many jobs finish at once.
+      isolate_->stack_guard()->RequestInstallMaglevCode();
+      return;
+    }
   }
 }
 
@@ -9,6 +9,7 @@
 
 #include <memory>
 
+#include "src/base/platform/time.h"
 #include "src/codegen/compiler.h"  // For OptimizedCompilationJob.
 #include "src/utils/locked-queue.h"
 
@@ -86,8 +87,11 @@ class MaglevConcurrentDispatcher final {
   // Called from the main thread.
   void EnqueueJob(std::unique_ptr<MaglevCompilationJob>&& job);
 
-  // Called from the main thread.
-  void FinalizeFinishedJobs();
+  // Called from the main thread. Finalizes finished jobs until either none
+  // are left or {budget} is used up; in the latter case, another install
+  // interrupt is requested for the remaining jobs. At least one job is
+  // finalized per call.
+  void FinalizeFinishedJobs(base::TimeDelta budget = base::TimeDelta::Max());
 
   void AwaitCompileJobs();
 
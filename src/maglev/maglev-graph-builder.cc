@@ -459,6 +459,40 @@ MAP_OPERATION_TO_FLOAT64_NODE(SPECIALIZATION)
 
 template <Operation kOperation>
 using Float64NodeFor = typename Float64NodeForHelper<kOperation>::type;
+
+// Unary operations are built as binary operations with a constant right-hand
+// side: increment and decrement add and subtract 1, negation multiplies by -1
+// (which yields -0 for 0, as required), and bitwise not xors with -1. They
+// share the builders, and the folding, of the binary Smi operations.
+template <Operation kOperation>
+constexpr Operation BinaryOperationForUnaryOperation() {
+  switch (kOperation) {
+    case Operation::kIncrement:
+      return Operation::kAdd;
+    case Operation::kDecrement:
+      return Operation::kSubtract;
+    case Operation::kNegate:
+      return Operation::kMultiply;
+    case Operation::kBitwiseNot:
+      return Operation::kBitwiseXor;
+    default:
+      UNREACHABLE();
+  }
+}
+
+template <Operation kOperation>
+constexpr int32_t ConstantForUnaryOperation() {
+  switch (kOperation) {
+    case Operation::kIncrement:
+    case Operation::kDecrement:
+      return 1;
+    case Operation::kNegate:
+    case Operation::kBitwiseNot:
+      return -1;
+    default:
+      UNREACHABLE();
+  }
+}
 }  // namespace
 
 template <Operation kOperation>
@@ -584,7 +618,7 @@ void MaglevGraphBuilder::BuildTruncatingInt32BinaryOperationNodeForNumber() {
 }
 
 template <Operation kOperation>
-void MaglevGraphBuilder::BuildInt32BinarySmiOperationNode() {
+void MaglevGraphBuilder::BuildInt32BinarySmiOperationNode(int32_t constant) {
   // Truncating Int32 nodes treat their input as a signed int32 regardless
   // of whether it's really signed or not, so we allow Uint32 by loading a
   // TruncatedInt32 value.
@@ -593,7 +627,6 @@ void MaglevGraphBuilder::BuildInt32BinarySmiOperationNode() {
   // TODO(v8:7700): Do constant folding.
   ValueNode* left = inputs_are_truncated ? GetAccumulatorTruncatedInt32()
                                          : GetAccumulatorInt32();
-  int32_t constant = iterator_.GetImmediateOperand(0);
   if (base::Optional<int>(constant) == Int32Identity<kOperation>()) {
     // If the constant is the unit of the operation, it already has the right
     // value, so use the truncated value if necessary (and if not just a
@@ -626,12 +659,12 @@ void MaglevGraphBuilder::BuildInt32BinarySmiOperationNode() {
 }
 
 template <Operation kOperation>
-void MaglevGraphBuilder::BuildTruncatingInt32BinarySmiOperationNodeForNumber() {
+void MaglevGraphBuilder::BuildTruncatingInt32BinarySmiOperationNodeForNumber(
+    int32_t constant) {
   DCHECK(BinaryOperationIsBitwiseInt32<kOperation>());
   // TODO(v8:7700): Do constant folding.
   ValueNode* left =
       GetTruncatedInt32FromNumber(current_interpreter_frame_.accumulator());
-  int32_t constant = iterator_.GetImmediateOperand(0);
   if (base::Optional<int>(constant) == Int32Identity<kOperation>()) {
     // If the constant is the unit of the operation, it already has the right
     // value, so use the truncated value (if not just a conversion) and return.
@@ -650,11 +683,10 @@ void MaglevGraphBuilder::BuildTruncatingInt32BinarySmiOperationNodeForNumber() {
 }
 
 template <Operation kOperation>
-void MaglevGraphBuilder::BuildFloat64BinarySmiOperationNode() {
+void MaglevGraphBuilder::BuildFloat64BinarySmiOperationNode(int32_t constant) {
   // TODO(v8:7700): Do constant folding.
   ValueNode* left = GetAccumulatorFloat64();
-  double constant = static_cast<double>(iterator_.GetImmediateOperand(0));
-  ValueNode* right = GetFloat64Constant(constant);
+  ValueNode* right = GetFloat64Constant(static_cast<double>(constant));
   SetAccumulator(AddNewNode<Float64NodeFor<kOperation>>({left, right}));
 }
 
@@ -669,7 +701,37 @@ void MaglevGraphBuilder::BuildFloat64BinaryOperationNode() {
 
 template <Operation kOperation>
 void MaglevGraphBuilder::VisitUnaryOperation() {
-  // TODO(victorgomes): Use feedback info and create optimized versions.
+  // Avoid the generic nodes where possible: besides being slower, they have
+  // side effects, which flush the known loaded properties and context slots in
+  // every loop that increments its induction variable.
+  constexpr Operation kBinaryOperation =
+      BinaryOperationForUnaryOperation<kOperation>();
+  FeedbackNexus nexus = FeedbackNexusForOperand(0);
+  switch (nexus.GetBinaryOperationFeedback()) {
+    case BinaryOperationHint::kNone:
+      return EmitUnconditionalDeopt(
+          DeoptimizeReason::kInsufficientTypeFeedbackForUnaryOperation);
+    case BinaryOperationHint::kSignedSmall:
+      // Negating a Smi can produce -0, which the Int32 fast path can't
+      // represent.
+      if constexpr (kOperation != Operation::kNegate) {
+        return BuildInt32BinarySmiOperationNode<kBinaryOperation>(
+            ConstantForUnaryOperation<kOperation>());
+      }
+      [[fallthrough]];
+    case BinaryOperationHint::kSignedSmallInputs:
+    case BinaryOperationHint::kNumber:
+      if constexpr (BinaryOperationIsBitwiseInt32<kBinaryOperation>()) {
+        return BuildTruncatingInt32BinarySmiOperationNodeForNumber<
+            kBinaryOperation>(ConstantForUnaryOperation<kOperation>());
+      } else {
+        return BuildFloat64BinarySmiOperationNode<kBinaryOperation>(
+            ConstantForUnaryOperation<kOperation>());
+      }
+    default:
+      // Fallback to generic node.
+      break;
+  }
   BuildGenericUnaryOperationNode<kOperation>();
 }
 
@@ -710,17 +772,19 @@ void MaglevGraphBuilder::VisitBinarySmiOperation() {
           DeoptimizeReason::kInsufficientTypeFeedbackForBinaryOperation);
     case BinaryOperationHint::kSignedSmall:
       if constexpr (BinaryOperationHasInt32FastPath<kOperation>()) {
-        return BuildInt32BinarySmiOperationNode<kOperation>();
+        return BuildInt32BinarySmiOperationNode<kOperation>(
+            iterator_.GetImmediateOperand(0));
       }
       break;
     case BinaryOperationHint::kSignedSmallInputs:
     case BinaryOperationHint::kNumber:
       if constexpr (BinaryOperationHasFloat64FastPath<kOperation>()) {
-        return BuildFloat64BinarySmiOperationNode<kOperation>();
+        return BuildFloat64BinarySmiOperationNode<kOperation>(
+            iterator_.GetImmediateOperand(0));
       } else if constexpr (BinaryOperationHasInt32FastPath<kOperation>() &&
                            BinaryOperationIsBitwiseInt32<kOperation>()) {
         return BuildTruncatingInt32BinarySmiOperationNodeForNumber<
-            kOperation>();
+            kOperation>(iterator_.GetImmediateOperand(0));
       }
       break;
     default:
@@ -1941,6 +2005,21 @@ bool MaglevGraphBuilder::TryBuildPropertyStore(
   }
 }
 
+bool MaglevGraphBuilder::TryBuildPropertyTest(
+    compiler::PropertyAccessInfo const& access_info) {
+  // The access info factory doesn't produce property tests for dictionary
+  // mode holders.
+  DCHECK(!access_info.HasDictionaryHolder());
+  if (access_info.holder().has_value()) {
+    broker()->dependencies()->DependOnStablePrototypeChains(
+        access_info.lookup_start_object_maps(), kStartAtPrototype,
+        access_info.holder().value());
+  }
+
+  SetAccumulator(GetBooleanConstant(!access_info.IsNotFound()));
+  return true;
+}
+
 bool MaglevGraphBuilder::TryBuildPropertyAccess(
     ValueNode* receiver, ValueNode* lookup_start_object, compiler::NameRef name,
     compiler::PropertyAccessInfo const& access_info,
@@ -1955,8 +2034,7 @@ bool MaglevGraphBuilder::TryBuildPropertyAccess(
       DCHECK_EQ(receiver, lookup_start_object);
       return TryBuildPropertyStore(receiver, name, access_info, access_mode);
     case compiler::AccessMode::kHas:
-      // TODO(victorgomes): BuildPropertyTest.
-      return false;
+      return TryBuildPropertyTest(access_info);
   }
 }
 
@@ -2034,6 +2112,23 @@ bool MaglevGraphBuilder::TryBuildNamedAccess(
   }
 }
 
+bool MaglevGraphBuilder::TryBuildProxyNamedLoad(
+    ValueNode* object, compiler::NamedAccessFeedback const& feedback) {
+  // The trap can't be inlined, but for a monomorphic proxy the [[Get]]
+  // builtin can be called directly instead of going through the LoadIC.
+  if (!v8_flags.optimize_proxy_loads) return false;
+  if (feedback.maps().size() != 1) return false;
+  compiler::MapRef map = feedback.maps()[0];
+  if (!map.IsJSProxyMap() || map.is_deprecated()) return false;
+  if (feedback.name().object()->IsPrivate()) return false;
+
+  BuildCheckMaps(object, feedback.maps());
+  SetAccumulator(BuildCallBuiltin<Builtin::kProxyGetProperty>(
+      {object, GetConstant(feedback.name()), object,
+       GetSmiConstant(static_cast<int>(OnNonExistent::kReturnUndefined))}));
+  return true;
+}
+
 ValueNode* MaglevGraphBuilder::GetInt32ElementIndex(ValueNode* object) {
   switch (object->properties().value_representation()) {
     case ValueRepresentation::kTagged:
@@ -2225,6 +2320,9 @@ void MaglevGraphBuilder::VisitGetNamedProperty() {
                               compiler::AccessMode::kLoad)) {
         return;
       }
+      if (TryBuildProxyNamedLoad(object, processed_feedback.AsNamedAccess())) {
+        return;
+      }
       break;
     default:
       break;
@@ -3841,8 +3939,31 @@ void MaglevGraphBuilder::VisitTestIn() {
   FeedbackSlot slot = GetSlotOperand(1);
   compiler::FeedbackSource feedback_source{feedback(), slot};
 
-  // TODO(victorgomes): Create fast path using feedback.
-  USE(feedback_source);
+  const compiler::ProcessedFeedback& processed_feedback =
+      broker()->GetFeedbackForPropertyAccess(
+          feedback_source, compiler::AccessMode::kHas, base::nullopt);
+
+  switch (processed_feedback.kind()) {
+    case compiler::ProcessedFeedback::kInsufficient:
+      EmitUnconditionalDeopt(
+          DeoptimizeReason::kInsufficientTypeFeedbackForGenericKeyedAccess);
+      return;
+
+    case compiler::ProcessedFeedback::kNamedAccess: {
+      compiler::NameRef name_ref = processed_feedback.AsNamedAccess().name();
+      if (!BuildCheckValue(name, name_ref)) return;
+      if (TryBuildNamedAccess(object, object,
+                              processed_feedback.AsNamedAccess(),
+                              compiler::AccessMode::kHas)) {
+        return;
+      }
+      break;
+    }
+
+    default:
+      // TODO(victorgomes): Create fast path for element access feedback.
+      break;
+  }
 
   SetAccumulator(
       BuildCallBuiltin<Builtin::kKeyedHasIC>({object, name}, feedback_source));
@@ -4587,7 +4708,16 @@ void MaglevGraphBuilder::VisitSuspendGenerator() {
   interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
   uint32_t suspend_id = iterator_.GetUnsignedImmediateOperand(3);
 
-  int input_count = parameter_count_without_receiver() + args.register_count() +
+  // Like TurboFan, only store up to the last live register. Dead registers
+  // are never restored, so stale values in the trailing slots are harmless.
+  const compiler::BytecodeLivenessState* liveness = GetOutLiveness();
+  int register_count = args.register_count();
+  while (register_count > 0 &&
+         !liveness->RegisterIsLive(args[register_count - 1].index())) {
+    register_count--;
+  }
+
+  int input_count = parameter_count_without_receiver() + register_count +
                     GeneratorStore::kFixedInputCount;
   GeneratorStore* node = CreateNewNode<GeneratorStore>(
       input_count, context, generator, suspend_id, iterator_.current_offset());
@@ -4595,8 +4725,7 @@ void MaglevGraphBuilder::VisitSuspendGenerator() {
   for (int i = 1 /* skip receiver */; i < parameter_count(); ++i) {
     node->set_parameters_and_registers(arg_index++, GetTaggedArgument(i));
   }
-  const compiler::BytecodeLivenessState* liveness = GetOutLiveness();
-  for (int i = 0; i < args.register_count(); ++i) {
+  for (int i = 0; i < register_count; ++i) {
     ValueNode* value = liveness->RegisterIsLive(args[i].index())
                            ? GetTaggedValue(args[i])
                            : GetRootConstant(RootIndex::kOptimizedOut);
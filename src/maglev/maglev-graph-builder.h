@@ -1228,6 +1228,7 @@ class MaglevGraphBuilder {
   bool TryBuildPropertyStore(ValueNode* receiver, compiler::NameRef name,
                              compiler::PropertyAccessInfo const& access_info,
                              compiler::AccessMode access_mode);
+  bool TryBuildPropertyTest(compiler::PropertyAccessInfo const& access_info);
   bool TryBuildPropertyAccess(ValueNode* receiver,
                               ValueNode* lookup_start_object,
                               compiler::NameRef name,
@@ -1241,6 +1242,8 @@ class MaglevGraphBuilder {
   bool TryBuildNamedAccess(ValueNode* receiver, ValueNode* lookup_start_object,
                            compiler::NamedAccessFeedback const& feedback,
                            compiler::AccessMode access_mode);
+  bool TryBuildProxyNamedLoad(ValueNode* object,
+                              compiler::NamedAccessFeedback const& feedback);
   bool TryBuildElementAccess(ValueNode* object, ValueNode* index,
                              compiler::ElementAccessFeedback const& feedback);
 
@@ -1292,15 +1295,15 @@ class MaglevGraphBuilder {
   template <Operation kOperation>
   void BuildInt32BinaryOperationNode();
   template <Operation kOperation>
-  void BuildInt32BinarySmiOperationNode();
+  void BuildInt32BinarySmiOperationNode(int32_t constant);
   template <Operation kOperation>
   void BuildTruncatingInt32BinaryOperationNodeForNumber();
   template <Operation kOperation>
-  void BuildTruncatingInt32BinarySmiOperationNodeForNumber();
+  void BuildTruncatingInt32BinarySmiOperationNodeForNumber(int32_t constant);
   template <Operation kOperation>
   void BuildFloat64BinaryOperationNode();
   template <Operation kOperation>
-  void BuildFloat64BinarySmiOperationNode();
+  void BuildFloat64BinarySmiOperationNode(int32_t constant);
 
   template <Operation kOperation>
   void VisitUnaryOperation();
@@ -465,6 +465,17 @@ void GeneratorStore::GenerateCode(MaglevAssembler* masm,
         __ FromAnyToRegister(parameters_and_registers(i),
                              WriteBarrierDescriptor::SlotAddressRegister());
 
+    // Immortal immovable roots, e.g. the optimized-out marker stored for dead
+    // registers, never need a write barrier.
+    if (RootConstant* constant =
+            parameters_and_registers(i).node()->TryCast<RootConstant>()) {
+      if (RootsTable::IsImmortalImmovable(constant->index())) {
+        __ StoreTaggedField(
+            FieldOperand(array, FixedArray::OffsetOfElementAt(i)), value);
+        continue;
+      }
+    }
+
     ZoneLabelRef done(masm);
     DeferredCodeInfo* deferred_write_barrier = __ PushDeferredCode(
         [](MaglevAssembler* masm, ZoneLabelRef done, Register value,
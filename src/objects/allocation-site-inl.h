@@ -156,6 +156,16 @@ void AllocationSite::set_deopt_dependent_code(bool deopt) {
                      kRelaxedStore);
 }
 
+bool AllocationSite::previously_tenured() const {
+  return PreviouslyTenuredBit::decode(pretenure_data(kRelaxedLoad));
+}
+
+void AllocationSite::set_previously_tenured(bool value) {
+  int32_t value_data = pretenure_data(kRelaxedLoad);
+  set_pretenure_data(PreviouslyTenuredBit::update(value_data, value),
+                     kRelaxedStore);
+}
+
 int AllocationSite::memento_found_count() const {
   return MementoFoundCountBits::decode(pretenure_data(kRelaxedLoad));
 }
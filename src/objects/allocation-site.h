@@ -78,6 +78,7 @@ class AllocationSite : public Struct {
   using MementoFoundCountBits = base::BitField<int, 0, 26>;
   using PretenureDecisionBits = base::BitField<PretenureDecision, 26, 3>;
   using DeoptDependentCodeBit = base::BitField<bool, 29, 1>;
+  using PreviouslyTenuredBit = base::BitField<bool, 30, 1>;
   static_assert(PretenureDecisionBits::kMax >= kLastPretenureDecisionValue);
 
   // Increments the mementos found counter and returns true when the first
@@ -96,6 +97,13 @@ class AllocationSite : public Struct {
   inline bool deopt_dependent_code() const;
   inline void set_deopt_dependent_code(bool deopt);
 
+  // Set when a kTenure decision of this site was reset, e.g. because too many
+  // objects died in old space. Such sites may go back to kTenure without
+  // waiting for a maximum size young generation GC. The bit is kept across
+  // resets and is part of the site when it is serialized into a snapshot.
+  inline bool previously_tenured() const;
+  inline void set_previously_tenured(bool value);
+
   inline int memento_found_count() const;
   inline void set_memento_found_count(int count);
 
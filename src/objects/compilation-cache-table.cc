@@ -139,7 +139,11 @@ class EvalCacheKey : public HashTableKey {
   //   the effective source for the function, some of which is implicitly
   //   generated.
   // * shared is the shared function info for the function containing the call
-  //   to eval(). for dynamic functions, shared is the native context closure.
+  //   to eval(). For dynamic functions, shared is the native context's empty
+  //   function. Its SharedFunctionInfo comes from the startup object cache, so
+  //   all native contexts deserialized from the snapshot share it, and dynamic
+  //   functions with the same source hit the cache across native contexts
+  //   (each context still gets its own FeedbackCell).
   // * When positive, position is the position in the source where eval is
   //   called. When negative, position is the negation of the position in the
   //   dynamic function's effective source where the ')' ends the parameters.
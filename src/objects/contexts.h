@@ -116,6 +116,7 @@ enum ContextLookupFlags {
   V(ERROR_MESSAGE_FOR_WASM_CODE_GEN_INDEX, Object,                             \
     error_message_for_wasm_code_gen)                                           \
   V(ERRORS_THROWN_INDEX, Smi, errors_thrown)                                   \
+  V(LIVE_KB_AT_LAST_GC_INDEX, Smi, live_kb_at_last_gc)                         \
   V(EXTRAS_BINDING_OBJECT_INDEX, JSObject, extras_binding_object)              \
   V(FAST_ALIASED_ARGUMENTS_MAP_INDEX, Map, fast_aliased_arguments_map)         \
   V(FAST_TEMPLATE_INSTANTIATIONS_CACHE_INDEX, FixedArray,                      \
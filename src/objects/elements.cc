@@ -22,6 +22,7 @@
 #include "src/objects/js-shared-array-inl.h"
 #include "src/objects/keys.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/simd.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots.h"
 #include "src/utils/utils.h"
@@ -3121,6 +3122,47 @@ class TypedElementsAccessor
   using BackingStore = typename ElementsKindTraits<Kind>::BackingStore;
   using AccessorClass = TypedElementsAccessor<Kind, ElementType>;
 
+  // Element types for which searching can use the SIMD helpers.
+  static constexpr bool kHasVectorizedSearch =
+      std::is_same_v<ElementType, int32_t> ||
+      std::is_same_v<ElementType, uint32_t> ||
+      std::is_same_v<ElementType, int64_t> ||
+      std::is_same_v<ElementType, uint64_t> ||
+      std::is_same_v<ElementType, float> ||
+      std::is_same_v<ElementType, double>;
+
+  // Returns the index of the first element in [start_from, length) equal to
+  // {search_value}, or -1.
+  static int64_t SearchImpl(ElementType* data_ptr, size_t start_from,
+                            size_t length, ElementType search_value,
+                            IsSharedBuffer is_shared) {
+    if constexpr (sizeof(ElementType) == 1) {
+      // memchr is vectorized by the C library.
+      if (is_shared == kUnshared) {
+        if (start_from >= length) return -1;
+        const void* found = memchr(data_ptr + start_from,
+                                   static_cast<uint8_t>(search_value),
+                                   length - start_from);
+        if (found == nullptr) return -1;
+        return static_cast<const ElementType*>(found) - data_ptr;
+      }
+    }
+    if constexpr (kHasVectorizedSearch) {
+      if (is_shared == kUnshared &&
+          reinterpret_cast<uintptr_t>(data_ptr) % sizeof(ElementType) == 0) {
+        uintptr_t index =
+            TypedArrayIndexOf(data_ptr, length, start_from, search_value);
+        if (index == static_cast<uintptr_t>(-1)) return -1;
+        return static_cast<int64_t>(index);
+      }
+    }
+    for (size_t k = start_from; k < length; ++k) {
+      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
+      if (elem_k == search_value) return static_cast<int64_t>(k);
+    }
+    return -1;
+  }
+
   // Conversions from (other) scalar values.
   static ElementType FromScalar(int value) {
     return static_cast<ElementType>(value);
@@ -3476,11 +3518,8 @@ class TypedElementsAccessor
       }
     }
 
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just(true);
-    }
-    return Just(false);
+    return Just(SearchImpl(data_ptr, start_from, length, typed_search_value,
+                           is_shared) != -1);
   }
 
   static Maybe<int64_t> IndexOfValueImpl(Isolate* isolate,
@@ -3540,11 +3579,8 @@ class TypedElementsAccessor
     }
 
     auto is_shared = typed_array.buffer().is_shared() ? kShared : kUnshared;
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just<int64_t>(k);
-    }
-    return Just<int64_t>(-1);
+    return Just<int64_t>(SearchImpl(data_ptr, start_from, length,
+                                    typed_search_value, is_shared));
   }
 
   static Maybe<int64_t> LastIndexOfValueImpl(Handle<JSObject> receiver,
@@ -3704,6 +3740,19 @@ class TypedElementsAccessor
                                        ElementType* dest_data_ptr,
                                        size_t length,
                                        IsSharedBuffer is_shared) {
+    if (is_shared == kUnshared &&
+        reinterpret_cast<uintptr_t>(source_data_ptr) %
+                alignof(SourceElementType) ==
+            0 &&
+        reinterpret_cast<uintptr_t>(dest_data_ptr) % alignof(ElementType) ==
+            0) {
+      // Plain loads and stores, which lets the compiler vectorize the
+      // conversions that don't need branches.
+      for (size_t i = 0; i < length; i++) {
+        dest_data_ptr[i] = FromScalar(source_data_ptr[i]);
+      }
+      return;
+    }
     for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
       // We use scalar accessors to avoid boxing/unboxing, so there are no
       // allocations.
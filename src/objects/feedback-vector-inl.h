@@ -194,6 +194,14 @@ void FeedbackVector::set_maybe_has_turbofan_code(bool value) {
   set_flags(MaybeHasTurbofanCodeBit::update(flags(), value));
 }
 
+bool FeedbackVector::was_turbofan_optimized() const {
+  return WasTurbofanOptimizedBit::decode(flags());
+}
+
+void FeedbackVector::set_was_turbofan_optimized(bool value) {
+  set_flags(WasTurbofanOptimizedBit::update(flags(), value));
+}
+
 bool FeedbackVector::log_next_execution() const {
   return LogNextExecutionBit::decode(flags());
 }
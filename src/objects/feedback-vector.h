@@ -267,6 +267,9 @@ class FeedbackVector
   inline void set_maybe_has_maglev_code(bool value);
   inline bool maybe_has_turbofan_code() const;
   inline void set_maybe_has_turbofan_code(bool value);
+  // Whether TurboFan code was ever installed on this vector.
+  inline bool was_turbofan_optimized() const;
+  inline void set_was_turbofan_optimized(bool value = true);
 
   void SetOptimizedCode(CodeT code);
   void EvictOptimizedCodeMarkedForDeoptimization(SharedFunctionInfo shared,
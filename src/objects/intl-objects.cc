@@ -9,6 +9,7 @@
 #include "src/objects/intl-objects.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,6 +49,8 @@
 #include "unicode/numfmt.h"
 #include "unicode/numsys.h"
 #include "unicode/timezone.h"
+#include "unicode/tzrule.h"
+#include "unicode/tztrans.h"
 #include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/uvernum.h"  // U_ICU_VERSION_MAJOR_NUM
@@ -2560,6 +2563,9 @@ class ICUTimezoneCache : public base::TimezoneCache {
 
   double LocalTimeOffset(double time_ms, bool is_utc) override;
 
+  bool NextLocalTimeOffsetTransition(double time_ms, bool is_utc,
+                                     double* transition_ms) override;
+
   void Clear(TimeZoneDetection time_zone_detection) override;
 
  private:
@@ -2625,6 +2631,38 @@ double ICUTimezoneCache::LocalTimeOffset(double time_ms, bool is_utc) {
   return raw_offset + dst_offset;
 }
 
+bool ICUTimezoneCache::NextLocalTimeOffsetTransition(double time_ms,
+                                                     bool is_utc,
+                                                     double* transition_ms) {
+  const icu::BasicTimeZone* timezone =
+      static_cast<const icu::BasicTimeZone*>(GetTimeZone());
+  // A UTC transition from offset a to offset b shows up in local time at
+  // the transition plus max(a, b), since GetOffsets resolves skipped and
+  // repeated local times to the former offset. Start early enough to find
+  // the UTC transition for the first local one after time_ms.
+  const double kMaxOffsetMs = 2 * 24 * 3600 * 1000.0;
+  UDate base = is_utc ? time_ms : time_ms - kMaxOffsetMs;
+  icu::TimeZoneTransition transition;
+  while (timezone->getNextTransition(base, false, transition)) {
+    base = transition.getTime();
+    const icu::TimeZoneRule* from = transition.getFrom();
+    const icu::TimeZoneRule* to = transition.getTo();
+    if (from == nullptr || to == nullptr) return false;
+    int32_t from_offset = from->getRawOffset() + from->getDSTSavings();
+    int32_t to_offset = to->getRawOffset() + to->getDSTSavings();
+    // Skip transitions that only change the name or the split between raw
+    // and DST offset.
+    if (from_offset == to_offset) continue;
+    double at = is_utc ? base : base + std::max(from_offset, to_offset);
+    if (at > time_ms) {
+      *transition_ms = at;
+      return true;
+    }
+  }
+  *transition_ms = std::numeric_limits<double>::infinity();
+  return true;
+}
+
 void ICUTimezoneCache::Clear(TimeZoneDetection time_zone_detection) {
   delete timezone_;
   timezone_ = nullptr;
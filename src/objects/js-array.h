@@ -102,6 +102,21 @@ class JSArray : public TorqueGeneratedJSArray<JSArray, JSObject> {
                                                    Address raw_separator,
                                                    Address raw_dest);
 
+  // Helpers for joining the first {length} elements of a FixedArray of Smis,
+  // e.g. the elements of a PACKED_SMI_ELEMENTS array. The first returns the
+  // number of characters of the elements' decimal representations, without
+  // separators. The second writes the elements and separators into {raw_dest},
+  // which must have exactly the resulting length.
+  // Like ArrayJoinConcatToSequentialString, these are called via
+  // ExternalReferences and don't allocate.
+  static intptr_t ArrayJoinSmisLength(Address raw_fixed_array,
+                                      intptr_t length);
+  static Address ArrayJoinSmisToSequentialString(Isolate* isolate,
+                                                 Address raw_fixed_array,
+                                                 intptr_t length,
+                                                 Address raw_separator,
+                                                 Address raw_dest);
+
   // Checks whether the Array has the current realm's Array.prototype as its
   // prototype. This function is best-effort and only gives a conservative
   // approximation, erring on the side of false, in particular with respect
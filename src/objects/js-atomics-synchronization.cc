@@ -324,15 +324,30 @@ void JSAtomicsMutex::LockSlowPath(Isolate* requester,
     // Spin for a little bit to try to acquire the lock, so as to be fast under
     // microcontention.
     //
-    // The backoff algorithm is copied from PartitionAlloc's SpinningMutex.
-    constexpr int kSpinCount = 64;
+    // The backoff algorithm is copied from PartitionAlloc's SpinningMutex. The
+    // spin budget adapts to how long it recently took to acquire this mutex by
+    // spinning, similar to glibc's PTHREAD_MUTEX_ADAPTIVE_NP: the estimate
+    // moves 1/8th of the way towards the spins needed this time. If spinning
+    // failed and the thread has to park anyway, the estimate decays instead,
+    // so that long critical sections fall back to the minimal spin budget.
+    constexpr int kMinSpinCount = 64;
+    constexpr int kMaxSpinCount = 1024;
     constexpr int kMaxBackoff = 16;
 
+    std::atomic<int32_t>* spin_count_estimate =
+        mutex->AtomicSpinCountEstimatePtr();
+    int estimate = spin_count_estimate->load(std::memory_order_relaxed);
+    int spin_count = std::min(kMaxSpinCount, 2 * estimate + kMinSpinCount);
+
     int tries = 0;
     int backoff = 1;
     StateT current_state = state->load(std::memory_order_relaxed);
     do {
-      if (TryLockExplicit(state, current_state)) return;
+      if (TryLockExplicit(state, current_state)) {
+        spin_count_estimate->store(estimate + (tries - estimate) / 8,
+                                   std::memory_order_relaxed);
+        return;
+      }
 
       for (int yields = 0; yields < backoff; yields++) {
         YIELD_PROCESSOR;
@@ -340,7 +355,9 @@ void JSAtomicsMutex::LockSlowPath(Isolate* requester,
       }
 
       backoff = std::min(kMaxBackoff, backoff << 1);
-    } while (tries < kSpinCount);
+    } while (tries < spin_count);
+    spin_count_estimate->store(estimate - estimate / 8,
+                               std::memory_order_relaxed);
 
     // At this point the lock is considered contended, so try to go to sleep and
     // put the requester thread on the waiter queue.
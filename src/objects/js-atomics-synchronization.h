@@ -53,10 +53,15 @@ class JSSynchronizationPrimitive
 // A non-recursive mutex that is exposed to JS.
 //
 // It has the following properties:
-//   - Slim: 8-12 bytes. Lock state is 4 bytes when V8_COMPRESS_POINTERS, and
-//     sizeof(void*) otherwise. Owner thread is an additional 4 bytes.
+//   - Slim: 12-16 bytes. Lock state is 4 bytes when V8_COMPRESS_POINTERS, and
+//     sizeof(void*) otherwise. Owner thread and the spin count estimate are an
+//     additional 4 bytes each.
 //   - Fast when uncontended: a single weak CAS.
 //   - Possibly unfair under contention.
+//   - Adaptive spinning under contention: before parking, the slow path spins
+//     for up to about twice the number of spins it recently took to acquire
+//     the lock by spinning, so short critical sections don't pay for context
+//     switches.
 //   - Moving GC safe. It uses an index into the shared Isolate's external
 //     pointer table to store a queue of sleeping threads.
 //   - Parks the main thread LocalHeap when the thread is blocked on acquiring
@@ -144,6 +149,7 @@ class JSAtomicsMutex
   inline void ClearOwnerThread();
 
   inline std::atomic<int32_t>* AtomicOwnerThreadIdPtr();
+  inline std::atomic<int32_t>* AtomicSpinCountEstimatePtr();
 
   static bool TryLockExplicit(std::atomic<StateT>* state, StateT& expected);
   static bool TryLockWaiterQueueExplicit(std::atomic<StateT>* state,
@@ -159,6 +165,10 @@ class JSAtomicsMutex
       JSAtomicsMutex, JSSynchronizationPrimitive>::owner_thread_id;
   using TorqueGeneratedJSAtomicsMutex<
       JSAtomicsMutex, JSSynchronizationPrimitive>::set_owner_thread_id;
+  using TorqueGeneratedJSAtomicsMutex<
+      JSAtomicsMutex, JSSynchronizationPrimitive>::spin_count_estimate;
+  using TorqueGeneratedJSAtomicsMutex<
+      JSAtomicsMutex, JSSynchronizationPrimitive>::set_spin_count_estimate;
 };
 
 // A condition variable that is exposed to JS.
@@ -9,6 +9,7 @@
 #include "src/objects/js-date-time-format.h"
 
 #include <algorithm>
+#include <list>
 #include <map>
 #include <memory>
 #include <string>
@@ -1915,21 +1916,34 @@ class DateFormatCache {
     base::MutexGuard guard(&mutex_);
     auto it = map_.find(key);
     if (it != map_.end()) {
-      return static_cast<icu::SimpleDateFormat*>(it->second->clone());
+      // Move the entry to the front of the recently used list.
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return static_cast<icu::SimpleDateFormat*>(it->second->second->clone());
     }
 
-    if (map_.size() > 8) {  // Cache at most 8 DateFormats.
-      map_.clear();
-    }
     std::unique_ptr<icu::SimpleDateFormat> instance(
         CreateICUDateFormat(icu_locale, skeleton, generator, hc));
     if (instance.get() == nullptr) return nullptr;
-    map_[key] = std::move(instance);
-    return static_cast<icu::SimpleDateFormat*>(map_[key]->clone());
+    // Evict the least recently used DateFormat.
+    if (entries_.size() == kMaxEntries) {
+      map_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(key, std::move(instance));
+    map_[key] = entries_.begin();
+    return static_cast<icu::SimpleDateFormat*>(
+        entries_.front().second->clone());
   }
 
  private:
-  std::map<std::string, std::unique_ptr<icu::SimpleDateFormat>> map_;
+  // Cache at most this many DateFormats, keyed by skeleton and locale.
+  static constexpr size_t kMaxEntries = 16;
+
+  using Entry =
+      std::pair<std::string, std::unique_ptr<icu::SimpleDateFormat>>;
+  // Most recently used first.
+  std::list<Entry> entries_;
+  std::map<std::string, std::list<Entry>::iterator> map_;
   base::Mutex mutex_;
 };
 
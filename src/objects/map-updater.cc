@@ -424,8 +424,19 @@ void MapUpdater::CompleteInobjectSlackTracking(Isolate* isolate,
   // Has to be an initial map.
   DCHECK(initial_map.GetBackPointer().IsUndefined(isolate));
 
-  const int slack = initial_map.ComputeMinObjectSlack(isolate);
+  int slack = initial_map.ComputeMinObjectSlack(isolate);
   DCHECK_GE(slack, 0);
+  if (v8_flags.slack_tracking_growth_reserve && slack != 0 &&
+      initial_map.GetConstructor().IsJSFunction()) {
+    // If objects got more fields than the constructor is expected to add,
+    // they are likely to keep growing after construction, so keep as much
+    // room again for them instead of letting them spill into a PropertyArray.
+    const int expected = JSFunction::cast(initial_map.GetConstructor())
+                             .shared()
+                             .expected_nof_properties();
+    const int growth = initial_map.ComputeMaxNumberOfFields(isolate) - expected;
+    if (growth > 0) slack -= std::min(slack, growth);
+  }
 
   TransitionsAccessor transitions(isolate, initial_map);
   TransitionsAccessor::TraverseCallback callback;
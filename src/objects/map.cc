@@ -2197,6 +2197,21 @@ int Map::ComputeMinObjectSlack(Isolate* isolate) {
   return slack;
 }
 
+int Map::ComputeMaxNumberOfFields(Isolate* isolate) {
+  // Has to be an initial map.
+  DCHECK(GetBackPointer().IsUndefined(isolate));
+
+  int max_fields = NumberOfFields(ConcurrencyMode::kSynchronous);
+  TransitionsAccessor transitions(isolate, *this);
+  TransitionsAccessor::TraverseCallback callback = [&](Map map) {
+    if (map.is_deprecated()) return;
+    max_fields =
+        std::max(max_fields, map.NumberOfFields(ConcurrencyMode::kSynchronous));
+  };
+  transitions.TraverseTransitionTree(callback);
+  return max_fields;
+}
+
 void Map::SetInstanceDescriptors(Isolate* isolate, DescriptorArray descriptors,
                                  int number_of_own_descriptors) {
   set_instance_descriptors(descriptors, kReleaseStore);
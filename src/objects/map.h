@@ -341,6 +341,11 @@ class Map : public TorqueGeneratedMap<Map, HeapObject> {
   //   of every map. Existing objects will resize automatically (they are
   //   filled with one_pointer_filler_map). All further allocations will
   //   use the adjusted instance size.
+  // - With --slack-tracking-growth-reserve, part of the slack is kept when the
+  //   transition tree shows that objects gained more properties than the
+  //   constructor is expected to add, on the assumption that such objects keep
+  //   growing after the tracking completes. The instance size of existing
+  //   objects can only shrink, so tracking is never re-opened.
   // - SharedFunctionInfo's expected_nof_properties left unmodified since
   //   allocations made using different closures could actually create different
   //   kind of objects (see prototype inheritance pattern).
@@ -364,6 +369,9 @@ class Map : public TorqueGeneratedMap<Map, HeapObject> {
   // Computes inobject slack for the transition tree starting at this initial
   // map.
   int ComputeMinObjectSlack(Isolate* isolate);
+  // Computes the largest number of fields of any map in the transition tree
+  // starting at this initial map.
+  int ComputeMaxNumberOfFields(Isolate* isolate);
   inline int InstanceSizeFromSlack(int slack) const;
 
   // Tells whether the object in the prototype property will be used
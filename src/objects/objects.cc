@@ -44,6 +44,7 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/allocation-site-scopes.h"
 #include "src/objects/api-callbacks.h"
@@ -4785,6 +4786,83 @@ Address JSArray::ArrayJoinConcatToSequentialString(Isolate* isolate,
   return dest.ptr();
 }
 
+namespace {
+
+constexpr int kSmiToCStringBufferSize = 16;
+
+template <typename sinkchar>
+void WriteSmisToFlat(FixedArray fixed_array, int length, String separator,
+                     sinkchar* sink, int sink_length) {
+  DisallowGarbageCollection no_gc;
+  CHECK_GT(length, 0);
+  CHECK_LE(length, fixed_array.length());
+  sinkchar* sink_end = sink + sink_length;
+  const int separator_length = separator.length();
+  char buffer[kSmiToCStringBufferSize];
+  for (int i = 0; i < length; i++) {
+    if (i > 0 && separator_length > 0) {
+      DCHECK_LE(sink + separator_length, sink_end);
+      String::WriteToFlat(separator, sink, 0, separator_length);
+      sink += separator_length;
+    }
+    const char* digits = IntToCString(Smi::ToInt(fixed_array.get(i)),
+                                      base::ArrayVector(buffer));
+    const int digits_length =
+        static_cast<int>(buffer + kSmiToCStringBufferSize - 1 - digits);
+    CHECK_LE(sink + digits_length, sink_end);
+    CopyChars(sink, reinterpret_cast<const uint8_t*>(digits), digits_length);
+    sink += digits_length;
+  }
+  CHECK_EQ(sink, sink_end);
+}
+
+}  // namespace
+
+// static
+intptr_t JSArray::ArrayJoinSmisLength(Address raw_fixed_array,
+                                      intptr_t length) {
+  DisallowGarbageCollection no_gc;
+  FixedArray fixed_array = FixedArray::cast(Object(raw_fixed_array));
+  DCHECK_LE(length, fixed_array.length());
+  intptr_t result = 0;
+  for (int i = 0; i < static_cast<int>(length); i++) {
+    int value = Smi::ToInt(fixed_array.get(i));
+    // Count the sign and the digits.
+    uint32_t magnitude = value < 0 ? 0u - static_cast<uint32_t>(value)
+                                   : static_cast<uint32_t>(value);
+    result += value < 0 ? 2 : 1;
+    while (magnitude >= 10) {
+      magnitude /= 10;
+      result++;
+    }
+  }
+  return result;
+}
+
+// static
+Address JSArray::ArrayJoinSmisToSequentialString(Isolate* isolate,
+                                                 Address raw_fixed_array,
+                                                 intptr_t length,
+                                                 Address raw_separator,
+                                                 Address raw_dest) {
+  DisallowGarbageCollection no_gc;
+  DisallowJavascriptExecution no_js(isolate);
+  FixedArray fixed_array = FixedArray::cast(Object(raw_fixed_array));
+  String separator = String::cast(Object(raw_separator));
+  String dest = String::cast(Object(raw_dest));
+  if (StringShape(dest).IsSequentialOneByte()) {
+    WriteSmisToFlat(fixed_array, static_cast<int>(length), separator,
+                    SeqOneByteString::cast(dest).GetChars(no_gc),
+                    dest.length());
+  } else {
+    DCHECK(StringShape(dest).IsSequentialTwoByte());
+    WriteSmisToFlat(fixed_array, static_cast<int>(length), separator,
+                    SeqTwoByteString::cast(dest).GetChars(no_gc),
+                    dest.length());
+  }
+  return dest.ptr();
+}
+
 uint32_t StringHasher::MakeArrayIndexHash(uint32_t value, int length) {
   // For array indexes mix the length into the hash as an array index could
   // be zero.
@@ -5324,6 +5402,7 @@ bool JSArray::SetLengthWouldNormalize(uint32_t new_length) {
 const double AllocationSite::kPretenureRatio = 0.85;
 
 void AllocationSite::ResetPretenureDecision() {
+  if (pretenure_decision() == kTenure) set_previously_tenured(true);
   set_pretenure_decision(kUndecided);
   set_memento_found_count(0);
   set_memento_create_count(0);
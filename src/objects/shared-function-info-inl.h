@@ -270,6 +270,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compilation_failed,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, sparkplug_compiled,
                     SharedFunctionInfo::SparkplugCompiledBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, turbofan_compiled,
+                    SharedFunctionInfo::TurbofanCompiledBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -641,6 +644,11 @@ bool SharedFunctionInfo::ShouldFlushCode(
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
+  if (IsReduceMemoryFlushingEnabled(code_flush_mode) &&
+      bytecode.bytecode_age() >=
+          v8_flags.bytecode_old_age_for_memory_reduction) {
+    return true;
+  }
   return bytecode.IsOld();
 }
 
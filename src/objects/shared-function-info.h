@@ -453,6 +453,12 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(sparkplug_compiled)
 
+  // True if TurboFan code has been installed for at least one closure of this
+  // function. Closures created in different native contexts don't share
+  // feedback vectors, and hence don't share optimized code either; this bit
+  // is used to detect (and count) such redundant optimizations.
+  DECL_BOOLEAN_ACCESSORS(turbofan_compiled)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
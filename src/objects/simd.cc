@@ -150,6 +150,17 @@ inline int32_t reinterpret_vmaxvq_u64(uint64x2_t v) {
     }                                                                         \
   }
 
+#ifdef __SSE3__
+// _mm_cmpeq_epi64 needs SSE4.1, so compare the 32-bit halves and combine them.
+// Comparing as doubles would be wrong, since NaN bit patterns never compare
+// equal and +0 compares equal to -0.
+inline __m128d cmpeq_epi64_sse2(__m128i a, __m128i b) {
+  __m128i eq32 = _mm_cmpeq_epi32(a, b);
+  __m128i swapped = _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1));
+  return _mm_castsi128_pd(_mm_and_si128(eq32, swapped));
+}
+#endif  // __SSE3__
+
 // Uses SIMD to vectorize the search loop. This function should only be called
 // for large-ish arrays. Note that nothing will break if |array_len| is less
 // than vectorization_threshold: things will just be slower than necessary.
@@ -162,8 +173,10 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
       sizeof(T) == sizeof(uint64_t) && std::is_integral<T>::value;
   static constexpr bool is_double =
       sizeof(T) == sizeof(double) && std::is_floating_point<T>::value;
+  static constexpr bool is_float =
+      sizeof(T) == sizeof(float) && std::is_floating_point<T>::value;
 
-  static_assert(is_uint32 || is_uint64 || is_double);
+  static_assert(is_uint32 || is_uint64 || is_double || is_float);
 
 #if !(defined(__SSE3__) || defined(NEON64))
   // No SIMD available.
@@ -199,17 +212,19 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
 #undef MOVEMASK
 #undef EXTRACT
   } else if constexpr (is_uint64) {
-#define SET1(x) _mm_castsi128_ps(_mm_set1_epi64x(x))
-#define CMP(a, b) _mm_cmpeq_pd(_mm_castps_pd(a), _mm_castps_pd(b))
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
-    VECTORIZED_LOOP_x86(__m128, __m128d, SET1, CMP, _mm_movemask_pd, EXTRACT)
-#undef SET1
-#undef CMP
+    VECTORIZED_LOOP_x86(__m128i, __m128d, _mm_set1_epi64x, cmpeq_epi64_sse2,
+                        _mm_movemask_pd, EXTRACT)
 #undef EXTRACT
   } else if constexpr (is_double) {
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
     VECTORIZED_LOOP_x86(__m128d, __m128d, _mm_set1_pd, _mm_cmpeq_pd,
                         _mm_movemask_pd, EXTRACT)
+#undef EXTRACT
+  } else if constexpr (is_float) {
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m128, __m128, _mm_set1_ps, _mm_cmpeq_ps,
+                        _mm_movemask_ps, EXTRACT)
 #undef EXTRACT
   }
 #elif defined(NEON64)
@@ -222,6 +237,9 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
   } else if constexpr (is_double) {
     VECTORIZED_LOOP_Neon(float64x2_t, uint64x2_t, vdupq_n_f64, vceqq_f64,
                          reinterpret_vmaxvq_u64)
+  } else if constexpr (is_float) {
+    VECTORIZED_LOOP_Neon(float32x4_t, uint32x4_t, vdupq_n_f32, vceqq_f32,
+                         vmaxvq_u32)
   }
 #else
   UNREACHABLE();
@@ -259,8 +277,10 @@ TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
       sizeof(T) == sizeof(uint64_t) && std::is_integral<T>::value;
   static constexpr bool is_double =
       sizeof(T) == sizeof(double) && std::is_floating_point<T>::value;
+  static constexpr bool is_float =
+      sizeof(T) == sizeof(float) && std::is_floating_point<T>::value;
 
-  static_assert(is_uint32 || is_uint64 || is_double);
+  static_assert(is_uint32 || is_uint64 || is_double || is_float);
 
   const int target_align = 32;
   // Scalar loop to reach desired alignment
@@ -294,6 +314,13 @@ TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
     VECTORIZED_LOOP_x86(__m256d, __m256d, _mm256_set1_pd, CMP,
                         _mm256_movemask_pd, EXTRACT)
 #undef CMP
+#undef EXTRACT
+  } else if constexpr (is_float) {
+#define CMP(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m256, __m256, _mm256_set1_ps, CMP,
+                        _mm256_movemask_ps, EXTRACT)
+#undef CMP
 #undef EXTRACT
   }
 
@@ -419,6 +446,28 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
       array_start, array_len, from_index, search_element);
 }
 
+template <typename T>
+uintptr_t TypedArrayIndexOf(const T* array, uintptr_t array_len,
+                            uintptr_t from_index, T search_element) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(array) % sizeof(T));
+  if (from_index >= array_len) return -1;
+  return search<T>(const_cast<T*>(array), array_len, from_index,
+                   search_element);
+}
+
+template uintptr_t TypedArrayIndexOf<int32_t>(const int32_t*, uintptr_t,
+                                              uintptr_t, int32_t);
+template uintptr_t TypedArrayIndexOf<uint32_t>(const uint32_t*, uintptr_t,
+                                               uintptr_t, uint32_t);
+template uintptr_t TypedArrayIndexOf<int64_t>(const int64_t*, uintptr_t,
+                                              uintptr_t, int64_t);
+template uintptr_t TypedArrayIndexOf<uint64_t>(const uint64_t*, uintptr_t,
+                                               uintptr_t, uint64_t);
+template uintptr_t TypedArrayIndexOf<double>(const double*, uintptr_t,
+                                             uintptr_t, double);
+template uintptr_t TypedArrayIndexOf<float>(const float*, uintptr_t, uintptr_t,
+                                            float);
+
 #ifdef NEON64
 #undef NEON64
 #endif
@@ -20,6 +20,15 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
                                      uintptr_t from_index,
                                      Address search_element);
 
+// Returns the index of the first element of |array| at or after |from_index|
+// that is equal to |search_element|, or -1 if there is none. Uses SIMD when
+// available. |array| must be aligned to sizeof(T) and must not be concurrently
+// modified (i.e. it must not be backed by a SharedArrayBuffer). T is one of
+// int32_t, uint32_t, int64_t, uint64_t, float and double.
+template <typename T>
+uintptr_t TypedArrayIndexOf(const T* array, uintptr_t array_len,
+                            uintptr_t from_index, T search_element);
+
 }  // namespace internal
 }  // namespace v8
 
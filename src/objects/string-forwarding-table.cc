@@ -134,27 +134,42 @@ void StringForwardingTable::InitializeBlockVector() {
 }
 
 StringForwardingTable::BlockVector* StringForwardingTable::EnsureCapacity(
-    uint32_t block_index) {
+    uint32_t block_index, uint32_t index_in_block) {
   BlockVector* blocks = blocks_.load(std::memory_order_acquire);
   if (V8_UNLIKELY(block_index >= blocks->size())) {
-    base::MutexGuard table_grow_guard(&grow_mutex_);
-    // Reload the vector, as another thread could have grown it.
-    blocks = blocks_.load(std::memory_order_relaxed);
-    // Check again if we need to grow under lock.
-    if (block_index >= blocks->size()) {
-      // Grow the vector if the block to insert is greater than the vectors
-      // capacity.
-      if (block_index >= blocks->capacity()) {
-        std::unique_ptr<BlockVector> new_blocks =
-            BlockVector::Grow(blocks, blocks->capacity() * 2, grow_mutex_);
-        block_vector_storage_.push_back(std::move(new_blocks));
-        blocks = block_vector_storage_.back().get();
-        blocks_.store(blocks, std::memory_order_release);
-      }
-      const uint32_t capacity = CapacityForBlock(block_index);
-      std::unique_ptr<Block> new_block = Block::New(capacity);
-      blocks->AddBlock(std::move(new_block));
+    return Grow(block_index);
+  }
+  // The thread that takes the middle record of the last block allocates the
+  // next block ahead of time. Other threads filling up the current block thus
+  // never have to wait for the grow mutex.
+  if (V8_UNLIKELY(block_index + 1 == blocks->size() &&
+                  index_in_block == CapacityForBlock(block_index) / 2)) {
+    Grow(block_index + 1);
+  }
+  return blocks;
+}
+
+StringForwardingTable::BlockVector* StringForwardingTable::Grow(
+    uint32_t block_index) {
+  base::MutexGuard table_grow_guard(&grow_mutex_);
+  // Reload the vector, as another thread could have grown it.
+  BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
+  // Check again if we need to grow under lock. Blocks are added in order, so
+  // all blocks up to |block_index| are created.
+  while (block_index >= blocks->size()) {
+    // Grow the vector if the block to insert is greater than the vectors
+    // capacity.
+    if (blocks->size() >= blocks->capacity()) {
+      std::unique_ptr<BlockVector> new_blocks =
+          BlockVector::Grow(blocks, blocks->capacity() * 2, grow_mutex_);
+      block_vector_storage_.push_back(std::move(new_blocks));
+      blocks = block_vector_storage_.back().get();
+      blocks_.store(blocks, std::memory_order_release);
     }
+    const uint32_t capacity =
+        CapacityForBlock(static_cast<uint32_t>(blocks->size()));
+    std::unique_ptr<Block> new_block = Block::New(capacity);
+    blocks->AddBlock(std::move(new_block));
   }
   return blocks;
 }
@@ -168,7 +183,7 @@ int StringForwardingTable::AddForwardString(String string, String forward_to) {
   uint32_t index_in_block;
   const uint32_t block_index = BlockForIndex(index, &index_in_block);
 
-  BlockVector* blocks = EnsureCapacity(block_index);
+  BlockVector* blocks = EnsureCapacity(block_index, index_in_block);
   Block* block = blocks->LoadBlock(block_index, kAcquireLoad);
   block->record(index_in_block)->SetInternalized(string, forward_to);
   return index;
@@ -196,7 +211,7 @@ int StringForwardingTable::AddExternalResourceAndHash(String string,
   uint32_t index_in_block;
   const uint32_t block_index = BlockForIndex(index, &index_in_block);
 
-  BlockVector* blocks = EnsureCapacity(block_index);
+  BlockVector* blocks = EnsureCapacity(block_index, index_in_block);
   Block* block = blocks->LoadBlock(block_index, kAcquireLoad);
   block->record(index_in_block)
       ->SetExternal(string, resource, is_one_byte, raw_hash);
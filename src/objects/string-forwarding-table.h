@@ -83,8 +83,11 @@ class StringForwardingTable {
   // Ensure that |block| exists in the BlockVector already. If not, a new block
   // is created (with capacity double the capacity of the last block) and
   // inserted into the BlockVector. The BlockVector itself might grow (to double
-  // the capacity).
-  BlockVector* EnsureCapacity(uint32_t block);
+  // the capacity). Once half of the last block is in use, the next block is
+  // created ahead of time.
+  BlockVector* EnsureCapacity(uint32_t block, uint32_t index_in_block);
+  // Creates all blocks up to and including |block| under the grow mutex.
+  BlockVector* Grow(uint32_t block);
 
   Isolate* isolate_;
   std::atomic<BlockVector*> blocks_;
@@ -5,6 +5,7 @@
 #include "src/objects/string-table.h"
 
 #include <atomic>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -631,6 +632,61 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   }
 }
 
+template <typename StringTableKey, typename IsolateT>
+void StringTable::LookupKeys(IsolateT* isolate,
+                             base::Vector<StringTableKey*> keys,
+                             Handle<String>* results) {
+  // See {LookupKey} for why the optimistic reads without the lock are safe.
+  // The data is reloaded for every key because preparing a key for insertion
+  // may allocate, and a GC may free a table that was replaced by a resize.
+  std::vector<size_t> missing;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    StringTableKey* key = keys[i];
+    const Data* current_data = data_.load(std::memory_order_acquire);
+    InternalIndex entry = current_data->FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      results[i] = handle(String::cast(current_data->Get(isolate, entry)),
+                          isolate);
+      DCHECK_IMPLIES(v8_flags.shared_string_table, results[i]->InSharedHeap());
+      continue;
+    }
+    key->PrepareForInsertion(isolate);
+    missing.push_back(i);
+  }
+  if (missing.empty()) return;
+
+  base::MutexGuard table_write_guard(&write_mutex_);
+  Data* data = EnsureCapacity(isolate, static_cast<int>(missing.size()));
+  for (size_t i : missing) {
+    StringTableKey* key = keys[i];
+    // Check again under the lock, since the key may have been added by
+    // another thread or by an earlier key of this batch.
+    InternalIndex entry =
+        data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+    Object element = data->Get(isolate, entry);
+    if (element == empty_element()) {
+      results[i] = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, results[i]->IsShared());
+      data->Set(entry, *results[i]);
+      data->ElementAdded();
+    } else if (element == deleted_element()) {
+      results[i] = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, results[i]->IsShared());
+      data->Set(entry, *results[i]);
+      data->DeletedElementOverwritten();
+    } else {
+      results[i] = handle(String::cast(element), isolate);
+    }
+  }
+}
+
+template void StringTable::LookupKeys(Isolate* isolate,
+                                      base::Vector<OneByteStringKey*> keys,
+                                      Handle<String>* results);
+template void StringTable::LookupKeys(LocalIsolate* isolate,
+                                      base::Vector<OneByteStringKey*> keys,
+                                      Handle<String>* results);
+
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
                                                OneByteStringKey* key);
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
@@ -664,18 +720,18 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
   // enough space.
   int current_capacity = data->capacity();
   int current_nof = data->number_of_elements();
-  int capacity_after_shrinking =
-      ComputeStringTableCapacityWithShrink(current_capacity, current_nof + 1);
+  int capacity_after_shrinking = ComputeStringTableCapacityWithShrink(
+      current_capacity, current_nof + additional_elements);
 
   int new_capacity = -1;
   if (capacity_after_shrinking < current_capacity) {
-    DCHECK(StringTableHasSufficientCapacityToAdd(capacity_after_shrinking,
-                                                 current_nof, 0, 1));
+    DCHECK(StringTableHasSufficientCapacityToAdd(
+        capacity_after_shrinking, current_nof, 0, additional_elements));
     new_capacity = capacity_after_shrinking;
   } else if (!StringTableHasSufficientCapacityToAdd(
                  current_capacity, current_nof,
-                 data->number_of_deleted_elements(), 1)) {
-    new_capacity = ComputeStringTableCapacity(current_nof + 1);
+                 data->number_of_deleted_elements(), additional_elements)) {
+    new_capacity = ComputeStringTableCapacity(current_nof + additional_elements);
   }
 
   if (new_capacity != -1) {
@@ -66,6 +66,13 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   Handle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // Like {LookupKey} for each of the {keys}, writing the strings found or
+  // added to {results}. Keys that are missing are added while taking the write
+  // lock only once for the whole batch.
+  template <typename StringTableKey, typename IsolateT>
+  void LookupKeys(IsolateT* isolate, base::Vector<StringTableKey*> keys,
+                  Handle<String>* results);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
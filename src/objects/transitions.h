@@ -44,6 +44,13 @@ using ForEachTransitionCallback = std::function<void(Map)>;
 // the target map's descriptor array.  Stored transitions are weak in the GC
 // sense: both single transitions stored inline and TransitionArray fields are
 // cleared when the map they refer to is not otherwise reachable.
+//
+// Maps reached through different property insertion orders cannot be merged
+// into one canonical map: the descriptor order of a map is the enumeration
+// order of its named properties (OrdinaryOwnPropertyKeys), so {a, b} and
+// {b, a} are observably different shapes. Dead branches are already pruned
+// by MarkCompactCollector::ClearFullMapTransitions, which compacts and
+// right-trims TransitionArrays and trims shared DescriptorArrays.
 class V8_EXPORT_PRIVATE TransitionsAccessor {
  public:
   // {concurrent_access} signals that the TransitionsAccessor will only be used
@@ -1703,6 +1703,24 @@ bool ValueDeserializer::ReadExpectedString(Handle<String> expected) {
   return false;
 }
 
+MaybeHandle<Object> ValueDeserializer::ReadObjectKey() {
+  SerializationTag tag;
+  if (PeekTag().To(&tag) && tag == SerializationTag::kOneByteString) {
+    const uint8_t* original_position = position_;
+    ConsumeTag(SerializationTag::kOneByteString);
+    uint32_t byte_length;
+    base::Vector<const uint8_t> bytes;
+    if (ReadVarint<uint32_t>().To(&byte_length) &&
+        byte_length <= static_cast<uint32_t>(String::kMaxLength) &&
+        ReadRawBytes(byte_length).To(&bytes)) {
+      return isolate_->factory()->InternalizeString(bytes);
+    }
+    // Let ReadObject report malformed or too long input.
+    position_ = original_position;
+  }
+  return ReadObject();
+}
+
 MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
   // If we are at the end of the stack, abort. This function may recurse.
   STACK_CHECK(isolate_, MaybeHandle<JSObject>());
@@ -2371,7 +2389,8 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       if (!expected_key.is_null() && ReadExpectedString(expected_key)) {
         key = expected_key;
       } else {
-        if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
+        if (!ReadObjectKey().ToHandle(&key) ||
+            !IsValidObjectKey(*key, isolate_)) {
           return Nothing<uint32_t>();
         }
         if (key->IsString(isolate_)) {
@@ -2459,7 +2478,8 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     }
 
     Handle<Object> key;
-    if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
+    if (!ReadObjectKey().ToHandle(&key) ||
+        !IsValidObjectKey(*key, isolate_)) {
       return Nothing<uint32_t>();
     }
     Handle<Object> value;
@@ -270,6 +270,11 @@ class ValueDeserializer {
   // Returns true if this was the case. Otherwise, nothing is consumed.
   bool ReadExpectedString(Handle<String> expected) V8_WARN_UNUSED_RESULT;
 
+  // Reads a property key. One-byte string keys are internalized directly from
+  // the wire bytes, which avoids allocating a temporary string for keys that
+  // are already in the string table.
+  MaybeHandle<Object> ReadObjectKey() V8_WARN_UNUSED_RESULT;
+
   // Like ReadObject, but skips logic for special cases in simulating the
   // "stack machine".
   MaybeHandle<Object> ReadObjectInternal() V8_WARN_UNUSED_RESULT;
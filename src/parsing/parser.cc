@@ -2687,11 +2687,6 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   DCHECK_IMPLIES(parse_lazily(), has_error() || allow_lazy_);
   DCHECK_IMPLIES(parse_lazily(), extension() == nullptr);
 
-  const bool is_lazy =
-      eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
-  const bool is_top_level = AllowsLazyParsingWithoutUnresolvedVariables();
-  const bool is_eager_top_level_function = !is_lazy && is_top_level;
-
   RCS_SCOPE(runtime_call_stats_, RuntimeCallCounterId::kParseFunctionLiteral,
             RuntimeCallStats::kThreadSpecific);
   base::ElapsedTimer timer;
@@ -2709,13 +2704,30 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       can_preparse && info()->dispatcher() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
+  // The embedder may tell us that a lazy function is going to be called soon
+  // (e.g. because it ran during startup in a previous session). Compile it in
+  // a parallel task if we can, and eagerly otherwise.
+  const bool is_compile_hinted =
+      eager_compile_hint == FunctionLiteral::kShouldLazyCompile &&
+      IsCompileHinted(pos);
+  if (is_compile_hinted && !can_post_parallel_task) {
+    eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
+  }
+
+  const bool is_lazy =
+      eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
+  const bool is_top_level = AllowsLazyParsingWithoutUnresolvedVariables();
+  const bool is_eager_top_level_function = !is_lazy && is_top_level;
+
   // If parallel compile tasks are enabled, and this isn't a re-parse, enable
-  // parallel compile for the subset of functions as defined by flags.
+  // parallel compile for the subset of functions as defined by flags, and for
+  // the functions hinted by the embedder.
   bool should_post_parallel_task =
       can_post_parallel_task && !flags().is_reparse() &&
       ((is_eager_top_level_function &&
         flags().post_parallel_compile_tasks_for_eager_toplevel()) ||
-       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()));
+       (is_lazy && (flags().post_parallel_compile_tasks_for_lazy() ||
+                    is_compile_hinted)));
 
   // Determine whether we should lazy parse the inner function. This will be
   // when either the function is lazy by inspection, or when we force it to be
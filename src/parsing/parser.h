@@ -434,6 +434,15 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   FunctionLiteral* DefaultConstructor(const AstRawString* name, bool call_super,
                                       int pos, int end_pos);
 
+  // Returns whether the embedder asked for the function starting at |position|
+  // to be compiled ahead of its first call.
+  bool IsCompileHinted(int position) const {
+    ScriptCompiler::CompileHintCallback callback =
+        info_->compile_hint_callback();
+    return callback != nullptr &&
+           callback(position, info_->compile_hint_callback_data());
+  }
+
   // Skip over a lazy function, either using cached data if we have it, or
   // by parsing the function with PreParser. Consumes the ending }.
   // In case the preparser detects an error it cannot identify, it resets the
@@ -620,6 +620,17 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    // Fast path for ascii sequences: each byte is exactly one char, so skip
+    // them without decoding.
+    if (V8_LIKELY(state == unibrow::Utf8::State::kAccept)) {
+      size_t remaining = end - cursor;
+      int max_length =
+          static_cast<int>(std::min(remaining, position - chars));
+      int ascii_length = NonAsciiStart(cursor, max_length);
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -694,6 +705,17 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   }
 
   const uint16_t* max_buffer_end = buffer_start_ + kBufferSize;
+  // Copy a leading ascii sequence directly, unless we are in the middle of a
+  // multi-byte char that started in the previous chunk.
+  if (V8_LIKELY(state == unibrow::Utf8::State::kAccept)) {
+    size_t remaining = end - cursor;
+    size_t max_buffer = max_buffer_end - output_cursor;
+    int max_length = static_cast<int>(std::min(remaining, max_buffer));
+    int ascii_length = NonAsciiStart(cursor, max_length);
+    CopyChars(output_cursor, cursor, ascii_length);
+    cursor += ascii_length;
+    output_cursor += ascii_length;
+  }
   while (cursor < end && output_cursor + 1 < max_buffer_end) {
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
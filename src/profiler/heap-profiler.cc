@@ -111,6 +111,39 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::TakeSnapshotToStream(
+    const v8::HeapProfiler::HeapSnapshotOptions options,
+    v8::OutputStream* stream) {
+  is_taking_snapshot_ = true;
+  bool success;
+  {
+    // The snapshot only holds the entries; edges go straight to the stream.
+    HeapSnapshot snapshot(this, options.snapshot_mode, options.numerics_mode);
+    base::Optional<CppClassNamesAsHeapObjectNameScope> use_cpp_class_name;
+    if (snapshot.expose_internals() && heap()->cpp_heap())
+      use_cpp_class_name.emplace(heap()->cpp_heap());
+
+    HeapSnapshotJSONSerializer serializer(&snapshot);
+    serializer.BeginStreaming(stream);
+    snapshot.set_streaming_serializer(&serializer);
+    HeapSnapshotGenerator generator(
+        &snapshot, options.control, options.global_object_name_resolver,
+        heap());
+    success = generator.GenerateSnapshot();
+    snapshot.set_streaming_serializer(nullptr);
+    success = serializer.FinishStreaming(success);
+  }
+  ids_->RemoveDeadEntries();
+  is_tracking_object_moves_ = true;
+  heap()->isolate()->UpdateLogObjectRelocation();
+  is_taking_snapshot_ = false;
+
+  heap()->isolate()->debug()->feature_tracker()->Track(
+      DebugFeatureTracker::kHeapSnapshot);
+
+  return success;
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(
     uint64_t sample_interval, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags) {
@@ -33,6 +33,9 @@ class HeapProfiler : public HeapObjectAllocationTracker {
 
   HeapSnapshot* TakeSnapshot(
       const v8::HeapProfiler::HeapSnapshotOptions options);
+  bool TakeSnapshotToStream(
+      const v8::HeapProfiler::HeapSnapshotOptions options,
+      v8::OutputStream* stream);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
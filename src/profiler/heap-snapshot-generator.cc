@@ -281,7 +281,12 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type, const char* name,
                                   HeapSnapshotGenerator* generator,
                                   ReferenceVerification verification) {
   ++children_count_;
-  snapshot_->edges().emplace_back(type, name, this, entry);
+  if (V8_UNLIKELY(snapshot_->streaming_serializer())) {
+    snapshot_->streaming_serializer()->StreamEdge(
+        HeapGraphEdge(type, name, this, entry));
+  } else {
+    snapshot_->edges().emplace_back(type, name, this, entry);
+  }
   VerifyReference(type, entry, generator, verification);
 }
 
@@ -290,7 +295,12 @@ void HeapEntry::SetIndexedReference(HeapGraphEdge::Type type, int index,
                                     HeapSnapshotGenerator* generator,
                                     ReferenceVerification verification) {
   ++children_count_;
-  snapshot_->edges().emplace_back(type, index, this, entry);
+  if (V8_UNLIKELY(snapshot_->streaming_serializer())) {
+    snapshot_->streaming_serializer()->StreamEdge(
+        HeapGraphEdge(type, index, this, entry));
+  } else {
+    snapshot_->edges().emplace_back(type, index, this, entry);
+  }
   VerifyReference(type, entry, generator, verification);
 }
 
@@ -991,7 +1001,12 @@ HeapEntry::Type V8HeapExplorer::GetSystemEntryType(HeapObject object) {
 }
 
 uint32_t V8HeapExplorer::EstimateObjectsCount() {
-  CombinedHeapObjectIterator it(heap_, HeapObjectIterator::kFilterUnreachable);
+  // The count only drives progress reporting. Filtering unreachable objects
+  // would require an additional marking pass over the whole heap, recording
+  // every reachable object in a hash set, on top of the one performed for the
+  // actual extraction. The snapshot is taken right after a full GC, so the
+  // unfiltered count is close enough.
+  CombinedHeapObjectIterator it(heap_, HeapObjectIterator::kNoFiltering);
   uint32_t objects_count = 0;
   // Avoid overflowing the objects count. In worst case, we will show the same
   // progress for a longer period of time, but we do not expect to have that
@@ -2749,7 +2764,8 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
-  snapshot_->FillChildren();
+  // Streamed edges are not stored and thus cannot be assigned to entries.
+  if (!snapshot_->streaming_serializer()) snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
   progress_counter_ = progress_total_;
@@ -2807,6 +2823,53 @@ void HeapSnapshotJSONSerializer::Serialize(v8::OutputStream* stream) {
   writer_ = nullptr;
 }
 
+void HeapSnapshotJSONSerializer::BeginStreaming(v8::OutputStream* stream) {
+  DCHECK_NULL(writer_);
+  DCHECK(snapshot_->edges().empty());
+  writer_ = new OutputStreamWriter(stream);
+  streaming_ = true;
+  writer_->AddCharacter('{');
+  writer_->AddString("\"edges\":[");
+}
+
+void HeapSnapshotJSONSerializer::StreamEdge(const HeapGraphEdge& edge) {
+  DCHECK(streaming_);
+  if (writer_->aborted()) return;
+  if (streamed_edge_count_ != 0) writer_->AddCharacter(',');
+  writer_->AddNumber(static_cast<unsigned>(to_node_index(edge.from())));
+  writer_->AddCharacter(',');
+  SerializeEdge(&edge, true);
+  ++streamed_edge_count_;
+}
+
+bool HeapSnapshotJSONSerializer::FinishStreaming(bool generation_succeeded) {
+  DCHECK(streaming_);
+  if (AllocationTracker* allocation_tracker =
+          snapshot_->profiler()->allocation_tracker()) {
+    allocation_tracker->PrepareForSerialization();
+  }
+  if (generation_succeeded && !writer_->aborted()) {
+    SerializeStreamedSnapshotTail();
+  }
+  const bool success = generation_succeeded && !writer_->aborted();
+  delete writer_;
+  writer_ = nullptr;
+  return success;
+}
+
+void HeapSnapshotJSONSerializer::SerializeStreamedSnapshotTail() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  writer_->AddString("],\n");
+  writer_->AddString("\"snapshot\":{");
+  SerializeSnapshot();
+  if (writer_->aborted()) return;
+  writer_->AddString("},\n");
+  writer_->AddString("\"nodes\":[");
+  SerializeNodes();
+  if (writer_->aborted()) return;
+  writer_->AddString("],\n");
+  SerializeTrailingSections();
+}
 
 void HeapSnapshotJSONSerializer::SerializeImpl() {
   DCHECK_EQ(0, snapshot_->root()->index());
@@ -2823,7 +2886,10 @@ void HeapSnapshotJSONSerializer::SerializeImpl() {
   SerializeEdges();
   if (writer_->aborted()) return;
   writer_->AddString("],\n");
+  SerializeTrailingSections();
+}
 
+void HeapSnapshotJSONSerializer::SerializeTrailingSections() {
   writer_->AddString("\"trace_function_infos\":[");
   SerializeTraceNodeInfos();
   if (writer_->aborted()) return;
@@ -2908,7 +2974,7 @@ static int utoa(T value, const base::Vector<char>& buffer, int buffer_pos) {
   return utoa_impl(unsigned_value, buffer, buffer_pos);
 }
 
-void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
+void HeapSnapshotJSONSerializer::SerializeEdge(const HeapGraphEdge* edge,
                                                bool first_edge) {
   // The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
   static const int kBufferSize =
@@ -2961,7 +3027,9 @@ void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->self_size(), buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(entry->children_count(), buffer, buffer_pos);
+  buffer_pos = utoa(streaming_ ? entry->unfilled_children_count()
+                              : entry->children_count(),
+                    buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->trace_node_id(), buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
@@ -3063,7 +3131,13 @@ void HeapSnapshotJSONSerializer::SerializeSnapshot() {
   writer_->AddString(",\"node_count\":");
   writer_->AddNumber(static_cast<unsigned>(snapshot_->entries().size()));
   writer_->AddString(",\"edge_count\":");
-  writer_->AddNumber(static_cast<double>(snapshot_->edges().size()));
+  writer_->AddNumber(static_cast<double>(
+      streaming_ ? streamed_edge_count_ : snapshot_->edges().size()));
+  if (streaming_) {
+    writer_->AddString(
+        ",\"streamed_edge_fields\":"
+        "[\"from_node\",\"type\",\"name_or_index\",\"to_node\"]");
+  }
   writer_->AddString(",\"trace_function_count\":");
   uint32_t count = 0;
   AllocationTracker* tracker = snapshot_->profiler()->allocation_tracker();
@@ -36,6 +36,7 @@ class HeapEntry;
 class HeapProfiler;
 class HeapSnapshot;
 class HeapSnapshotGenerator;
+class HeapSnapshotJSONSerializer;
 class IsolateSafepointScope;
 class JSArrayBuffer;
 class JSCollection;
@@ -136,6 +137,11 @@ class HeapEntry {
   unsigned trace_node_id() const { return trace_node_id_; }
   int index() const { return index_; }
   V8_INLINE int children_count() const;
+  // Only valid before HeapSnapshot::FillChildren() has run, e.g. for snapshots
+  // whose edges are streamed out instead of being stored.
+  int unfilled_children_count() const {
+    return static_cast<int>(children_count_);
+  }
   V8_INLINE int set_children_index(int index);
   V8_INLINE void add_child(HeapGraphEdge* edge);
   V8_INLINE HeapGraphEdge* child(int i);
@@ -241,6 +247,14 @@ class HeapSnapshot {
     return max_snapshot_js_object_id_;
   }
   bool is_complete() const { return !children_.empty(); }
+  // When set, edges are handed to the serializer as they are discovered
+  // instead of being stored in |edges_|.
+  HeapSnapshotJSONSerializer* streaming_serializer() const {
+    return streaming_serializer_;
+  }
+  void set_streaming_serializer(HeapSnapshotJSONSerializer* serializer) {
+    streaming_serializer_ = serializer;
+  }
   bool capture_numeric_value() const {
     return numerics_mode_ ==
            v8::HeapProfiler::NumericsMode::kExposeNumericValues;
@@ -279,6 +293,7 @@ class HeapSnapshot {
   std::vector<HeapGraphEdge*> children_;
   std::unordered_map<SnapshotObjectId, HeapEntry*> entries_by_id_cache_;
   std::vector<SourceLocation> locations_;
+  HeapSnapshotJSONSerializer* streaming_serializer_ = nullptr;
   SnapshotObjectId max_snapshot_js_object_id_ = -1;
   v8::HeapProfiler::HeapSnapshotMode snapshot_mode_;
   v8::HeapProfiler::NumericsMode numerics_mode_;
@@ -671,6 +686,18 @@ class HeapSnapshotJSONSerializer {
       delete;
   void Serialize(v8::OutputStream* stream);
 
+  // Streaming serialization writes edges to |stream| while the snapshot is
+  // being generated, so that they never have to be stored in the snapshot.
+  // Since edges are not grouped by their owner in this mode, every edge record
+  // is prefixed with its |from_node| (see "streamed_edge_fields" in the meta
+  // data) and the edges precede the nodes. Nodes, strings and the remaining
+  // sections are written by FinishStreaming() once generation is complete.
+  // Returns false if generation failed or the stream was aborted, in which
+  // case the end of the stream is not signaled.
+  void BeginStreaming(v8::OutputStream* stream);
+  void StreamEdge(const HeapGraphEdge& edge);
+  bool FinishStreaming(bool generation_succeeded);
+
  private:
   V8_INLINE static bool StringsMatch(void* key1, void* key2) {
     return strcmp(reinterpret_cast<char*>(key1),
@@ -682,9 +709,11 @@ class HeapSnapshotJSONSerializer {
   int GetStringId(const char* s);
   V8_INLINE int to_node_index(const HeapEntry* e);
   V8_INLINE int to_node_index(int entry_index);
-  void SerializeEdge(HeapGraphEdge* edge, bool first_edge);
+  void SerializeEdge(const HeapGraphEdge* edge, bool first_edge);
   void SerializeEdges();
   void SerializeImpl();
+  void SerializeStreamedSnapshotTail();
+  void SerializeTrailingSections();
   void SerializeNode(const HeapEntry* entry);
   void SerializeNodes();
   void SerializeSnapshot();
@@ -705,6 +734,8 @@ class HeapSnapshotJSONSerializer {
   int next_node_id_;
   int next_string_id_;
   OutputStreamWriter* writer_;
+  bool streaming_ = false;
+  size_t streamed_edge_count_ = 0;
 
   friend class HeapSnapshotJSONSerializerEnumerator;
   friend class HeapSnapshotJSONSerializerIterator;
@@ -5,6 +5,7 @@
 #include "src/profiler/profile-generator.h"
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include "include/v8-profiler.h"
@@ -918,6 +919,218 @@ void CpuProfileJSONSerializer::SerializeImpl() {
   writer_->Finalize();
 }
 
+namespace {
+
+// Field numbers from perftools.profiles (profile.proto).
+constexpr int kProfileSampleType = 1;
+constexpr int kProfileSample = 2;
+constexpr int kProfileLocation = 4;
+constexpr int kProfileFunction = 5;
+constexpr int kProfileStringTable = 6;
+constexpr int kProfileDurationNanos = 10;
+constexpr int kProfilePeriodType = 11;
+constexpr int kProfilePeriod = 12;
+constexpr int kValueTypeType = 1;
+constexpr int kValueTypeUnit = 2;
+constexpr int kSampleLocationId = 1;
+constexpr int kSampleValue = 2;
+constexpr int kLocationId = 1;
+constexpr int kLocationLine = 4;
+constexpr int kLineFunctionId = 1;
+constexpr int kLineLine = 2;
+constexpr int kFunctionId = 1;
+constexpr int kFunctionName = 2;
+constexpr int kFunctionSystemName = 3;
+constexpr int kFunctionFilename = 4;
+constexpr int kFunctionStartLine = 5;
+
+}  // namespace
+
+// Minimal encoder for the protocol buffer wire format, covering the varint and
+// length-delimited fields used by profile.proto.
+class CpuProfilePprofSerializer::Message {
+ public:
+  void AddVarint(int field, uint64_t value) {
+    AddTag(field, kVarintWireType);
+    AddRawVarint(value);
+  }
+  void AddBytes(int field, const char* data, size_t length) {
+    AddTag(field, kLengthDelimitedWireType);
+    AddRawVarint(length);
+    data_.append(data, length);
+  }
+  void AddMessage(int field, const Message& message) {
+    AddBytes(field, message.data_.data(), message.data_.size());
+  }
+  void AddPackedVarints(int field, const std::vector<uint64_t>& values) {
+    Message packed;
+    for (uint64_t value : values) packed.AddRawVarint(value);
+    AddMessage(field, packed);
+  }
+
+  const std::string& data() const { return data_; }
+
+ private:
+  static constexpr int kVarintWireType = 0;
+  static constexpr int kLengthDelimitedWireType = 2;
+
+  void AddTag(int field, int wire_type) {
+    AddRawVarint((static_cast<uint64_t>(field) << 3) | wire_type);
+  }
+  void AddRawVarint(uint64_t value) {
+    while (value >= 0x80) {
+      data_.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+    data_.push_back(static_cast<char>(value));
+  }
+
+  std::string data_;
+};
+
+void CpuProfilePprofSerializer::Serialize(v8::OutputStream* stream) {
+  DCHECK_NULL(writer_);
+  writer_ = new OutputStreamWriter(stream);
+  SerializeImpl();
+  delete writer_;
+  writer_ = nullptr;
+}
+
+void CpuProfilePprofSerializer::WriteField(const Message& field) {
+  writer_->AddBytes(field.data().data(),
+                    static_cast<int>(field.data().size()));
+}
+
+uint64_t CpuProfilePprofSerializer::StringId(const char* string) {
+  auto it = string_ids_.find(string);
+  if (it != string_ids_.end()) return it->second;
+  uint64_t id = string_ids_.size();
+  string_ids_.emplace(string, id);
+  Message field;
+  field.AddBytes(kProfileStringTable, string, strlen(string));
+  WriteField(field);
+  return id;
+}
+
+uint64_t CpuProfilePprofSerializer::FunctionId(CodeEntry* entry) {
+  auto it = function_ids_.find(entry);
+  if (it != function_ids_.end()) return it->second;
+  // Ids must be non-zero.
+  uint64_t id = function_ids_.size() + 1;
+  function_ids_.emplace(entry, id);
+  Message function;
+  function.AddVarint(kFunctionId, id);
+  uint64_t name_id = StringId(entry->name());
+  function.AddVarint(kFunctionName, name_id);
+  function.AddVarint(kFunctionSystemName, name_id);
+  function.AddVarint(kFunctionFilename, StringId(entry->resource_name()));
+  function.AddVarint(kFunctionStartLine, std::max(entry->line_number(), 0));
+  Message field;
+  field.AddMessage(kProfileFunction, function);
+  WriteField(field);
+  return id;
+}
+
+void CpuProfilePprofSerializer::SerializeLocation(uint64_t id,
+                                                  const ProfileNode* node,
+                                                  int line) {
+  Message line_info;
+  line_info.AddVarint(kLineFunctionId, FunctionId(node->entry()));
+  line_info.AddVarint(kLineLine, std::max(line, 0));
+  Message location;
+  location.AddVarint(kLocationId, id);
+  location.AddMessage(kLocationLine, line_info);
+  Message field;
+  field.AddMessage(kProfileLocation, location);
+  WriteField(field);
+}
+
+void CpuProfilePprofSerializer::SerializeSample(uint64_t leaf_location_id,
+                                                const ProfileNode* node,
+                                                unsigned ticks) {
+  // Locations are listed from the leaf to the outermost caller; the synthetic
+  // root node is left out.
+  std::vector<uint64_t> location_ids{leaf_location_id};
+  const ProfileNode* root = profile_->top_down()->root();
+  for (const ProfileNode* caller = node->parent();
+       caller != nullptr && caller != root; caller = caller->parent()) {
+    location_ids.push_back(caller->id());
+  }
+  Message sample;
+  sample.AddPackedVarints(kSampleLocationId, location_ids);
+  sample.AddPackedVarints(kSampleValue, {ticks});
+  Message field;
+  field.AddMessage(kProfileSample, sample);
+  WriteField(field);
+}
+
+void CpuProfilePprofSerializer::SerializeValueType(int field_number,
+                                                   const char* type,
+                                                   const char* unit) {
+  Message value_type;
+  value_type.AddVarint(kValueTypeType, StringId(type));
+  value_type.AddVarint(kValueTypeUnit, StringId(unit));
+  Message field;
+  field.AddMessage(field_number, value_type);
+  WriteField(field);
+}
+
+void CpuProfilePprofSerializer::SerializeImpl() {
+  // The string table must start with the empty string.
+  StringId("");
+  SerializeValueType(kProfileSampleType, "samples", "count");
+
+  std::vector<const v8::CpuProfileNode*> nodes;
+  FlattenNodesTree(
+      reinterpret_cast<const v8::CpuProfileNode*>(profile_->top_down()->root()),
+      &nodes);
+  uint64_t next_location_id = 0;
+  for (const v8::CpuProfileNode* node : nodes) {
+    next_location_id = std::max<uint64_t>(next_location_id, node->GetNodeId());
+  }
+  next_location_id++;
+
+  // Every node is a location at its own line. Ticks that have line info are
+  // attributed to an extra leaf location at the sampled line.
+  const ProfileNode* root = profile_->top_down()->root();
+  std::vector<v8::CpuProfileNode::LineTick> line_ticks;
+  for (const v8::CpuProfileNode* api_node : nodes) {
+    const ProfileNode* node = reinterpret_cast<const ProfileNode*>(api_node);
+    if (node == root) continue;
+    SerializeLocation(node->id(), node, node->line_number());
+    unsigned ticks_without_line = node->self_ticks();
+    unsigned line_count = node->GetHitLineCount();
+    if (line_count > 0) {
+      line_ticks.resize(line_count);
+      if (node->GetLineTicks(line_ticks.data(), line_count)) {
+        for (const v8::CpuProfileNode::LineTick& tick : line_ticks) {
+          uint64_t location_id = next_location_id++;
+          SerializeLocation(location_id, node, tick.line);
+          SerializeSample(location_id, node, tick.hit_count);
+          ticks_without_line -= std::min(ticks_without_line, tick.hit_count);
+        }
+      }
+    }
+    if (ticks_without_line > 0) {
+      SerializeSample(node->id(), node, ticks_without_line);
+    }
+    if (writer_->aborted()) return;
+  }
+
+  Message fields;
+  fields.AddVarint(
+      kProfileDurationNanos,
+      (profile_->end_time() - profile_->start_time()).InMicroseconds() * 1000);
+  WriteField(fields);
+  if (profile_->sampling_interval_us() > 0) {
+    SerializeValueType(kProfilePeriodType, "cpu", "nanoseconds");
+    Message period;
+    period.AddVarint(kProfilePeriod, profile_->sampling_interval_us() * 1000);
+    WriteField(period);
+  }
+  writer_->Finalize();
+}
+
 void CpuProfile::Print() const {
   base::OS::Print("[Top down]:\n");
   top_down_.Print();
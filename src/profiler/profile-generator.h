@@ -622,6 +622,37 @@ class CpuProfileJSONSerializer {
   OutputStreamWriter* writer_;
 };
 
+// Writes a CpuProfile as a pprof profile.proto message. Top-level fields are
+// streamed as they are produced, so the whole encoding is never held in
+// memory. Strings are deduplicated by address, relying on CodeEntry names
+// being owned by a StringsStorage.
+class CpuProfilePprofSerializer {
+ public:
+  explicit CpuProfilePprofSerializer(CpuProfile* profile)
+      : profile_(profile), writer_(nullptr) {}
+  CpuProfilePprofSerializer(const CpuProfilePprofSerializer&) = delete;
+  CpuProfilePprofSerializer& operator=(const CpuProfilePprofSerializer&) =
+      delete;
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  class Message;
+
+  uint64_t StringId(const char* string);
+  uint64_t FunctionId(CodeEntry* entry);
+  void SerializeLocation(uint64_t id, const ProfileNode* node, int line);
+  void SerializeSample(uint64_t leaf_location_id, const ProfileNode* node,
+                       unsigned ticks);
+  void SerializeValueType(int field, const char* type, const char* unit);
+  void SerializeImpl();
+  void WriteField(const Message& field);
+
+  CpuProfile* profile_;
+  OutputStreamWriter* writer_;
+  std::unordered_map<const char*, uint64_t> string_ids_;
+  std::unordered_map<CodeEntry*, uint64_t> function_ids_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -85,8 +85,9 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
+  auto sample = std::make_unique<Sample>(size, node, loc, this,
+                                         next_sample_id(), heap_->gc_count(),
+                                         heap_->ms_count());
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
   samples_.emplace(sample.get(), std::move(sample));
@@ -297,7 +298,9 @@ SamplingHeapProfiler::BuildSamples() const {
     const Sample* sample = it.second.get();
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id,
+        static_cast<unsigned int>(heap_->gc_count() - sample->gc_count),
+        static_cast<unsigned int>(heap_->ms_count() - sample->ms_count)});
   }
   return samples;
 }
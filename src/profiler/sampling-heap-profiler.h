@@ -101,12 +101,15 @@ class SamplingHeapProfiler {
 
   struct Sample {
     Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_, uint64_t sample_id)
+           SamplingHeapProfiler* profiler_, uint64_t sample_id, int gc_count,
+           int ms_count)
         : size(size_),
           owner(owner_),
           global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          gc_count(gc_count),
+          ms_count(ms_count) {}
     Sample(const Sample&) = delete;
     Sample& operator=(const Sample&) = delete;
     const size_t size;
@@ -114,6 +117,9 @@ class SamplingHeapProfiler {
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    // Heap::gc_count() and Heap::ms_count() at allocation time.
+    const int gc_count;
+    const int ms_count;
   };
 
   SamplingHeapProfiler(Heap* heap, StringsStorage* names, uint64_t rate,
@@ -386,7 +386,7 @@ IrregexpInterpreter::Result RawMatch(
     base::Vector<const Char> subject, int* output_registers,
     int output_register_count, int total_register_count, int current,
     uint32_t current_char, RegExp::CallOrigin call_origin,
-    const uint32_t backtrack_limit) {
+    const uint32_t backtrack_limit, uint32_t* backtrack_count_out) {
   DisallowGarbageCollection no_gc;
 
 #if V8_USE_COMPUTED_GOTO
@@ -444,7 +444,10 @@ IrregexpInterpreter::Result RawMatch(
                                  output_register_count);
   BacktrackStack backtrack_stack;
 
-  uint32_t backtrack_count = 0;
+  // Backtracks are counted in the caller's storage, so that the cost of the
+  // execution is available independently of how it ended.
+  uint32_t& backtrack_count = *backtrack_count_out;
+  backtrack_count = 0;
 
 #ifdef DEBUG
   if (v8_flags.trace_regexp_bytecodes) {
@@ -1050,13 +1053,33 @@ IrregexpInterpreter::Result RawMatch(
 #undef BC_LABEL
 #undef V8_USE_COMPUTED_GOTO
 
+// Besides the per-execution ticks, an interpreted regexp tiers up as soon as
+// a single execution was expensive, measured in backtracks.
+void TierUpIfExpensive(JSRegExp regexp, uint32_t backtrack_count) {
+  if (!v8_flags.regexp_tier_up || v8_flags.regexp_tier_up_backtracks <= 0) {
+    return;
+  }
+  if (backtrack_count <
+      static_cast<uint32_t>(v8_flags.regexp_tier_up_backtracks)) {
+    return;
+  }
+  if (regexp.MarkedForTierUp()) return;
+  regexp.MarkTierUpForNextExec();
+  if (v8_flags.trace_regexp_tier_up) {
+    PrintF(
+        "Forcing tier-up of JSRegExp object %p after %u backtracks in the "
+        "interpreter\n",
+        reinterpret_cast<void*>(regexp.ptr()), backtrack_count);
+  }
+}
+
 }  // namespace
 
 // static
 IrregexpInterpreter::Result IrregexpInterpreter::Match(
     Isolate* isolate, JSRegExp regexp, String subject_string,
     int* output_registers, int output_register_count, int start_position,
-    RegExp::CallOrigin call_origin) {
+    RegExp::CallOrigin call_origin, uint32_t* backtrack_count) {
   if (v8_flags.regexp_tier_up) regexp.TierUpTick();
 
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(subject_string);
@@ -1065,14 +1088,15 @@ IrregexpInterpreter::Result IrregexpInterpreter::Match(
 
   return MatchInternal(isolate, code_array, subject_string, output_registers,
                        output_register_count, total_register_count,
-                       start_position, call_origin, regexp.backtrack_limit());
+                       start_position, call_origin, regexp.backtrack_limit(),
+                       backtrack_count);
 }
 
 IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     Isolate* isolate, ByteArray code_array, String subject_string,
     int* output_registers, int output_register_count, int total_register_count,
     int start_position, RegExp::CallOrigin call_origin,
-    uint32_t backtrack_limit) {
+    uint32_t backtrack_limit, uint32_t* backtrack_count) {
   DCHECK(subject_string.IsFlat());
 
   // TODO(chromium:1262676): Remove this CHECK once fixed.
@@ -1099,7 +1123,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count);
   } else {
     DCHECK(subject_content.IsTwoByte());
     base::Vector<const base::uc16> subject_vector =
@@ -1108,7 +1132,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count);
   }
 }
 
@@ -1138,8 +1162,13 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromJs(
     return IrregexpInterpreter::RETRY;
   }
 
-  return Match(isolate, regexp_obj, subject_string, output_registers,
-               output_register_count, start_position, call_origin);
+  uint32_t backtrack_count = 0;
+  Result result =
+      Match(isolate, regexp_obj, subject_string, output_registers,
+            output_register_count, start_position, call_origin,
+            &backtrack_count);
+  TierUpIfExpensive(regexp_obj, backtrack_count);
+  return result;
 }
 
 #endif  // !COMPILING_IRREGEXP_FOR_EXTERNAL_EMBEDDER
@@ -1147,9 +1176,13 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromJs(
 IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromRuntime(
     Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject_string,
     int* output_registers, int output_register_count, int start_position) {
-  return Match(isolate, *regexp, *subject_string, output_registers,
-               output_register_count, start_position,
-               RegExp::CallOrigin::kFromRuntime);
+  uint32_t backtrack_count = 0;
+  Result result = Match(isolate, *regexp, *subject_string, output_registers,
+                        output_register_count, start_position,
+                        RegExp::CallOrigin::kFromRuntime, &backtrack_count);
+  // Interrupts may have moved {regexp}, so reload it from the handle.
+  TierUpIfExpensive(*regexp, backtrack_count);
+  return result;
 }
 
 }  // namespace internal
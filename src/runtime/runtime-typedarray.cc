@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/base/atomicops.h"
+#include "src/base/radix-sort.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
@@ -95,6 +96,13 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Below this length, std::sort is faster than a radix sort.
+constexpr size_t kMinLengthForRadixSort = 512;
+// The radix sort allocates scratch space for two keys per element off-heap,
+// whereas std::sort works in place. Above this length, rather use std::sort
+// than risk failing that allocation.
+constexpr size_t kMaxLengthForRadixSort = 4 * MB;
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -149,8 +157,11 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array) {                 \
+    if (length >= kMinLengthForRadixSort &&                                \
+        length <= kMaxLengthForRadixSort) {                                \
+      base::RadixSort(data, length);                                       \
+    } else if (kExternal##Type##Array == kExternalFloat64Array ||          \
+               kExternal##Type##Array == kExternalFloat32Array) {          \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
@@ -130,7 +130,10 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // Frees unmarked entries and finishes table compaction (if running).
   //
   // This method must only be called while mutator threads are stopped as it is
-  // not safe to allocate table entries while the table is being swept.
+  // not safe to allocate table entries while the table is being swept. It may
+  // run on a background thread during the atomic pause as long as no other
+  // thread accesses the table in the meantime. The new freelist is published
+  // with a single release store once sweeping is done.
   //
   // Returns the number of live entries after sweeping.
   uint32_t SweepAndCompact(Isolate* isolate);
@@ -273,10 +273,17 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
+  const PatternChar pattern_last_char = pattern[pattern_length - 1];
   while (i <= n) {
     i = FindFirstCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
+    // Matching the last character as well rejects most candidates before
+    // comparing the whole pattern.
+    if (subject[i + pattern_length - 1] != pattern_last_char) {
+      i++;
+      continue;
+    }
     i++;
     // Loop extracted to separate function to allow using return to do
     // a deeper break.
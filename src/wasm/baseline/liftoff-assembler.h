@@ -656,6 +656,9 @@ class LiftoffAssembler : public TurboAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spills the locals which cannot stay in their register across a loop back
+  // edge: constants, and registers that are shared with other stack slots.
+  void SpillLocalsNotInUniqueRegisters();
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
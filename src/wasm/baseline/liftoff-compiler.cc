@@ -1227,7 +1227,15 @@ class LiftoffCompiler {
     // into registers at branches.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    // With --liftoff-loop-locals-in-registers, locals that are in their own
+    // register stay there instead, so that the loop state keeps them cached and
+    // back edges move values into those registers instead of the stack slots.
+    if (v8_flags.liftoff_loop_locals_in_registers &&
+        for_debugging_ == kNoDebugging) {
+      __ SpillLocalsNotInUniqueRegisters();
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
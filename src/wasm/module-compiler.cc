@@ -5,6 +5,7 @@
 #include "src/wasm/module-compiler.h"
 
 #include <algorithm>
+#include <limits>
 #include <queue>
 
 #include "src/api/api-inl.h"
@@ -773,6 +774,10 @@ class CompilationStateImpl {
   int outstanding_recompilation_functions_ = 0;
   TieringState tiering_state_ = kTieredUp;
 
+  // Functions that got tiered up in the PGO profiling run, hottest first.
+  // Their top tier units are committed in that order.
+  std::vector<uint32_t> pgo_tiered_up_functions_;
+
   // End of fields protected by {callbacks_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -1033,6 +1038,25 @@ class CompilationUnitBuilder {
                                  kForDebugging);
   }
 
+  // Moves the top tier units of the functions in {hottest_first} to the front,
+  // in that order, so that they get compiled first.
+  void PrioritizeTopTierUnits(base::Vector<const uint32_t> hottest_first) {
+    std::unordered_map<int, size_t> rank;
+    for (size_t i = 0; i < hottest_first.size(); ++i) {
+      rank.emplace(static_cast<int>(hottest_first[i]), i);
+    }
+    auto get_rank = [&rank](const WasmCompilationUnit& unit) {
+      auto it = rank.find(unit.func_index());
+      return it == rank.end() ? std::numeric_limits<size_t>::max()
+                              : it->second;
+    };
+    std::stable_sort(tiering_units_.begin(), tiering_units_.end(),
+                     [&](const WasmCompilationUnit& a,
+                         const WasmCompilationUnit& b) {
+                       return get_rank(a) < get_rank(b);
+                     });
+  }
+
   void AddRecompilationUnit(int func_index, ExecutionTier tier) {
     // For recompilation, just treat all units like baseline units.
     baseline_units_.emplace_back(
@@ -1848,6 +1872,99 @@ class CompilationTimeCallback : public CompilationEventCallback {
   const CompileMode compile_mode_;
 };
 
+// A task that validates the declared functions of a module in parallel. The
+// error of the function with the lowest index is stored in {error_out}, so the
+// reported error is the same as with sequential validation.
+class ValidateFunctionsTask : public JobTask {
+ public:
+  ValidateFunctionsTask(const WasmModule* module, ModuleWireBytes wire_bytes,
+                        WasmFeatures enabled_features,
+                        OnlyLazyFunctions only_lazy_functions,
+                        WasmError* error_out)
+      : module_(module),
+        wire_bytes_(wire_bytes),
+        enabled_features_(enabled_features),
+        only_lazy_functions_(only_lazy_functions),
+        is_lazy_module_(IsLazyModule(module)),
+        error_out_(error_out),
+        next_function_(module->num_imported_functions),
+        after_last_function_(next_function_ + module->num_declared_functions) {
+  }
+
+  void Run(JobDelegate* delegate) override {
+    AccountingAllocator* allocator = GetWasmEngine()->allocator();
+    do {
+      // Get the index of the next function to validate.
+      // {fetch_add} might overrun {after_last_function_} by a bit. Since the
+      // number of functions is limited to a value much smaller than the
+      // integer range, this is highly unlikely.
+      static_assert(kV8MaxWasmFunctions < kMaxInt / 2);
+      int func_index = next_function_.fetch_add(1, std::memory_order_relaxed);
+      if (V8_UNLIKELY(func_index >= after_last_function_)) return;
+      DCHECK_LE(0, func_index);
+
+      if (!ValidateFunction(allocator, func_index)) {
+        // No need to validate any more functions. All functions with a lower
+        // index have already been handed out, so the earliest error will still
+        // be found.
+        next_function_.store(after_last_function_, std::memory_order_relaxed);
+        return;
+      }
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    int next_func = next_function_.load(std::memory_order_relaxed);
+    return std::max(0, after_last_function_ - next_func);
+  }
+
+ private:
+  // Validates a single function; uses {SetError} on errors.
+  bool ValidateFunction(AccountingAllocator* allocator, int func_index) {
+    if (module_->function_was_validated(func_index)) return true;
+    if (only_lazy_functions_) {
+      CompileStrategy strategy = GetCompileStrategy(
+          module_, enabled_features_, func_index, is_lazy_module_);
+      if (strategy != CompileStrategy::kLazy &&
+          strategy != CompileStrategy::kLazyBaselineEagerTopTier) {
+        return true;
+      }
+    }
+    const WasmFunction& function = module_->functions[func_index];
+    base::Vector<const uint8_t> code = wire_bytes_.GetFunctionBytes(&function);
+    DecodeResult function_result = ValidateSingleFunction(
+        module_, func_index, code, allocator, enabled_features_);
+    if (V8_UNLIKELY(function_result.failed())) {
+      SetError(func_index, std::move(function_result).error());
+      return false;
+    }
+    module_->set_function_validated(func_index);
+    return true;
+  }
+
+  // Stores the error if it belongs to the function with the lowest index seen
+  // so far. Thread-safe.
+  void SetError(int func_index, WasmError error) {
+    base::MutexGuard mutex_guard{&set_error_mutex_};
+    if (error_func_index_ != -1 && error_func_index_ < func_index) return;
+    error_func_index_ = func_index;
+    *error_out_ = GetWasmErrorWithName(wire_bytes_,
+                                       &module_->functions[func_index],
+                                       module_, std::move(error));
+  }
+
+  const WasmModule* const module_;
+  const ModuleWireBytes wire_bytes_;
+  const WasmFeatures enabled_features_;
+  const OnlyLazyFunctions only_lazy_functions_;
+  const bool is_lazy_module_;
+  WasmError* const error_out_;
+  std::atomic<int> next_function_;
+  const int after_last_function_;
+  base::Mutex set_error_mutex_;
+  int error_func_index_ = -1;
+};
+
 WasmError ValidateFunctions(const WasmModule* module,
                             ModuleWireBytes wire_bytes,
                             WasmFeatures enabled_features,
@@ -1858,33 +1975,32 @@ WasmError ValidateFunctions(const WasmModule* module,
     return {};
   }
 
-  auto allocator = GetWasmEngine()->allocator();
+  class NeverYieldDelegate final : public JobDelegate {
+   public:
+    bool ShouldYield() override { return false; }
 
-  // TODO(clemensb): Parallelize this.
-  auto declared_functions =
-      base::VectorOf(module->functions) + module->num_imported_functions;
-  const bool is_lazy_module = IsLazyModule(module);
-  for (const WasmFunction& function : declared_functions) {
-    if (module->function_was_validated(function.func_index)) continue;
-    base::Vector<const uint8_t> code = wire_bytes.GetFunctionBytes(&function);
+    bool IsJoiningThread() const override { UNIMPLEMENTED(); }
+    void NotifyConcurrencyIncrease() override { UNIMPLEMENTED(); }
+    uint8_t GetTaskId() override { UNIMPLEMENTED(); }
+  };
 
-    if (only_lazy_functions) {
-      CompileStrategy strategy = GetCompileStrategy(
-          module, enabled_features, function.func_index, is_lazy_module);
-      if (strategy != CompileStrategy::kLazy &&
-          strategy != CompileStrategy::kLazyBaselineEagerTopTier) {
-        continue;
-      }
-    }
-    DecodeResult function_result = ValidateSingleFunction(
-        module, function.func_index, code, allocator, enabled_features);
-    if (function_result.failed()) {
-      return GetWasmErrorWithName(wire_bytes, &function, module,
-                                  std::move(function_result).error());
-    }
-    module->set_function_validated(function.func_index);
+  WasmError error;
+  std::unique_ptr<JobTask> validate_job =
+      std::make_unique<ValidateFunctionsTask>(
+          module, wire_bytes, enabled_features, only_lazy_functions, &error);
+
+  if (v8_flags.single_threaded) {
+    // In single-threaded mode, run the {ValidateFunctionsTask} synchronously.
+    NeverYieldDelegate delegate;
+    validate_job->Run(&delegate);
+  } else {
+    // Spawn the task and join it.
+    std::unique_ptr<JobHandle> job_handle =
+        V8::GetCurrentPlatform()->CreateJob(TaskPriority::kUserVisible,
+                                            std::move(validate_job));
+    job_handle->Join();
   }
-  return {};
+  return error;
 }
 
 WasmError ValidateFunctions(const NativeModule& native_module,
@@ -3222,6 +3338,8 @@ void CompilationStateImpl::ApplyPgoInfoToInitialProgress(
     // background.
     progress = RequiredTopTierField::update(progress, ExecutionTier::kTurbofan);
   }
+  pgo_tiered_up_functions_.assign(pgo_info->tiered_up_functions().begin(),
+                                  pgo_info->tiered_up_functions().end());
 }
 
 void CompilationStateImpl::InitializeCompilationProgress(
@@ -3330,6 +3448,10 @@ void CompilationStateImpl::InitializeCompilationUnits(
       compilation_progress_[i] = AddCompilationUnitInternal(
           builder.get(), func_index, function_progress);
     }
+    if (!pgo_tiered_up_functions_.empty()) {
+      builder->PrioritizeTopTierUnits(base::VectorOf(pgo_tiered_up_functions_));
+      pgo_tiered_up_functions_.clear();
+    }
   }
   builder->Commit();
 }
@@ -4071,30 +4193,51 @@ WasmCode* CompileImportWrapper(
   // yet.
   WasmImportWrapperCache::CacheKey key(kind, canonical_type_index,
                                        expected_arity, suspend);
-  DCHECK_NULL((*cache_scope)[key]);
   bool source_positions = is_asmjs_module(native_module->module());
-  // Keep the {WasmCode} alive until we explicitly call {IncRef}.
-  WasmCodeRefScope code_ref_scope;
   CompilationEnv env = native_module->CreateCompilationEnv();
   WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
       &env, kind, sig, source_positions, expected_arity, suspend);
-  WasmCode* published_code;
+  PublishImportWrappers(native_module, counters, base::VectorOf(&key, 1),
+                        base::VectorOf(&result, 1), cache_scope);
+  return (*cache_scope)[key];
+}
+
+void PublishImportWrappers(
+    NativeModule* native_module, Counters* counters,
+    base::Vector<const WasmImportWrapperCache::CacheKey> keys,
+    base::Vector<WasmCompilationResult> results,
+    WasmImportWrapperCache::ModificationScope* cache_scope) {
+  DCHECK_EQ(keys.size(), results.size());
+  if (results.empty()) return;
+  // Keep the {WasmCode} alive until we explicitly call {IncRef}.
+  WasmCodeRefScope code_ref_scope;
+  std::vector<WasmCode*> published_code;
   {
     CodeSpaceWriteScope code_space_write_scope(native_module);
-    std::unique_ptr<WasmCode> wasm_code = native_module->AddCode(
-        result.func_index, result.code_desc, result.frame_slot_count,
-        result.tagged_parameter_slots,
-        result.protected_instructions_data.as_vector(),
-        result.source_positions.as_vector(), GetCodeKind(result),
-        ExecutionTier::kNone, kNoDebugging);
-    published_code = native_module->PublishCode(std::move(wasm_code));
-  }
-  (*cache_scope)[key] = published_code;
-  published_code->IncRef();
-  counters->wasm_generated_code_size()->Increment(
-      published_code->instructions().length());
-  counters->wasm_reloc_size()->Increment(published_code->reloc_info().length());
-  return published_code;
+    std::vector<std::unique_ptr<WasmCode>> codes;
+    codes.reserve(results.size());
+    for (WasmCompilationResult& result : results) {
+      codes.push_back(native_module->AddCode(
+          result.func_index, result.code_desc, result.frame_slot_count,
+          result.tagged_parameter_slots,
+          result.protected_instructions_data.as_vector(),
+          result.source_positions.as_vector(), GetCodeKind(result),
+          ExecutionTier::kNone, kNoDebugging));
+    }
+    published_code = native_module->PublishCode(base::VectorOf(codes));
+  }
+  DCHECK_EQ(keys.size(), published_code.size());
+  for (size_t i = 0; i < published_code.size(); ++i) {
+    WasmCode* code = published_code[i];
+    // The entry was inserted before compilation started, so this does not
+    // invalidate other threads' iterators/references.
+    DCHECK_NULL((*cache_scope)[keys[i]]);
+    (*cache_scope)[keys[i]] = code;
+    code->IncRef();
+    counters->wasm_generated_code_size()->Increment(
+        code->instructions().length());
+    counters->wasm_reloc_size()->Increment(code->reloc_info().length());
+  }
 }
 
 }  // namespace wasm
@@ -52,6 +52,7 @@ class NativeModule;
 class ProfileInformation;
 class StreamingDecoder;
 class WasmCode;
+struct WasmCompilationResult;
 struct WasmModule;
 
 V8_EXPORT_PRIVATE
@@ -77,6 +78,16 @@ WasmCode* CompileImportWrapper(
     uint32_t canonical_type_index, int expected_arity, Suspend suspend,
     WasmImportWrapperCache::ModificationScope* cache_scope);
 
+// Publishes the compiled wrappers for {keys} in one batch and sets the
+// corresponding cache entries, which must exist but not have been compiled
+// yet.
+V8_EXPORT_PRIVATE
+void PublishImportWrappers(
+    NativeModule* native_module, Counters* counters,
+    base::Vector<const WasmImportWrapperCache::CacheKey> keys,
+    base::Vector<WasmCompilationResult> results,
+    WasmImportWrapperCache::ModificationScope* cache_scope);
+
 // Triggered by the WasmCompileLazy builtin. The return value indicates whether
 // compilation was successful. Lazy compilation can fail only if validation is
 // also lazy.
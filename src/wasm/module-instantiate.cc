@@ -67,20 +67,36 @@ class CompileImportWrapperJob final : public JobTask {
 
   void Run(JobDelegate* delegate) override {
     TRACE_EVENT0("v8.wasm", "wasm.CompileImportWrapperJob.Run");
+    // Compiled wrappers are published in batches, to avoid repeated locking
+    // and permission switching.
+    std::vector<WasmImportWrapperCache::CacheKey> keys;
+    std::vector<WasmCompilationResult> results;
+    bool source_positions = is_asmjs_module(native_module_->module());
+    CompilationEnv env = native_module_->CreateCompilationEnv();
     while (base::Optional<std::pair<const WasmImportWrapperCache::CacheKey,
                                     const FunctionSig*>>
                key = queue_->pop()) {
-      // TODO(wasm): Batch code publishing, to avoid repeated locking and
-      // permission switching.
-      CompileImportWrapper(native_module_, counters_, key->first.kind,
-                           key->second, key->first.canonical_type_index,
-                           key->first.expected_arity, key->first.suspend,
-                           cache_scope_);
-      if (delegate->ShouldYield()) return;
+      results.push_back(compiler::CompileWasmImportCallWrapper(
+          &env, key->first.kind, key->second, source_positions,
+          key->first.expected_arity, key->first.suspend));
+      keys.push_back(key->first);
+      if (results.size() >= kMaxPublishBatchSize) Publish(&keys, &results);
+      if (delegate->ShouldYield()) break;
     }
+    Publish(&keys, &results);
   }
 
  private:
+  static constexpr size_t kMaxPublishBatchSize = 16;
+
+  void Publish(std::vector<WasmImportWrapperCache::CacheKey>* keys,
+               std::vector<WasmCompilationResult>* results) {
+    PublishImportWrappers(native_module_, counters_, base::VectorOf(*keys),
+                          base::VectorOf(*results), cache_scope_);
+    keys->clear();
+    results->clear();
+  }
+
   Counters* const counters_;
   NativeModule* const native_module_;
   ImportWrapperQueue* const queue_;
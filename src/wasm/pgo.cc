@@ -4,6 +4,8 @@
 
 #include "src/wasm/pgo.h"
 
+#include <algorithm>
+
 #include "src/wasm/decoder.h"
 #include "src/wasm/wasm-module-builder.h"  // For {ZoneBuffer}.
 
@@ -90,6 +92,9 @@ class ProfileGenerator {
       // TODO(13209): Make this less V8-specific for productionization.
       buffer.write_u8((was_executed ? kFunctionExecutedBit : 0) |
                       (was_tiered_up ? kFunctionTieredUpBit : 0));
+      // The tier-up priority grows with every tier-up request, so it serves
+      // as a measure of hotness.
+      if (was_tiered_up) buffer.write_u32v(static_cast<uint32_t>(prio));
     }
   }
 
@@ -146,7 +151,8 @@ void DeserializeTypeFeedback(Decoder& decoder, WasmModule* module) {
 std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
     Decoder& decoder, WasmModule* module) {
   std::vector<uint32_t> executed_functions;
-  std::vector<uint32_t> tiered_up_functions;
+  // Pairs of (tier-up priority, function index).
+  std::vector<std::pair<uint32_t, uint32_t>> tiered_up_with_priority;
   uint32_t start = module->num_imported_functions;
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; ++func_index) {
@@ -154,10 +160,25 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
     CHECK_EQ(0, tiering_info & ~3);
     bool was_executed = tiering_info & kFunctionExecutedBit;
     bool was_tiered_up = tiering_info & kFunctionTieredUpBit;
-    if (was_tiered_up) tiered_up_functions.push_back(func_index);
+    if (was_tiered_up) {
+      uint32_t priority = decoder.consume_u32v("tier-up priority");
+      tiered_up_with_priority.emplace_back(priority, func_index);
+    }
     if (was_executed) executed_functions.push_back(func_index);
   }
 
+  // Order tiered-up functions hottest first (by function index on ties).
+  std::stable_sort(tiered_up_with_priority.begin(),
+                   tiered_up_with_priority.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.first > b.first;
+                   });
+  std::vector<uint32_t> tiered_up_functions;
+  tiered_up_functions.reserve(tiered_up_with_priority.size());
+  for (const auto& entry : tiered_up_with_priority) {
+    tiered_up_functions.push_back(entry.second);
+  }
+
   return std::make_unique<ProfileInformation>(std::move(executed_functions),
                                               std::move(tiered_up_functions));
 }
@@ -31,6 +31,7 @@ class ProfileInformation {
   base::Vector<const uint32_t> executed_functions() const {
     return base::VectorOf(executed_functions_);
   }
+  // Sorted by descending hotness in the profiling run.
   base::Vector<const uint32_t> tiered_up_functions() const {
     return base::VectorOf(tiered_up_functions_);
   }
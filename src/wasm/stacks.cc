@@ -21,8 +21,14 @@ StackMemory::~StackMemory() {
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Delete stack #%d\n", id_);
   }
-  PageAllocator* allocator = GetPlatformPageAllocator();
-  if (owned_) allocator->DecommitPages(limit_, size_);
+  if (owned_) {
+    StackPool* pool = isolate_->wasm_stack_pool();
+    if (pool != nullptr) {
+      pool->Add(limit_, size_);
+    } else {
+      GetPlatformPageAllocator()->DecommitPages(limit_, size_);
+    }
+  }
   // We don't need to handle removing the last stack from the list (next_ ==
   // this). This only happens on isolate tear down, otherwise there is always
   // at least one reachable stack (the active stack).
@@ -45,6 +51,15 @@ StackMemory::StackMemory(Isolate* isolate) : isolate_(isolate), owned_(true) {
   int kJsStackSizeKB = v8_flags.wasm_stack_switching_stack_size;
   size_ = (kJsStackSizeKB + kJSLimitOffsetKB) * KB;
   size_ = RoundUp(size_, allocator->AllocatePageSize());
+  StackPool* pool = isolate->wasm_stack_pool();
+  limit_ = pool != nullptr ? pool->TryGet(size_) : nullptr;
+  if (limit_ != nullptr) {
+    if (v8_flags.trace_wasm_stack_switching) {
+      PrintF("Reuse stack #%d (limit: %p, base: %p)\n", id_, limit_,
+             limit_ + size_);
+    }
+    return;
+  }
   limit_ = static_cast<byte*>(
       allocator->AllocatePages(nullptr, size_, allocator->AllocatePageSize(),
                                PageAllocator::kReadWrite));
@@ -60,4 +75,29 @@ StackMemory::StackMemory(Isolate* isolate, byte* limit, size_t size)
   id_ = 0;
 }
 
+StackPool::~StackPool() {
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  for (const Segment& segment : segments_) {
+    allocator->DecommitPages(segment.limit, segment.size);
+  }
+}
+
+byte* StackPool::TryGet(size_t size) {
+  for (auto it = segments_.rbegin(); it != segments_.rend(); ++it) {
+    if (it->size != size) continue;
+    byte* limit = it->limit;
+    segments_.erase(std::next(it).base());
+    return limit;
+  }
+  return nullptr;
+}
+
+void StackPool::Add(byte* limit, size_t size) {
+  if (segments_.size() >= static_cast<size_t>(v8_flags.wasm_stack_pool_size)) {
+    GetPlatformPageAllocator()->DecommitPages(limit, size);
+    return;
+  }
+  segments_.push_back({limit, size});
+}
+
 }  // namespace v8::internal::wasm
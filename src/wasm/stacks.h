@@ -9,6 +9,8 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <vector>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/utils/allocation.h"
@@ -30,6 +32,31 @@ constexpr int kJmpBufPcOffset = offsetof(JumpBuffer, pc);
 constexpr int kJmpBufStackLimitOffset = offsetof(JumpBuffer, stack_limit);
 constexpr int kJmpBufStateOffset = offsetof(JumpBuffer, state);
 
+// Caches the segments of retired stacks, so that creating a new stack does not
+// have to map and commit fresh pages. The pool is owned by the isolate and
+// holds at most {v8_flags.wasm_stack_pool_size} segments; segments beyond that
+// are released immediately.
+class StackPool {
+ public:
+  StackPool() = default;
+  StackPool(const StackPool&) = delete;
+  StackPool& operator=(const StackPool&) = delete;
+  ~StackPool();
+
+  // Returns a cached segment of {size} bytes, or nullptr if there is none.
+  byte* TryGet(size_t size);
+
+  // Takes ownership of the segment, or releases it if the pool is full.
+  void Add(byte* limit, size_t size);
+
+ private:
+  struct Segment {
+    byte* limit;
+    size_t size;
+  };
+  std::vector<Segment> segments_;
+};
+
 class StackMemory {
  public:
   static StackMemory* New(Isolate* isolate) { return new StackMemory(isolate); }
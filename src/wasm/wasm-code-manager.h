@@ -974,7 +974,11 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // A cache of the import wrappers, keyed on the kind and signature.
   std::unique_ptr<WasmImportWrapperCache> import_wrapper_cache_;
 
-  // Array to handle number of function calls.
+  // Array to handle number of function calls. It is shared by all instances
+  // of this module, including instances in other isolates that got this
+  // NativeModule from the native module cache, so hotness is aggregated across
+  // isolates. Updates from generated code are not atomic; lost updates only
+  // delay tier-up slightly.
   std::unique_ptr<uint32_t[]> tiering_budgets_;
 
   // This mutex protects concurrent calls to {AddCode} and friends.
@@ -4,11 +4,14 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -80,7 +83,7 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -90,6 +93,9 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* pooled = GetSegmentFromPool(bytes)) {
+    memory = pooled;
+    bytes = pooled->total_size();
   } else {
     auto result = AllocAtLeastWithRetry(bytes);
     memory = result.ptr;
@@ -113,13 +119,73 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
-  } else {
+  } else if (!AddSegmentToPool(segment)) {
+    segment->ZapHeader();
     free(segment);
   }
 }
 
+Segment* AccountingAllocator::GetSegmentFromPool(size_t bytes) {
+  if (segment_pool_bytes_.load(std::memory_order_relaxed) == 0) return nullptr;
+  if (bytes > size_t{1} << kMaxPooledSegmentSizeLog2) return nullptr;
+  // The smallest class whose segments all hold at least {bytes}.
+  int size_class =
+      base::bits::WhichPowerOfTwo(base::bits::RoundUpToPowerOfTwo(
+          std::max(bytes, size_t{1} << kMinPooledSegmentSizeLog2))) -
+      kMinPooledSegmentSizeLog2;
+  DCHECK_LT(size_class, kSegmentPoolSizeClasses);
+
+  base::MutexGuard guard(&segment_pool_mutex_);
+  Segment* segment = segment_pool_[size_class];
+  if (segment == nullptr) return nullptr;
+  segment_pool_[size_class] = segment->next();
+  segment_pool_bytes_.fetch_sub(segment->total_size(),
+                                std::memory_order_relaxed);
+  DCHECK_GE(segment->total_size(), bytes);
+  return segment;
+}
+
+bool AccountingAllocator::AddSegmentToPool(Segment* segment) {
+  size_t size = segment->total_size();
+  if (size < size_t{1} << kMinPooledSegmentSizeLog2 ||
+      size >= size_t{2} << kMaxPooledSegmentSizeLog2) {
+    return false;
+  }
+  // The class of the largest power of two that is at most {size}.
+  int size_class =
+      base::bits::WhichPowerOfTwo(base::bits::RoundUpToPowerOfTwo(size + 1)) -
+      1 - kMinPooledSegmentSizeLog2;
+  DCHECK_LT(size_class, kSegmentPoolSizeClasses);
+
+  base::MutexGuard guard(&segment_pool_mutex_);
+  if (segment_pool_bytes_.load(std::memory_order_relaxed) + size >
+      v8_flags.zone_segment_pool_size) {
+    return false;
+  }
+  segment->set_zone(nullptr);
+  segment->set_next(segment_pool_[size_class]);
+  segment_pool_[size_class] = segment;
+  segment_pool_bytes_.fetch_add(size, std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  base::MutexGuard guard(&segment_pool_mutex_);
+  for (Segment*& head : segment_pool_) {
+    while (head != nullptr) {
+      Segment* segment = head;
+      head = segment->next();
+      segment_pool_bytes_.fetch_sub(segment->total_size(),
+                                    std::memory_order_relaxed);
+      segment->ZapHeader();
+      free(segment);
+    }
+  }
+  DCHECK_EQ(0, segment_pool_bytes_.load(std::memory_order_relaxed));
+}
+
 }  // namespace internal
 }  // namespace v8
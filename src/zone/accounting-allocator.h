@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +47,17 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Returns the size of the segments kept in the segment pool. These are not
+  // part of GetCurrentMemoryUsage().
+  size_t GetPooledMemory() const {
+    return segment_pool_bytes_.load(std::memory_order_relaxed);
+  }
+
+  // Frees all segments in the segment pool. This happens under memory
+  // pressure, on low memory and idle notifications, and when the isolate
+  // goes to the background.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,6 +79,19 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Returned segments that are not in compressed zones are kept in a pool
+  // (up to --zone-segment-pool-size bytes), so that zones of later compile
+  // jobs reuse warm memory instead of going through malloc and free. Segments
+  // of total size [2^k, 2^(k+1)) are kept in size class k, and a request for
+  // n bytes is served from the class that holds segments of at least n bytes.
+  static constexpr int kMinPooledSegmentSizeLog2 = 13;  // 8 KB
+  static constexpr int kMaxPooledSegmentSizeLog2 = 16;  // Up to 128 KB
+  static constexpr int kSegmentPoolSizeClasses =
+      kMaxPooledSegmentSizeLog2 - kMinPooledSegmentSizeLog2 + 1;
+
+  Segment* GetSegmentFromPool(size_t bytes);
+  bool AddSegmentToPool(Segment* segment);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
@@ -75,6 +100,11 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
   ZoneBackingAllocator::MallocFn zone_backing_malloc_ = nullptr;
   ZoneBackingAllocator::FreeFn zone_backing_free_ = nullptr;
+
+  base::Mutex segment_pool_mutex_;
+  // LIFO lists of pooled segments, linked through Segment::next().
+  Segment* segment_pool_[kSegmentPoolSizeClasses] = {};
+  std::atomic<size_t> segment_pool_bytes_{0};
 };
 
 }  // namespace internal
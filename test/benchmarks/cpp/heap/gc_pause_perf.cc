@@ -0,0 +1,183 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures GC pauses of a full isolate running a server-like allocation
+// profile. Each benchmark iteration handles one "request" which allocates
+// request-scoped garbage, replaces entries in a long-lived cache and
+// optionally allocates an ArrayBuffer backing store. Pause times are taken
+// from the metrics events reported by the GCTracer.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-metrics.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+v8::Platform* g_platform = nullptr;
+
+class GCPauseRecorder final : public v8::metrics::Recorder {
+ public:
+  using v8::metrics::Recorder::AddMainThreadEvent;
+
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionYoungCycle& event,
+                          ContextId) final {
+    young_pauses_.push_back(event.main_thread_wall_clock_duration_in_us);
+  }
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionFullCycle& event,
+                          ContextId) final {
+    full_pauses_.push_back(
+        event.main_thread_atomic.total_wall_clock_duration_in_us);
+  }
+
+  void Report(benchmark::State& state) {
+    Report(state, "scavenge", &young_pauses_);
+    Report(state, "mark_compact", &full_pauses_);
+  }
+
+ private:
+  static void Report(benchmark::State& state, const char* name,
+                     std::vector<int64_t>* pauses) {
+    std::string prefix(name);
+    state.counters[prefix + "_count"] = static_cast<double>(pauses->size());
+    if (pauses->empty()) return;
+    std::sort(pauses->begin(), pauses->end());
+    auto percentile = [pauses](double p) {
+      size_t index = static_cast<size_t>(p * (pauses->size() - 1));
+      return static_cast<double>((*pauses)[index]);
+    };
+    state.counters[prefix + "_p50_us"] = percentile(0.5);
+    state.counters[prefix + "_p90_us"] = percentile(0.9);
+    state.counters[prefix + "_p99_us"] = percentile(0.99);
+    state.counters[prefix + "_max_us"] = static_cast<double>(pauses->back());
+  }
+
+  std::vector<int64_t> young_pauses_;
+  std::vector<int64_t> full_pauses_;
+};
+
+constexpr char kServerSource[] = R"(
+const kCacheSize = 50000;
+const cache = new Array(kCacheSize);
+let next = 0;
+function handleRequest(garbageObjects, cacheChurn, bufferBytes) {
+  const garbage = [];
+  for (let i = 0; i < garbageObjects; i++) {
+    garbage.push({id: i, name: 'request-' + i, tags: [i, i + 1]});
+  }
+  for (let i = 0; i < cacheChurn; i++) {
+    cache[next++ % kCacheSize] = {key: 'entry-' + next, value: garbage[i]};
+  }
+  if (bufferBytes > 0) garbage.push(new ArrayBuffer(bufferBytes));
+  return garbage.length;
+}
+)";
+
+class ServerAllocation : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State& state) override {
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    isolate_ = v8::Isolate::New(create_params);
+    recorder_ = std::make_shared<GCPauseRecorder>();
+    isolate_->SetMetricsRecorder(recorder_);
+  }
+
+  void TearDown(benchmark::State& state) override {
+    isolate_->Dispose();
+    isolate_ = nullptr;
+    recorder_.reset();
+    allocator_.reset();
+  }
+
+ protected:
+  v8::Isolate* isolate_ = nullptr;
+  std::shared_ptr<GCPauseRecorder> recorder_;
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+};
+
+// Arguments: objects of request-scoped garbage, cache entries replaced and
+// ArrayBuffer bytes allocated per request.
+BENCHMARK_DEFINE_F(ServerAllocation, Requests)(benchmark::State& state) {
+  v8::Isolate::Scope isolate_scope(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = v8::Context::New(isolate_);
+  v8::Context::Scope context_scope(context);
+
+  v8::Local<v8::String> source =
+      v8::String::NewFromUtf8Literal(isolate_, kServerSource);
+  v8::Script::Compile(context, source)
+      .ToLocalChecked()
+      ->Run(context)
+      .ToLocalChecked();
+  v8::Local<v8::Function> handle_request = v8::Local<v8::Function>::Cast(
+      context->Global()
+          ->Get(context, v8::String::NewFromUtf8Literal(isolate_,
+                                                        "handleRequest"))
+          .ToLocalChecked());
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(isolate_, static_cast<int>(state.range(0))),
+      v8::Integer::New(isolate_, static_cast<int>(state.range(1))),
+      v8::Integer::New(isolate_, static_cast<int>(state.range(2)))};
+
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(isolate_);
+    benchmark::DoNotOptimize(
+        handle_request->Call(context, context->Global(), arraysize(args), args)
+            .ToLocalChecked());
+    // Run pending GC tasks (e.g. incremental marking steps) like an embedder
+    // would between requests.
+    while (v8::platform::PumpMessageLoop(g_platform, isolate_)) {
+    }
+  }
+  recorder_->Report(state);
+}
+
+BENCHMARK_REGISTER_F(ServerAllocation, Requests)
+    ->ArgNames({"garbage", "cache_churn", "buffer_bytes"})
+    // Mostly short-lived garbage.
+    ->Args({1000, 0, 0})
+    // Garbage plus a churning long-lived cache, to promote objects.
+    ->Args({1000, 100, 0})
+    // Garbage plus external ArrayBuffer backing stores.
+    ->Args({1000, 0, 64 * 1024})
+    ->Args({1000, 100, 64 * 1024});
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  g_platform = platform.get();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  return 0;
+}
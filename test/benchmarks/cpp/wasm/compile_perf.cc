@@ -0,0 +1,235 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures Wasm compilation throughput for synthesized modules of a given
+// shape: Liftoff and TurboFan compilation of the whole module, and
+// deserialization of a serialized module. Throughput is reported in bytes of
+// wire bytes per second.
+
+#include <memory>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/handles/handles-inl.h"
+#include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-opcodes.h"
+#include "src/wasm/wasm-serialization.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "test/common/flag-utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace base = v8::base;
+namespace i = v8::internal;
+namespace wasm = v8::internal::wasm;
+
+constexpr wasm::ValueType kI32I32Reps[] = {wasm::kWasmI32, wasm::kWasmI32};
+constexpr wasm::FunctionSig kSigI32I32(1, 1, kI32I32Reps);
+
+// Builds a module with {function_count} functions of type i32 -> i32, each
+// with {body_ops} blocks of straight-line arithmetic and a call to the
+// previous function.
+std::vector<uint8_t> BuildModule(int function_count, int body_ops) {
+  i::AccountingAllocator allocator;
+  i::Zone zone(&allocator, "wasm compile benchmark");
+  wasm::WasmModuleBuilder builder(&zone);
+  for (int f = 0; f < function_count; f++) {
+    wasm::WasmFunctionBuilder* function = builder.AddFunction(&kSigI32I32);
+    uint32_t sum = function->AddLocal(wasm::kWasmI32);
+    for (int op = 0; op < body_ops; op++) {
+      function->EmitGetLocal(0);
+      function->EmitI32Const(op + f);
+      function->Emit(wasm::kExprI32Mul);
+      function->EmitGetLocal(sum);
+      function->Emit(op % 2 ? wasm::kExprI32Add : wasm::kExprI32Xor);
+      function->EmitSetLocal(sum);
+    }
+    function->EmitGetLocal(sum);
+    if (f > 0) {
+      function->EmitWithU32V(wasm::kExprCallFunction, f - 1);
+    }
+    function->Emit(wasm::kExprEnd);
+    if (f == function_count - 1) {
+      builder.AddExport(base::CStrVector("main"), function);
+    }
+  }
+  wasm::ZoneBuffer buffer(&zone);
+  builder.WriteTo(&buffer);
+  return std::vector<uint8_t>(buffer.begin(), buffer.end());
+}
+
+class WasmCompile : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State& state) override {
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    isolate_ = v8::Isolate::New(create_params);
+    wire_bytes_ = BuildModule(static_cast<int>(state.range(0)),
+                              static_cast<int>(state.range(1)));
+  }
+
+  void TearDown(benchmark::State& state) override {
+    isolate_->Dispose();
+    isolate_ = nullptr;
+    allocator_.reset();
+  }
+
+ protected:
+  i::Isolate* i_isolate() { return reinterpret_cast<i::Isolate*>(isolate_); }
+
+  i::Handle<i::WasmModuleObject> Compile() {
+    wasm::ErrorThrower thrower(i_isolate(), "WasmCompile");
+    return wasm::GetWasmEngine()
+        ->SyncCompile(i_isolate(), wasm::WasmFeatures::FromIsolate(i_isolate()),
+                      &thrower,
+                      wasm::ModuleWireBytes(base::VectorOf(wire_bytes_)))
+        .ToHandleChecked();
+  }
+
+  // Checks that every function of {native_module} was compiled with {tier},
+  // so that the benchmarks don't just measure decoding and validation.
+  static void CheckCompiled(const wasm::NativeModule* native_module,
+                            wasm::ExecutionTier tier) {
+    const wasm::WasmModule* module = native_module->module();
+    for (uint32_t index = module->num_imported_functions;
+         index < module->functions.size(); index++) {
+      CHECK(native_module->HasCodeWithTier(index, tier));
+    }
+  }
+
+  // Compiles the module on every iteration with the given tier.
+  void RunCompile(benchmark::State& state, bool liftoff) {
+    FLAG_VALUE_SCOPE(liftoff, liftoff);
+    v8::Isolate::Scope isolate_scope(isolate_);
+    v8::HandleScope handle_scope(isolate_);
+    v8::Context::Scope context_scope(v8::Context::New(isolate_));
+    {
+      i::HandleScope scope(i_isolate());
+      CheckCompiled(Compile()->native_module(),
+                    liftoff ? wasm::ExecutionTier::kLiftoff
+                            : wasm::ExecutionTier::kTurbofan);
+    }
+    for (auto _ : state) {
+      USE(_);
+      i::HandleScope scope(i_isolate());
+      benchmark::DoNotOptimize(Compile());
+    }
+    Report(state);
+  }
+
+  void Report(benchmark::State& state) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(wire_bytes_.size()));
+    state.counters["module_bytes"] = static_cast<double>(wire_bytes_.size());
+  }
+
+  v8::Isolate* isolate_ = nullptr;
+  std::vector<uint8_t> wire_bytes_;
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+};
+
+// Arguments: number of functions and arithmetic blocks per function.
+BENCHMARK_DEFINE_F(WasmCompile, Liftoff)(benchmark::State& state) {
+  RunCompile(state, true);
+}
+
+// The cost of tiering up a whole module: every function is compiled with
+// TurboFan.
+BENCHMARK_DEFINE_F(WasmCompile, TurboFan)(benchmark::State& state) {
+  RunCompile(state, false);
+}
+
+// Deserializing a module compiled with TurboFan, as on a code cache hit.
+BENCHMARK_DEFINE_F(WasmCompile, Deserialize)(benchmark::State& state) {
+  FLAG_VALUE_SCOPE(liftoff, false);
+  v8::Isolate::Scope isolate_scope(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+  v8::Context::Scope context_scope(v8::Context::New(isolate_));
+
+  std::vector<uint8_t> serialized;
+  {
+    i::HandleScope scope(i_isolate());
+    wasm::NativeModule* native_module = Compile()->native_module();
+    CheckCompiled(native_module, wasm::ExecutionTier::kTurbofan);
+    wasm::WasmSerializer serializer(native_module);
+    serialized.resize(serializer.GetSerializedNativeModuleSize());
+    CHECK(serializer.SerializeNativeModule(base::VectorOf(serialized)));
+  }
+
+  {
+    i::HandleScope scope(i_isolate());
+    CheckCompiled(wasm::DeserializeNativeModule(i_isolate(),
+                                                base::VectorOf(serialized),
+                                                base::VectorOf(wire_bytes_), {})
+                      .ToHandleChecked()
+                      ->native_module(),
+                  wasm::ExecutionTier::kTurbofan);
+  }
+
+  for (auto _ : state) {
+    USE(_);
+    i::HandleScope scope(i_isolate());
+    benchmark::DoNotOptimize(
+        wasm::DeserializeNativeModule(i_isolate(), base::VectorOf(serialized),
+                                      base::VectorOf(wire_bytes_), {})
+            .ToHandleChecked());
+  }
+  Report(state);
+  state.counters["serialized_bytes"] = static_cast<double>(serialized.size());
+}
+
+#define MODULE_SHAPES                          \
+  ArgNames({"functions", "ops_per_function"}) \
+      ->Args({100, 10})                        \
+      ->Args({1000, 10})                       \
+      ->Args({1000, 100})                      \
+      ->Args({10000, 10})
+
+BENCHMARK_REGISTER_F(WasmCompile, Liftoff)->MODULE_SHAPES;
+BENCHMARK_REGISTER_F(WasmCompile, TurboFan)->MODULE_SHAPES;
+BENCHMARK_REGISTER_F(WasmCompile, Deserialize)->MODULE_SHAPES;
+
+#undef MODULE_SHAPES
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  // The native module cache would turn every compilation after the first into
+  // a cache hit, lazy compilation would only validate the function bodies, and
+  // the benchmarks change --liftoff after initialization.
+  v8::V8::SetFlagsFromString(
+      "--no-wasm-native-module-cache-enabled --no-wasm-lazy-compilation "
+      "--no-freeze-flags-after-init");
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  return 0;
+}
@@ -4,7 +4,10 @@
 
 #include <cmath>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -36,6 +39,7 @@ int PrintHelp(char** argv) {
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
+  V(kParallel, "parallel")           \
   V(kToom, "toom")                   \
   V(kToString, "tostring")
 
@@ -123,6 +127,24 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs every worker task on a thread of its own.
+class ThreadPlatform : public Platform {
+ public:
+  ~ThreadPlatform() override {
+    for (std::thread& thread : threads_) thread.join();
+  }
+
+  bool CanPostWorkerTasks() override { return true; }
+  void PostWorkerTask(std::function<void()> task) override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    threads_.emplace_back(std::move(task));
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::thread> threads_;
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -130,12 +152,17 @@ class Runner {
   void Initialize() {
     rng_.Initialize(random_seed_);
     processor_.reset(Processor::New(new Platform()));
+    parallel_processor_.reset(Processor::New(new ThreadPlatform()));
   }
 
   ProcessorImpl* processor() {
     return static_cast<ProcessorImpl*>(processor_.get());
   }
 
+  ProcessorImpl* parallel_processor() {
+    return static_cast<ProcessorImpl*>(parallel_processor_.get());
+  }
+
   int Run() {
     if (op_ == kList) {
       ListTests();
@@ -204,6 +231,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestParallel(&count);
+      }
     } else if (test_ == kToom) {
       for (int i = 0; i < runs_; i++) {
         TestToom(&count);
@@ -311,6 +342,32 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    // {MultiplyToomCookParallel} works for any size, so test a few random
+    // samples below and around the threshold, including unbalanced inputs.
+    for (int i = 0; i < 4; i++) {
+      uint64_t random_bits = rng_.NextUint64();
+      int right_size = kFftThreshold / 4 + static_cast<int>(random_bits & 4095);
+      random_bits >>= 12;
+      int left_size = right_size + static_cast<int>(random_bits & 8191);
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_fft(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      parallel_processor()->MultiplyToomCookParallel(result, A, B);
+      // Using FFT as reference.
+      processor()->MultiplyFFT(result_fft, A, B);
+      AssertEquals(A, B, result_fft, result);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
@@ -617,6 +674,7 @@ class Runner {
   int64_t random_seed_{314159265359};
   RNG rng_;
   std::unique_ptr<Processor, Processor::Destroyer> processor_;
+  std::unique_ptr<Processor, Processor::Destroyer> parallel_processor_;
 };
 
 }  // namespace test
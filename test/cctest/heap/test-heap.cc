@@ -45,6 +45,7 @@
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/factory.h"
+#include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-verifier.h"
@@ -1137,6 +1138,63 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOnMemoryReduction) {
+#ifndef V8_LITE_MODE
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.bytecode_old_age = 5;
+  i::v8_flags.bytecode_old_age_for_memory_reduction = 2;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared().is_compiled());
+
+    // Fewer GCs than --bytecode-old-age flush the code if they reduce memory.
+    for (int i = 0; i < 3; i++) {
+      CcTest::heap()->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                                        GarbageCollectionReason::kTesting);
+    }
+
+    CHECK(!function->shared().is_compiled());
+    CHECK(!function->is_compiled());
+    // Call foo to get it recompiled.
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+  }
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #ifndef V8_LITE_MODE
   v8_flags.turbofan = false;
@@ -2678,6 +2736,36 @@ TEST(IdleNotificationFinishMarking) {
   CHECK_EQ(CcTest::heap()->gc_count(), initial_gc_count + 1);
 }
 
+TEST(IdleNotificationForMillisecondsScavenge) {
+  if (v8_flags.single_generation) return;
+  ManualGCScope manual_gc_scope;
+  v8_flags.idle_time_scavenge = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  NewSpace* new_space = heap->new_space();
+  HandleScope scope(isolate);
+  heap->incremental_marking()->Stop();
+
+  const int initial_gc_count = heap->gc_count();
+  std::vector<Handle<FixedArray>> handles;
+  while (new_space->Size() <
+         new_space->Capacity() *
+             GCIdleTimeHandler::kScavengeNewSpaceFullnessRatio) {
+    heap::FillCurrentPage(new_space, &handles);
+  }
+  CHECK_EQ(heap->gc_count(), initial_gc_count);
+
+  // Without any idle time, the notification does nothing.
+  CcTest::isolate()->IdleNotificationForMilliseconds(0);
+  CHECK_EQ(heap->gc_count(), initial_gc_count);
+
+  // With enough idle time, the filled up new space gets scavenged.
+  const double kLongIdleTime = 1000.0;
+  CcTest::isolate()->IdleNotificationForMilliseconds(kLongIdleTime);
+  CHECK_EQ(heap->gc_count(), initial_gc_count + 1);
+}
+
 TEST(OptimizedPretenuringAllocationFolding) {
   v8_flags.allow_natives_syntax = true;
   v8_flags.expose_gc = true;
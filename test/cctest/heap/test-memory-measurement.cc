@@ -8,6 +8,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -90,6 +91,49 @@ TEST(NativeContextStatsArrayBuffers) {
                       *i_array_buffer, 10);
   CHECK_EQ(1010, stats.Get(native_context->ptr()));
 }
+TEST(InstanceTypeStatsMerge) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  const int kLength = 3;
+  Handle<FixedArray> array = factory->NewFixedArray(kLength);
+  for (int i = 0; i < kLength; i++) {
+    array->set(i, *factory->NewHeapNumber(i + 0.5));
+  }
+  // Count the array on the main thread and its elements on a concurrent
+  // marking task, and merge them as FlushInstanceTypeStats does.
+  InstanceTypeStats main_stats, task_stats;
+  main_stats.IncrementSize(array->map(), array->Size());
+  for (int i = 0; i < kLength; i++) {
+    HeapObject element = HeapObject::cast(array->get(i));
+    task_stats.IncrementSize(element.map(), element.Size());
+  }
+  CHECK_EQ(0, main_stats.Get(HEAP_NUMBER_TYPE));
+  main_stats.Merge(task_stats);
+  CHECK_EQ(array->Size(), main_stats.Get(FIXED_ARRAY_TYPE));
+  CHECK_EQ(kLength * HeapNumber::kSize, main_stats.Get(HEAP_NUMBER_TYPE));
+  CHECK_EQ(0, main_stats.Get(JS_OBJECT_TYPE));
+  // Merging into empty stats copies them, and merging empty stats is a no-op.
+  InstanceTypeStats copy, empty;
+  copy.Merge(main_stats);
+  copy.Merge(empty);
+  CHECK_EQ(array->Size(), copy.Get(FIXED_ARRAY_TYPE));
+  CHECK_EQ(kLength * HeapNumber::kSize, copy.Get(HEAP_NUMBER_TYPE));
+  main_stats.Clear();
+  CHECK_EQ(0, main_stats.Get(FIXED_ARRAY_TYPE));
+}
+
+TEST(InstanceTypeStatsDuringIncrementalMarking) {
+  if (!v8_flags.incremental_marking) return;
+  FLAG_SCOPE(trace_gc_live_bytes_by_type);
+  CcTest::InitializeVM();
+  // Counting, merging the concurrent tasks and printing must not get in the
+  // way of a full GC.
+  heap::SimulateIncrementalMarking(CcTest::heap(), false);
+  heap::InvokeMarkSweep();
+}
+
 namespace {
 
 class TestResource : public v8::String::ExternalStringResource {
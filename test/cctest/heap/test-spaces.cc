@@ -34,6 +34,7 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/macros.h"
 #include "src/base/platform/platform.h"
+#include "src/common/code-memory-access-inl.h"
 #include "src/common/globals.h"
 #include "src/heap/allocation-result.h"
 #include "src/heap/factory.h"
@@ -1032,6 +1033,35 @@ TEST(ReadOnlySpaceMetrics_TwoPages) {
   CHECK_EQ(faked_space->Capacity(), 2 * capacity_per_page);
 }
 
+#if V8_HEAP_USE_PKU_JIT_WRITE_PROTECT
+TEST(CodeSpaceWriteProtectionWithPKU) {
+  if (!RwxMemoryWriteScope::IsSupported()) return;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope handle_scope(isolate);
+
+  // With PKU the heap doesn't need to flip page permissions with mprotect.
+  CHECK(!heap->write_protect_code_memory());
+  CHECK(!RwxMemoryWriteScope::IsPKUWritable());
+  {
+    CodePageCollectionMemoryModificationScope outer(heap);
+    CHECK(RwxMemoryWriteScope::IsPKUWritable());
+    {
+      // Nested scopes keep the code space writable.
+      RwxMemoryWriteScopeForTesting inner;
+      CHECK(RwxMemoryWriteScope::IsPKUWritable());
+    }
+    CHECK(RwxMemoryWriteScope::IsPKUWritable());
+  }
+  CHECK(!RwxMemoryWriteScope::IsPKUWritable());
+
+  // Installing freshly compiled code leaves the code space read-only.
+  CompileRun("function f(a, b) { return a + b; } f(1, 2);");
+  CHECK(!RwxMemoryWriteScope::IsPKUWritable());
+}
+#endif  // V8_HEAP_USE_PKU_JIT_WRITE_PROTECT
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -3091,6 +3091,53 @@ THREADED_TEST(SetAlignedPointerInInternalFields) {
   delete[] heap_allocated_2;
 }
 
+THREADED_TEST(ObjectTemplateNewInstances) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  templ->SetInternalFieldCount(2);
+  templ->Set(isolate, "x", v8_num(42));
+
+  constexpr int kCount = 100;
+  int* heap_allocated = new int[2 * kCount];
+  void* fields[2 * kCount];
+  for (int i = 0; i < 2 * kCount; i++) fields[i] = &heap_allocated[i];
+
+  Local<v8::Object> instances[kCount];
+  CHECK(templ->NewInstances(env.local(), kCount, instances, fields).FromJust());
+  CcTest::CollectAllGarbage();
+  for (int i = 0; i < kCount; i++) {
+    CHECK_EQ(2, instances[i]->InternalFieldCount());
+    CHECK_EQ(&heap_allocated[2 * i],
+             instances[i]->GetAlignedPointerFromInternalField(0));
+    CHECK_EQ(&heap_allocated[2 * i + 1],
+             instances[i]->GetAlignedPointerFromInternalField(1));
+    CHECK_EQ(42, instances[i]
+                     ->Get(env.local(), v8_str("x"))
+                     .ToLocalChecked()
+                     ->Int32Value(env.local())
+                     .FromJust());
+    if (i > 0) CHECK(!instances[i]->StrictEquals(instances[i - 1]));
+  }
+
+  // Instances are independent of each other.
+  CHECK(instances[0]->Set(env.local(), v8_str("x"), v8_num(1)).FromJust());
+  CHECK_EQ(42, instances[1]
+                   ->Get(env.local(), v8_str("x"))
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+
+  Local<v8::Object> plain[3];
+  CHECK(templ->NewInstances(env.local(), 3, plain).FromJust());
+  CHECK_EQ(2, plain[2]->InternalFieldCount());
+  CHECK(templ->NewInstances(env.local(), 0, nullptr).FromJust());
+
+  delete[] heap_allocated;
+}
+
 static void CheckAlignedPointerInEmbedderData(LocalContext* env, int index,
                                               void* value) {
   CHECK_EQ(0, static_cast<int>(reinterpret_cast<uintptr_t>(value) & 0x1));
@@ -29154,6 +29201,54 @@ TEST(TriggerDelayedMainThreadMetricsEvent) {
   CHECK_EQ(recorder->count_, 1);  // Unchanged.
 }
 
+namespace {
+
+class DeoptimizationMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  std::vector<v8::metrics::Deoptimization> events_;
+
+  void AddMainThreadEvent(const v8::metrics::Deoptimization& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    events_.push_back(event);
+  }
+};
+
+}  // namespace
+
+TEST(TriggerDeoptimizationMetricsEvent) {
+  if (!i::v8_flags.turbofan || i::v8_flags.always_turbofan) return;
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.stress_concurrent_allocation = false;
+
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<DeoptimizationMetricsRecorder> recorder =
+      std::make_shared<DeoptimizationMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+  {
+    LocalContext env;
+    v8::HandleScope scope(iso);
+    CompileRun(
+        "function f(x) { return x + 1; };"
+        "%PrepareFunctionForOptimization(f);"
+        "f(1); f(2);"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f(3);"
+        "f('a');");
+    // The event is delivered from a delayed task.
+    CHECK(recorder->events_.empty());
+    v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(1100));
+    while (v8::platform::PumpMessageLoop(i::V8::GetCurrentPlatform(), iso)) {
+    }
+    CHECK_EQ(1, recorder->events_.size());
+    const v8::metrics::Deoptimization& event = recorder->events_[0];
+    CHECK_NOT_NULL(event.reason);
+    CHECK(!event.lazy);
+    CHECK_GE(event.bytecode_offset, 0);
+    CHECK_GT(event.script_id, 0);
+    CHECK_GE(event.function_start_position, 0);
+  }
+}
+
 TEST(TriggerThreadSafeMetricsEvent) {
   // Set up isolate and context.
   v8::Isolate* iso = CcTest::isolate();
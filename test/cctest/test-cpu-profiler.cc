@@ -28,7 +28,10 @@
 // Tests of the CPU profiler and utilities.
 
 #include <limits>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "include/libplatform/v8-tracing.h"
 #include "include/v8-fast-api-calls.h"
@@ -4765,6 +4768,229 @@ TEST(CpuProfileJSONSerialization) {
             ->Value() > 0);
 }
 
+namespace {
+
+// A minimal protobuf reader for the messages written by the pprof serializer.
+class PprofReader {
+ public:
+  PprofReader(const char* data, size_t length)
+      : pos_(reinterpret_cast<const uint8_t*>(data)), end_(pos_ + length) {}
+
+  bool Done() const { return pos_ == end_; }
+
+  uint64_t ReadVarint() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos_, end_);
+      CHECK_LT(shift, 64);
+      uint8_t byte = *pos_++;
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  }
+
+  // Reads a tag and returns its field number. Only varint (0) and
+  // length-delimited (2) fields are expected.
+  int ReadTag(int* wire_type) {
+    uint64_t tag = ReadVarint();
+    *wire_type = static_cast<int>(tag & 7);
+    CHECK(*wire_type == 0 || *wire_type == 2);
+    return static_cast<int>(tag >> 3);
+  }
+
+  PprofReader ReadMessage() {
+    uint64_t length = ReadVarint();
+    CHECK_LE(length, static_cast<uint64_t>(end_ - pos_));
+    PprofReader message(reinterpret_cast<const char*>(pos_), length);
+    pos_ += length;
+    return message;
+  }
+
+  std::string ReadString() {
+    PprofReader message = ReadMessage();
+    return std::string(reinterpret_cast<const char*>(message.pos_),
+                       message.end_ - message.pos_);
+  }
+
+  std::vector<uint64_t> ReadPackedVarints() {
+    PprofReader message = ReadMessage();
+    std::vector<uint64_t> values;
+    while (!message.Done()) values.push_back(message.ReadVarint());
+    return values;
+  }
+
+ private:
+  const uint8_t* pos_;
+  const uint8_t* end_;
+};
+
+struct PprofProfile {
+  struct Sample {
+    std::vector<uint64_t> location_ids;
+    std::vector<uint64_t> values;
+  };
+  std::vector<std::string> strings;
+  // Function id to the string id of its name.
+  std::map<uint64_t, uint64_t> function_names;
+  // Location id to the id of its function.
+  std::map<uint64_t, uint64_t> location_functions;
+  std::vector<Sample> samples;
+  uint64_t sample_type = 0;
+  uint64_t sample_unit = 0;
+};
+
+PprofProfile DecodePprof(const char* data, size_t length) {
+  PprofProfile profile;
+  PprofReader reader(data, length);
+  while (!reader.Done()) {
+    int wire_type;
+    int field = reader.ReadTag(&wire_type);
+    if (wire_type == 0) {
+      reader.ReadVarint();
+      continue;
+    }
+    switch (field) {
+      case 1: {  // sample_type
+        PprofReader value_type = reader.ReadMessage();
+        while (!value_type.Done()) {
+          int value_field = value_type.ReadTag(&wire_type);
+          uint64_t value = value_type.ReadVarint();
+          if (value_field == 1) profile.sample_type = value;
+          if (value_field == 2) profile.sample_unit = value;
+        }
+        break;
+      }
+      case 2: {  // sample
+        PprofReader sample = reader.ReadMessage();
+        PprofProfile::Sample decoded;
+        while (!sample.Done()) {
+          int sample_field = sample.ReadTag(&wire_type);
+          CHECK_EQ(2, wire_type);
+          std::vector<uint64_t> values = sample.ReadPackedVarints();
+          if (sample_field == 1) decoded.location_ids = values;
+          if (sample_field == 2) decoded.values = values;
+        }
+        profile.samples.push_back(decoded);
+        break;
+      }
+      case 4: {  // location
+        PprofReader location = reader.ReadMessage();
+        uint64_t id = 0;
+        uint64_t function_id = 0;
+        while (!location.Done()) {
+          int location_field = location.ReadTag(&wire_type);
+          if (location_field == 1) {
+            id = location.ReadVarint();
+          } else if (location_field == 4) {
+            PprofReader line = location.ReadMessage();
+            while (!line.Done()) {
+              int line_field = line.ReadTag(&wire_type);
+              uint64_t value = line.ReadVarint();
+              if (line_field == 1) function_id = value;
+            }
+          } else if (wire_type == 0) {
+            location.ReadVarint();
+          } else {
+            location.ReadMessage();
+          }
+        }
+        CHECK_NE(0, id);
+        CHECK(profile.location_functions.emplace(id, function_id).second);
+        break;
+      }
+      case 5: {  // function
+        PprofReader function = reader.ReadMessage();
+        uint64_t id = 0;
+        uint64_t name = 0;
+        while (!function.Done()) {
+          int function_field = function.ReadTag(&wire_type);
+          uint64_t value = function.ReadVarint();
+          if (function_field == 1) id = value;
+          if (function_field == 2) name = value;
+        }
+        CHECK_NE(0, id);
+        CHECK(profile.function_names.emplace(id, name).second);
+        break;
+      }
+      case 6:  // string_table
+        profile.strings.push_back(reader.ReadString());
+        break;
+      default:
+        reader.ReadMessage();
+        break;
+    }
+  }
+  return profile;
+}
+
+// Sums up the self ticks of every node below the root by its call stack,
+// written as the function names from the outermost caller to the leaf.
+void CollectPathTicks(const v8::CpuProfileNode* node, const std::string& path,
+                      std::map<std::string, uint64_t>* ticks) {
+  for (int i = 0; i < node->GetChildrenCount(); i++) {
+    const v8::CpuProfileNode* child = node->GetChild(i);
+    std::string child_path = path + "/" + child->GetFunctionNameStr();
+    if (child->GetHitCount() > 0) (*ticks)[child_path] += child->GetHitCount();
+    CollectPathTicks(child, child_path, ticks);
+  }
+}
+
+}  // namespace
+
+TEST(CpuProfilePprofSerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 100)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args), 100);
+
+  std::map<std::string, uint64_t> expected_ticks;
+  CollectPathTicks(profile->GetTopDownRoot(), "", &expected_ticks);
+  CHECK(!expected_ticks.empty());
+
+  TestJSONStream stream;
+  profile->Serialize(&stream, v8::CpuProfile::kPprof);
+  profile->Delete();
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  base::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+
+  PprofProfile pprof = DecodePprof(data.begin(), data.length());
+  CHECK(!pprof.strings.empty());
+  CHECK_EQ("", pprof.strings[0]);
+  CHECK_LT(pprof.sample_type, pprof.strings.size());
+  CHECK_LT(pprof.sample_unit, pprof.strings.size());
+  CHECK_EQ("samples", pprof.strings[pprof.sample_type]);
+  CHECK_EQ("count", pprof.strings[pprof.sample_unit]);
+
+  // Every sample resolves to a stack of known functions and, summed up by
+  // stack, the sample values match the ticks in the profile tree.
+  std::map<std::string, uint64_t> pprof_ticks;
+  for (const PprofProfile::Sample& sample : pprof.samples) {
+    CHECK(!sample.location_ids.empty());
+    CHECK_EQ(1u, sample.values.size());
+    CHECK_GT(sample.values[0], 0);
+    std::string path;
+    // Location ids go from the leaf to the outermost caller.
+    for (uint64_t location_id : sample.location_ids) {
+      auto location = pprof.location_functions.find(location_id);
+      CHECK(location != pprof.location_functions.end());
+      auto function_name = pprof.function_names.find(location->second);
+      CHECK(function_name != pprof.function_names.end());
+      CHECK_LT(function_name->second, pprof.strings.size());
+      path = "/" + pprof.strings[function_name->second] + path;
+    }
+    pprof_ticks[path] += sample.values[0];
+  }
+  CHECK(expected_ticks == pprof_ticks);
+  CHECK_LT(0, pprof_ticks.count("/start/foo/delay/loop"));
+  CHECK_LT(0, pprof_ticks.count("/start/foo/bar/delay/loop"));
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
@@ -6012,3 +6012,37 @@ TEST(DebugEvaluateInWrappedScript) {
   v8::debug::SetDebugDelegate(env->GetIsolate(), nullptr);
   CheckDebuggerUnloaded();
 }
+
+UNINITIALIZED_TEST(MegamorphicICSites) {
+  i::v8_flags.megamorphic_ic_stats = true;
+  i::v8_flags.lazy_feedback_allocation = false;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope scope(isolate);
+    LocalContext context(isolate);
+    // Every object has a different map, so the load of o.x goes megamorphic
+    // and keeps missing in the StubCache.
+    CompileRun(
+        "function load(o) { return o.x; }\n"
+        "for (let i = 0; i < 100; i++) load({x: i, ['y' + i]: i});\n");
+    std::vector<v8::debug::MegamorphicICSite> sites;
+    CHECK(v8::debug::GetMegamorphicICSites(isolate, &sites));
+    // The keyed define of the computed property goes megamorphic as well, but
+    // does not use the StubCache.
+    int sites_with_misses = 0;
+    for (const v8::debug::MegamorphicICSite& site : sites) {
+      CHECK_EQ(1, site.transitions);
+      if (site.stub_cache_misses > 0) sites_with_misses++;
+    }
+    CHECK_EQ(1, sites_with_misses);
+
+    v8::debug::ResetMegamorphicICSites(isolate);
+    sites.clear();
+    CHECK(v8::debug::GetMegamorphicICSites(isolate, &sites));
+    CHECK(sites.empty());
+  }
+  isolate->Dispose();
+}
@@ -1179,6 +1179,74 @@ TEST(HeapSnapshotJSONSerialization) {
                      *v8::String::Utf8Value(env->GetIsolate(), string)));
 }
 
+TEST(HeapSnapshotStreamedJSONSerialization) {
+  v8::Isolate* isolate = CcTest::isolate();
+  LocalContext env;
+  v8::HandleScope scope(isolate);
+  v8::HeapProfiler* heap_profiler = isolate->GetHeapProfiler();
+
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('streamed string');");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  const int snapshot_count = heap_profiler->GetSnapshotCount();
+
+  v8::internal::TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  // Streamed snapshots are not retained by the profiler.
+  CHECK_EQ(snapshot_count, heap_profiler->GetSnapshotCount());
+  v8::base::ScopedVector<char> json(stream.size());
+  stream.WriteTo(json);
+
+  v8::internal::OneByteResource* json_res =
+      new v8::internal::OneByteResource(json);
+  v8::Local<v8::String> json_string =
+      v8::String::NewExternalOneByte(env->GetIsolate(), json_res)
+          .ToLocalChecked();
+  v8::Local<v8::Context> context = v8::Context::New(env->GetIsolate());
+  v8::Local<v8::Value> snapshot_parse_result =
+      v8::JSON::Parse(context, json_string).ToLocalChecked();
+  CHECK(snapshot_parse_result->IsObject());
+  env->Global()
+      ->Set(env.local(), v8_str("parsed"), snapshot_parse_result)
+      .FromJust();
+
+  // The streamed edge records carry their owner and agree with the edge
+  // counts of the nodes.
+  v8::Local<v8::Value> result = CompileRun(
+      "var meta = parsed.snapshot.meta;\n"
+      "var node_fields_count = meta.node_fields.length;\n"
+      "var edge_count_offset = meta.node_fields.indexOf('edge_count');\n"
+      "var edge_fields_count = meta.streamed_edge_fields.length;\n"
+      "var edge_from_offset =\n"
+      "    meta.streamed_edge_fields.indexOf('from_node');\n"
+      "var counts = new Map();\n"
+      "for (var i = 0; i < parsed.edges.length; i += edge_fields_count) {\n"
+      "  var from = parsed.edges[i + edge_from_offset];\n"
+      "  counts.set(from, (counts.get(from) || 0) + 1);\n"
+      "}\n"
+      "var consistent = parsed.edges.length ==\n"
+      "    parsed.snapshot.edge_count * edge_fields_count;\n"
+      "for (var i = 0; i < parsed.nodes.length; i += node_fields_count) {\n"
+      "  if ((counts.get(i) || 0) != parsed.nodes[i + edge_count_offset])\n"
+      "    consistent = false;\n"
+      "}\n"
+      "consistent && parsed.strings.indexOf('streamed string') != -1;");
+  CHECK(result->IsTrue());
+}
+
+TEST(HeapSnapshotStreamedJSONSerializationAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  v8::internal::TestJSONStream stream(5);
+  CHECK(!heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
 
 TEST(HeapSnapshotJSONSerializationAborting) {
   LocalContext env;
@@ -3893,6 +3961,49 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerApiSamplesSurvivedGCs) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(1024);
+  CompileRun(
+      "var retained = [];"
+      "for (var i = 0; i < 8 * 1024; ++i) retained.push({i});");
+
+  uint64_t last_sample_id_before_gc = 0;
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile());
+    CHECK(!profile->GetSamples().empty());
+    for (auto& sample : profile->GetSamples()) {
+      CHECK_GE(sample.gcs_survived, sample.full_gcs_survived);
+      last_sample_id_before_gc =
+          std::max(last_sample_id_before_gc, sample.sample_id);
+    }
+  }
+
+  CcTest::CollectAllGarbage();
+
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile());
+    int survivors = 0;
+    for (auto& sample : profile->GetSamples()) {
+      CHECK_GE(sample.gcs_survived, sample.full_gcs_survived);
+      // Building the profile may itself allocate new samples.
+      if (sample.sample_id > last_sample_id_before_gc) continue;
+      CHECK_GE(sample.full_gcs_survived, 1);
+      survivors++;
+    }
+    CHECK_GT(survivors, 0);
+  }
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
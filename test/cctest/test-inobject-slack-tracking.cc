@@ -1358,6 +1358,44 @@ TEST(Regress8853_FunctionConstructor) {
   CHECK_EQ(6 + 8, obj->map().GetInObjectProperties());
 }
 
+static void TestGrowthAfterConstruction(bool growth_reserve) {
+  // Avoid eventual completion of in-object slack tracking.
+  v8_flags.always_turbofan = false;
+  v8_flags.slack_tracking_growth_reserve = growth_reserve;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun(
+      "function B() {"
+      "  this.a = 1;"
+      "  this.b = 2;"
+      "}"
+      "var objects = [];");
+
+  // Every object gets one property more than the constructor adds.
+  v8::Local<v8::Script> new_B_script =
+      v8_compile("var o = new B(); o.c = 3; objects.push(o); o;");
+  Handle<JSObject> obj = RunI<JSObject>(new_B_script);
+  Handle<JSFunction> func = GetGlobal<JSFunction>("B");
+  Handle<Map> initial_map(func->initial_map(), func->GetIsolate());
+  CHECK_EQ(2 + 8, initial_map->GetInObjectProperties());
+
+  for (int i = 1; i < Map::kGenerousAllocationCount; i++) {
+    CHECK(initial_map->IsInobjectSlackTrackingInProgress());
+    RunI<JSObject>(new_B_script);
+  }
+  CHECK(!initial_map->IsInobjectSlackTrackingInProgress());
+
+  // The growth observed during tracking is kept as slack if requested.
+  CHECK_EQ(growth_reserve ? 4 : 3, obj->map().GetInObjectProperties());
+  CHECK_EQ(growth_reserve ? 1 : 0, obj->map().UnusedPropertyFields());
+}
+
+TEST(GrowthAfterConstruction) { TestGrowthAfterConstruction(false); }
+
+TEST(GrowthAfterConstructionWithReserve) {
+  TestGrowthAfterConstruction(true);
+}
+
 TEST(InstanceFieldsArePropertiesDefaultConstructorLazy) {
   CcTest::InitializeVM();
   v8::HandleScope scope(CcTest::isolate());
@@ -485,6 +485,10 @@ class InspectorExtension : public InspectorIsolateData::SetupGlobalTask {
         isolate, "dumpAsyncTaskStacksStateForTest",
         v8::FunctionTemplate::New(
             isolate, &InspectorExtension::DumpAsyncTaskStacksStateForTest));
+    inspector->Set(
+        isolate, "setLazyAsyncStackTraces",
+        v8::FunctionTemplate::New(
+            isolate, &InspectorExtension::SetLazyAsyncStackTraces));
     inspector->Set(
         isolate, "breakProgram",
         v8::FunctionTemplate::New(isolate, &InspectorExtension::BreakProgram));
@@ -584,6 +588,15 @@ class InspectorExtension : public InspectorIsolateData::SetupGlobalTask {
         ->DumpAsyncTaskStacksStateForTest();
   }
 
+  static void SetLazyAsyncStackTraces(
+      const v8::FunctionCallbackInfo<v8::Value>& args) {
+    if (args.Length() != 1 || !args[0]->IsBoolean()) {
+      FATAL("Internal error: setLazyAsyncStackTraces(lazy).");
+    }
+    InspectorIsolateData::FromContext(args.GetIsolate()->GetCurrentContext())
+        ->SetLazyAsyncStackTraces(args[0].As<v8::Boolean>()->Value());
+  }
+
   static void BreakProgram(const v8::FunctionCallbackInfo<v8::Value>& args) {
     if (args.Length() != 2 || !args[0]->IsString() || !args[1]->IsString()) {
       FATAL("Internal error: breakProgram('reason', 'details').");
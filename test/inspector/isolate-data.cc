@@ -274,6 +274,11 @@ void InspectorIsolateData::DumpAsyncTaskStacksStateForTest() {
   v8_inspector::DumpAsyncTaskStacksStateForTest(inspector_.get());
 }
 
+void InspectorIsolateData::SetLazyAsyncStackTraces(bool lazy) {
+  v8::SealHandleScope seal_handle_scope(isolate());
+  inspector_->setLazyAsyncStackTraces(lazy);
+}
+
 // static
 int InspectorIsolateData::HandleMessage(v8::Local<v8::Message> message,
                                         v8::Local<v8::Value> exception) {
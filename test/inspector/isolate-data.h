@@ -102,6 +102,7 @@ class InspectorIsolateData : public v8_inspector::V8InspectorClient {
   void SetAdditionalConsoleApi(v8_inspector::StringView api_script);
   void SetMaxAsyncTaskStacksForTest(int limit);
   void DumpAsyncTaskStacksStateForTest();
+  void SetLazyAsyncStackTraces(bool lazy);
   void FireContextCreated(v8::Local<v8::Context> context, int context_group_id,
                           v8_inspector::StringView name);
   void FireContextDestroyed(v8::Local<v8::Context> context);
@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Alternates between more locales than the toLocaleString caches hold, and
+// checks that every call formats as a fresh formatter would.
+const locales = ['en', 'de', 'ar', 'ja', 'fr', 'hi', undefined];
+const number = 1234567.891;
+const date = new Date(2022, 5, 15, 13, 45, 30);
+
+const expected = locales.map(locale => ({
+  number: new Intl.NumberFormat(locale).format(number),
+  dateTime: new Intl.DateTimeFormat(locale, {
+    year: 'numeric', month: 'numeric', day: 'numeric',
+    hour: 'numeric', minute: 'numeric', second: 'numeric'}).format(date),
+  date: new Intl.DateTimeFormat(locale).format(date),
+  time: new Intl.DateTimeFormat(locale, {
+    hour: 'numeric', minute: 'numeric', second: 'numeric'}).format(date),
+}));
+
+for (let round = 0; round < 3; round++) {
+  for (let i = 0; i < locales.length; i++) {
+    const locale = locales[i];
+    assertEquals(expected[i].number, number.toLocaleString(locale));
+    assertEquals(expected[i].dateTime, date.toLocaleString(locale));
+    assertEquals(expected[i].date, date.toLocaleDateString(locale));
+    assertEquals(expected[i].time, date.toLocaleTimeString(locale));
+  }
+  // Revisit the most recently used locales in reverse order.
+  for (let i = locales.length - 1; i >= locales.length - 3; i--) {
+    const locale = locales[i];
+    assertEquals(expected[i].number, number.toLocaleString(locale));
+    assertEquals(expected[i].date, date.toLocaleDateString(locale));
+  }
+}
+
+// Options bypass the per-locale cache, but still share formats with the same
+// resolved options.
+for (let i = 0; i < 20; i++) {
+  const options = {month: i % 2 ? 'long' : 'short', day: 'numeric'};
+  assertEquals(new Intl.DateTimeFormat('en', options).format(date),
+               date.toLocaleDateString('en', options));
+}
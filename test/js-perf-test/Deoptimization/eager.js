@@ -0,0 +1,59 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures eager deopts out of a single optimized frame. Each iteration
+// optimizes a small function and then calls it with an argument that fails
+// one of its checks. The optimization cost is the same across benchmarks, so
+// the differences between them come from the deopt itself.
+
+(function() {
+
+// No values to materialize: all live values are tagged.
+function Tagged() {
+  function f(o, a, b) {
+    const x = a + b;
+    return o.x + x;
+  }
+  %PrepareFunctionForOptimization(f);
+  f({x: 1}, 2, 3);
+  f({x: 1}, 2, 3);
+  %OptimizeFunctionOnNextCall(f);
+  f({x: 1}, 2, 3);
+  // Map check failure.
+  f({y: 1, x: 1}, 2, 3);
+}
+
+// Values that need a HeapNumber on the way out.
+function Doubles() {
+  function f(o, a, b) {
+    const x = a * b + 0.5;
+    return o.x + x;
+  }
+  %PrepareFunctionForOptimization(f);
+  f({x: 1}, 2.5, 3.5);
+  f({x: 1}, 2.5, 3.5);
+  %OptimizeFunctionOnNextCall(f);
+  f({x: 1}, 2.5, 3.5);
+  f({y: 1, x: 1}, 2.5, 3.5);
+}
+
+// An escape-analyzed object that has to be materialized.
+function Captured() {
+  function f(o, a, b) {
+    const p = {a, b};
+    return o.x + p.a + p.b;
+  }
+  %PrepareFunctionForOptimization(f);
+  f({x: 1}, 2, 3);
+  f({x: 1}, 2, 3);
+  %OptimizeFunctionOnNextCall(f);
+  f({x: 1}, 2, 3);
+  f({y: 1, x: 1}, 2, 3);
+}
+
+createSuite('Eager-Tagged', 1000, Tagged, () => {});
+createSuite('Eager-Doubles', 1000, Doubles, () => {});
+createSuite('Eager-Captured', 1000, Captured, () => {});
+
+})();
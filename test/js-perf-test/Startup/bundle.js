@@ -0,0 +1,89 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Startup costs of a bundle of roughly the size of a real-world web app's
+// main script (about 1MB, several thousand functions). Each run uses a fresh
+// Realm, so the context is deserialized from the snapshot every time, and
+// the suite runs with --no-compilation-cache so every run parses and
+// compiles from scratch. Run d8 with --runtime-call-stats to get the
+// per-phase breakdown (parsing, preparsing, compilation, deserialization).
+
+(function() {
+
+const kModules = 400;
+const kFunctionsPerModule = 10;
+
+function GenerateModule(m) {
+  let source = `modules[${m}] = (function(exports) {\n`;
+  source += `  const config${m} = {name: 'module${m}', id: ${m}, ` +
+      `flags: [true, false, ${m}], nested: {a: 1, b: '${m}'}};\n`;
+  for (let f = 0; f < kFunctionsPerModule; f++) {
+    source += `  function f${m}_${f}(a, b) {\n` +
+        `    const items = [a, b, config${m}.id];\n` +
+        `    let sum = 0;\n` +
+        `    for (const item of items) {\n` +
+        `      if (typeof item === 'number') sum += item * ${f};\n` +
+        `      else if (item && item.length) sum += item.length;\n` +
+        `    }\n` +
+        `    return {sum, label: \`f${m}_${f}:\${sum}\`};\n` +
+        `  }\n` +
+        `  exports.f${f} = f${m}_${f};\n`;
+  }
+  source += `  exports.C = class C${m} {\n` +
+      `    constructor(x) { this.x = x; this.y = config${m}.id; }\n` +
+      `    get sum() { return this.x + this.y; }\n` +
+      `    method(z) { return this.sum * z; }\n` +
+      `  };\n`;
+  source += `  return exports;\n})({});\n`;
+  return source;
+}
+
+function GenerateBundle() {
+  let source = 'var modules = [];\n';
+  for (let m = 0; m < kModules; m++) source += GenerateModule(m);
+  source += `
+    function callAll() {
+      let result = 0;
+      for (const module of modules) {
+        for (let f = 0; f < ${kFunctionsPerModule}; f++) {
+          result += module['f' + f](1, 'x').sum;
+        }
+        result += new module.C(1).method(2);
+      }
+      return result;
+    }`;
+  return source;
+}
+
+const bundle = GenerateBundle();
+
+// Creating and disposing a Realm deserializes a context from the snapshot.
+function RealmCreate() {
+  for (let i = 0; i < 10; i++) {
+    Realm.dispose(Realm.create());
+  }
+}
+
+// Top-level execution only: inner functions are preparsed and compiled
+// lazily.
+function BundleTopLevel() {
+  const realm = Realm.create();
+  Realm.eval(realm, bundle);
+  Realm.dispose(realm);
+}
+
+// Calling every function once afterwards, which triggers a lazy compile for
+// each of them.
+function BundleFirstCall() {
+  const realm = Realm.create();
+  Realm.eval(realm, bundle);
+  Realm.eval(realm, 'callAll()');
+  Realm.dispose(realm);
+}
+
+createSuite('Realm-Create', 1000, RealmCreate, () => {});
+createSuite('Bundle-TopLevel', 1000, BundleTopLevel, () => {});
+createSuite('Bundle-FirstCall', 1000, BundleFirstCall, () => {});
+
+})();
@@ -0,0 +1,56 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The fast paths of map, filter and reduce are specialized on the backing
+// store of the receiver. Check each kind, and a callback that transitions
+// the receiver to another kind halfway through.
+
+function Inputs() {
+  return [
+    [1, 2, 3, 4], [1, , 3, 4], [1.5, 2.5, 3.5, 4.5], [1.5, , 3.5, 4.5],
+    [{}, 'b', 'c', 'd'], [{}, , 'c', 'd']
+  ];
+}
+
+(function TestKinds() {
+  for (const a of Inputs()) {
+    const copy = Array.from(a);
+    assertEquals(a.length, a.map(x => x).length);
+    assertEquals(0 in a, 0 in a.map(x => x));
+    assertEquals(1 in a, 1 in a.map(x => x));
+    assertEquals(copy.filter((_, i) => i in a), a.filter(() => true));
+    assertEquals(
+        copy.filter((_, i) => i in a).length,
+        a.reduce((acc) => acc + 1, 0));
+  }
+})();
+
+(function TestTransitionDuringIteration() {
+  function Transition(a) {
+    return (x, i) => {
+      if (i == 1) a[0] = 'str';
+      return x;
+    };
+  }
+
+  let a = [1, 2, 3, 4];
+  assertTrue(%HasSmiElements(a));
+  assertEquals([1, 2, 3, 4], a.map(Transition(a)));
+  assertTrue(%HasObjectElements(a));
+
+  a = [1.5, 2.5, 3.5, 4.5];
+  assertTrue(%HasDoubleElements(a));
+  assertEquals([1.5, 2.5, 3.5, 4.5], a.filter(Transition(a)));
+  assertTrue(%HasObjectElements(a));
+
+  a = [1.5, 2.5, 3.5, 4.5];
+  const seen = [];
+  a.reduce((acc, x, i) => {
+    seen.push(x);
+    if (i == 1) a[3] = 'str';
+  }, 0);
+  assertEquals([1.5, 2.5, 3.5, 'str'], seen);
+})();
@@ -0,0 +1,39 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Joins of PACKED_SMI_ELEMENTS arrays write the digits directly. Compare them
+// against joins of the same values as strings.
+function check(array, sep) {
+  assertTrue(%HasSmiElements(array));
+  const strings = array.map(String);
+  assertEquals(strings.join(sep), array.join(sep));
+}
+
+const smis = [0, 1, -1, 9, 10, -10, 99, 100, 12345, -67890, 2 ** 30 - 1];
+if (%IsSmi(2 ** 31 - 1)) smis.push(2 ** 31 - 1, -(2 ** 31));
+else smis.push(-(2 ** 30));
+
+for (const sep of [undefined, ',', '', ' - ', ' ', 'xÿ']) {
+  check([7], sep);
+  check([-7, 0], sep);
+  check(smis, sep);
+  check(smis.concat(smis).concat(smis), sep);
+}
+
+assertEquals('1,2,3', [1, 2, 3].toString());
+assertEquals('-1073741824', [-(2 ** 30)].join());
+
+// A long array, to exercise the allocation of the result.
+const many = [];
+for (let i = 0; i < 100000; i++) many.push(i - 50000);
+check(many, ',');
+check(many, '');
+
+// Results longer than the maximum string length throw.
+const ones = [];
+for (let i = 0; i < 2 ** 20; i++) ones.push(1);
+assertTrue(%HasSmiElements(ones));
+assertThrows(() => ones.join('x'.repeat(2 ** 12)), RangeError);
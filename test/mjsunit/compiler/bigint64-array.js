@@ -0,0 +1,75 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+
+(function TestLoadAndStore() {
+  function load(a, i) {
+    return a[i];
+  }
+  function store(a, i, v) {
+    a[i] = v;
+  }
+  const a = new BigInt64Array(4);
+  const b = new BigUint64Array(4);
+  %PrepareFunctionForOptimization(load);
+  %PrepareFunctionForOptimization(store);
+  store(a, 0, 1n);
+  store(b, 0, 1n);
+  assertEquals(1n, load(a, 0));
+  assertEquals(1n, load(b, 0));
+  %OptimizeFunctionOnNextCall(load);
+  %OptimizeFunctionOnNextCall(store);
+  store(a, 1, -1n);
+  store(b, 1, -1n);
+  assertEquals(-1n, load(a, 1));
+  assertEquals(2n ** 64n - 1n, load(b, 1));
+  // Values are stored modulo 2^64.
+  store(a, 2, 2n ** 63n);
+  store(b, 2, 2n ** 64n + 5n);
+  assertEquals(-(2n ** 63n), load(a, 2));
+  assertEquals(5n, load(b, 2));
+  // Out-of-bounds accesses.
+  store(a, 4, 1n);
+  assertEquals(undefined, load(a, 4));
+  if (%Is64Bit()) {
+    assertOptimized(load);
+    assertOptimized(store);
+  }
+  // Storing a Number throws.
+  assertThrows(() => store(a, 0, 1), TypeError);
+  assertEquals(1n, load(a, 0));
+})();
+
+(function TestArithmeticOnElements() {
+  function add(a, b, c) {
+    for (let i = 0; i < c.length; i++) {
+      c[i] = a[i] + b[i];
+    }
+  }
+  const a = new BigInt64Array([1n, 2n, -3n, 2n ** 62n]);
+  const b = new BigInt64Array([10n, -20n, 30n, 2n ** 62n - 1n]);
+  const c = new BigInt64Array(4);
+  %PrepareFunctionForOptimization(add);
+  add(a, b, c);
+  %OptimizeFunctionOnNextCall(add);
+  add(a, b, c);
+  assertEquals([11n, -18n, 27n, 2n ** 63n - 1n], Array.from(c));
+  if (%Is64Bit()) {
+    assertOptimized(add);
+  }
+})();
+
+(function TestIteration() {
+  function sum(a) {
+    let result = 0n;
+    for (const x of a) result += x;
+    return result;
+  }
+  const a = new BigUint64Array([1n, 2n, 2n ** 64n - 1n]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(2n ** 64n + 2n, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(2n ** 64n + 2n, sum(a));
+})();
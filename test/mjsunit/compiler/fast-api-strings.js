@@ -0,0 +1,64 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file tests passing strings to fast API calls.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --turbofan
+// Flags: --no-always-turbofan
+
+const fast_c_api = new d8.test.FastCAPI();
+
+function sum_one_byte(str) {
+  return fast_c_api.sum_one_byte_char_codes(str);
+}
+
+function sum_two_byte(str) {
+  return fast_c_api.sum_two_byte_char_codes(str);
+}
+
+function sum(str) {
+  let result = 0;
+  for (let i = 0; i < str.length; i++) result += str.charCodeAt(i);
+  return result;
+}
+
+function check(func, str, fast_count, slow_count) {
+  fast_c_api.reset_counts();
+  assertEquals(sum(str), func(str));
+  assertOptimized(func);
+  assertEquals(fast_count, fast_c_api.fast_call_count());
+  assertEquals(slow_count, fast_c_api.slow_call_count());
+}
+
+%PrepareFunctionForOptimization(sum_one_byte);
+sum_one_byte('abc');
+%OptimizeFunctionOnNextCall(sum_one_byte);
+sum_one_byte('abc');
+
+%PrepareFunctionForOptimization(sum_two_byte);
+sum_two_byte('ሴ');
+%OptimizeFunctionOnNextCall(sum_two_byte);
+sum_two_byte('ሴ');
+
+const one_byte = 'fast API \xff';
+const two_byte = 'fast API ☃';
+
+// Sequential strings of the declared encoding take the fast path.
+check(sum_one_byte, one_byte, 1, 0);
+check(sum_one_byte, '', 1, 0);
+check(sum_two_byte, two_byte, 1, 0);
+
+// Strings with the other encoding take the slow path.
+check(sum_one_byte, two_byte, 0, 1);
+check(sum_two_byte, one_byte, 0, 1);
+
+// Cons strings aren't flat, so they take the slow path too.
+const cons = one_byte + 'x'.repeat(20);
+check(sum_one_byte, cons, 0, 1);
+
+// Non-strings throw from the slow callback.
+fast_c_api.reset_counts();
+assertThrows(() => sum_one_byte(42));
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(1, fast_c_api.slow_call_count());
@@ -0,0 +1,77 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --optimize-proxy-loads
+
+function MakeHandler() {
+  return {
+    get(target, name) {
+      if (name == 'throws') throw new Error('trap');
+      return target[name] + 1;
+    }
+  };
+}
+
+(function TestMonomorphicLoad() {
+  function load(p) {
+    return p.x;
+  }
+  const handler = MakeHandler();
+  const p = new Proxy({x: 1}, handler);
+  %PrepareFunctionForOptimization(load);
+  assertEquals(2, load(p));
+  assertEquals(2, load(p));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load(p));
+  assertOptimized(load);
+  // The handler is looked up on every access.
+  handler.get = () => 42;
+  assertEquals(42, load(p));
+  assertOptimized(load);
+  delete handler.get;
+  assertEquals(1, load(p));
+  // A receiver that's not a proxy bails out.
+  assertEquals(3, load({x: 3}));
+})();
+
+(function TestThrowingTrap() {
+  function load(p) {
+    try {
+      return p.throws;
+    } catch (e) {
+      return e.message;
+    }
+  }
+  const p = new Proxy({}, MakeHandler());
+  %PrepareFunctionForOptimization(load);
+  assertEquals('trap', load(p));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals('trap', load(p));
+})();
+
+(function TestRevokedProxy() {
+  function load(p) {
+    return p.x;
+  }
+  const {proxy, revoke} = Proxy.revocable({x: 1}, MakeHandler());
+  %PrepareFunctionForOptimization(load);
+  assertEquals(2, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load(proxy));
+  revoke();
+  assertThrows(() => load(proxy), TypeError);
+})();
+
+(function TestTrapInvariant() {
+  function load(p) {
+    return p.x;
+  }
+  const target = {};
+  Object.defineProperty(target, 'x', {value: 1});
+  const p = new Proxy(target, {get: () => 2});
+  %PrepareFunctionForOptimization(load);
+  assertThrows(() => load(p), TypeError);
+  %OptimizeFunctionOnNextCall(load);
+  assertThrows(() => load(p), TypeError);
+})();
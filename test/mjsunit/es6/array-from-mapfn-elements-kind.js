@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Array.from with a mapping function on fast arrays preallocates the result
+// with the source's length and elements kind.
+(function TestSmiSource() {
+  const result = Array.from([1, 2, 3], x => x * 2);
+  assertEquals([2, 4, 6], result);
+  assertTrue(%HasSmiElements(result));
+  assertEquals([0.5, 1, 1.5], Array.from([1, 2, 3], x => x / 2));
+  assertEquals(['1', '2', '3'], Array.from([1, 2, 3], x => String(x)));
+})();
+
+(function TestDoubleSource() {
+  const result = Array.from([1.5, 2.5, 3.5], x => x * 2);
+  assertEquals([3, 5, 7], result);
+  assertTrue(%HasDoubleElements(result));
+  assertEquals([{}, {}, {}], Array.from([1.5, 2.5, 3.5], x => ({})));
+})();
+
+(function TestObjectSource() {
+  const o = {};
+  const result = Array.from([o, o], x => 1);
+  assertEquals([1, 1], result);
+  assertEquals([o, o], Array.from([o, o], x => x));
+})();
+
+(function TestHoleySource() {
+  const result = Array.from([1, , 3], x => x);
+  assertEquals([1, undefined, 3], result);
+  assertTrue(%HasObjectElements(result));
+  assertEquals([1.5, undefined], Array.from([1.5, , ], x => x));
+})();
+
+(function TestSourceChangesDuringIteration() {
+  const source = [1, 2, 3];
+  const result = Array.from(source, (x, i) => {
+    if (i == 0) source.push(4, 5);
+    if (i == 1) source[4] = 'x';
+    return x;
+  });
+  assertEquals([1, 2, 3, 4, 'x'], result);
+  assertEquals(5, result.length);
+  const shrinking = [1, 2, 3];
+  assertEquals([1], Array.from(shrinking, x => (shrinking.length = 1, x)));
+})();
@@ -0,0 +1,56 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --debug-code
+
+// Looks up string keys in tables where the bucket chains also hold numbers,
+// objects and other non-string keys, so that the string comparison sees
+// candidates of every kind.
+(function TestMixedKeys() {
+  const objects = [];
+  const keys = [];
+  const n = 200;
+  for (let i = 0; i < n; i++) {
+    const object = {i};
+    objects.push(object);
+    keys.push(%FlattenString('k' + i + 'x'.repeat(i % 3)));
+    keys.push(i);
+    keys.push(i + 0.5);
+    keys.push(object);
+    keys.push(Symbol('k' + i));
+    keys.push(BigInt(i) << 70n);
+  }
+  keys.push(null, undefined, true, false, NaN);
+
+  const map = new Map();
+  const set = new Set();
+  // Look keys up while the table grows, so that the small tables with few
+  // buckets, and thus long chains, are covered as well.
+  for (let i = 0; i < keys.length; i++) {
+    map.set(keys[i], i);
+    set.add(keys[i]);
+    assertEquals(i, map.get(keys[i]));
+  }
+
+  for (let i = 0; i < n; i++) {
+    // Freshly built strings, so that the lookup can't succeed on pointer
+    // equality alone.
+    const key = 'k' + i + 'x'.repeat(i % 3);
+    assertEquals(6 * i, map.get(key));
+    assertTrue(set.has(key));
+    assertFalse(map.has(key + 'y'));
+    assertFalse(set.has(key + 'y'));
+    // Strings that look like the other keys don't match them.
+    assertFalse(map.has(String(i)));
+    assertFalse(map.has(String(i + 0.5)));
+    assertFalse(set.has('[object Object]'));
+    assertEquals(6 * i + 1, map.get(i));
+    assertEquals(6 * i + 3, map.get(objects[i]));
+  }
+  assertFalse(map.has('null'));
+  assertFalse(map.has('undefined'));
+  assertFalse(set.has('NaN'));
+  assertEquals(keys.length - 1, map.get(NaN));
+  assertEquals(1, map.get(-0));
+})();
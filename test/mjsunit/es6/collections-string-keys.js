@@ -0,0 +1,46 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Looks up string keys that are and aren't internalized, and that have or
+// haven't had their hash computed yet, in tables with long bucket chains.
+(function TestMapStringKeys() {
+  const map = new Map();
+  const set = new Set();
+  const n = 1000;
+  for (let i = 0; i < n; i++) {
+    // Non-internalized flat strings.
+    const key = %FlattenString('k' + i + 'x'.repeat(i % 3));
+    map.set(key, i);
+    set.add(key);
+  }
+  for (let i = 0; i < n; i++) {
+    // Fresh cons strings with the same contents.
+    const key = 'k' + i + 'x'.repeat(i % 3);
+    assertEquals(i, map.get(key));
+    assertTrue(set.has(key));
+    assertFalse(map.has(key + 'y'));
+    assertFalse(set.has(key + 'y'));
+  }
+  for (let i = 0; i < n; i += 2) {
+    // Internalized strings with the same contents.
+    const key = Object.keys({['k' + i + 'x'.repeat(i % 3)]: 0})[0];
+    assertTrue(map.delete(key));
+    assertTrue(set.delete(key));
+  }
+  for (let i = 0; i < n; i++) {
+    const key = 'k' + i + 'x'.repeat(i % 3);
+    assertEquals(i % 2 == 0 ? undefined : i, map.get(key));
+    assertEquals(i % 2 != 0, set.has(key));
+  }
+})();
+
+(function TestMapInternalizedStringKeys() {
+  const map = new Map([['a', 1], ['b', 2], ['ab', 3]]);
+  assertEquals(1, map.get('a'));
+  assertEquals(3, map.get('a' + 'b'));
+  assertEquals(3, map.get(%FlattenString('a' + 'b'.repeat(1))));
+  assertEquals(undefined, map.get('ba'));
+})();
@@ -0,0 +1,74 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches that use memchr or SIMD, at every start offset around a match.
+(function TestSearch() {
+  for (let ctor of [Int8Array, Uint8Array, Uint8ClampedArray, Float32Array]) {
+    for (let shared of [false, true]) {
+      const length = 100;
+      const buffer = shared ?
+          new SharedArrayBuffer(length * ctor.BYTES_PER_ELEMENT) :
+          new ArrayBuffer(length * ctor.BYTES_PER_ELEMENT);
+      const array = new ctor(buffer);
+      array[37] = 5;
+      array[70] = 5;
+      for (let start = 0; start < length; start++) {
+        const expected = start <= 37 ? 37 : start <= 70 ? 70 : -1;
+        assertEquals(expected, array.indexOf(5, start));
+        assertEquals(expected != -1, array.includes(5, start));
+      }
+      assertEquals(-1, array.indexOf(5, length));
+      assertEquals(-1, array.indexOf(6));
+      // Values that don't fit in the element type must not match their
+      // truncated byte.
+      assertEquals(-1, array.indexOf(5 + 256));
+      assertEquals(-1, array.indexOf(5.5));
+      // All remaining elements are +0.
+      assertEquals(0, array.indexOf(-0));
+      assertTrue(array.includes(0, 99));
+    }
+  }
+})();
+
+(function TestFloat32SearchSpecialValues() {
+  const array = new Float32Array(64);
+  array[10] = -0;
+  array[20] = NaN;
+  array[30] = Infinity;
+  array[40] = 1.5;
+  array.fill(2, 0, 5);
+  assertEquals(5, array.indexOf(0));
+  assertEquals(5, array.indexOf(-0));
+  assertEquals(-1, array.indexOf(NaN));
+  assertTrue(array.includes(NaN));
+  assertEquals(30, array.indexOf(Infinity));
+  assertEquals(40, array.indexOf(1.5));
+  assertEquals(-1, array.indexOf(1.1));
+})();
+
+// Conversions between element types in %TypedArray%.prototype.set.
+(function TestSetConversions() {
+  const doubles = new Float64Array(
+      [-1, 0.5, 1.5, 2.5, 254.5, 255.5, 300, NaN, -0, Infinity, -Infinity]);
+  const clamped = new Uint8ClampedArray(doubles.length);
+  clamped.set(doubles);
+  assertEquals([0, 0, 2, 2, 254, 255, 255, 0, 0, 255, 0], Array.from(clamped));
+
+  const bytes = new Uint8Array(doubles.length);
+  bytes.set(doubles);
+  assertEquals([255, 0, 1, 2, 254, 255, 44, 0, 0, 0, 0], Array.from(bytes));
+
+  const ints = new Int32Array([-1, 256, 0x7fffffff, -0x80000000]);
+  const shorts = new Int16Array(ints.length);
+  shorts.set(ints);
+  assertEquals([-1, 256, -1, 0], Array.from(shorts));
+  const floats = new Float32Array(ints.length);
+  floats.set(ints);
+  assertEquals([-1, 256, 2147483648, -2147483648], Array.from(floats));
+
+  // Shared buffers take the element-wise path.
+  const shared = new Float64Array(new SharedArrayBuffer(8 * 4));
+  shared.set(ints);
+  assertEquals([-1, 256, 0x7fffffff, -0x80000000], Array.from(shared));
+})();
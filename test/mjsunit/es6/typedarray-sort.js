@@ -149,3 +149,37 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// Arrays long enough to be radix sorted agree with the comparator path.
+for (let constructor of constructorsWithArrays) {
+  const length = 2000;
+  const values = [];
+  for (let i = 0; i < length; i++) {
+    values.push(constructor.array[(i * 7919) % constructor.array.length]);
+  }
+  let array = new constructor.ctor(values);
+  let expected = new constructor.ctor(values).sort(cmpfn);
+
+  assertEquals(array.sort(), array);
+  assertArrayLikeEquals(array, expected, constructor.ctor);
+}
+
+(function TestLargeFloatSortSpecialValues() {
+  const specials = [NaN, -0, 0, Infinity, -Infinity, 1.5, -1.5, 2 ** -1074];
+  for (let ctor of [Float32Array, Float64Array]) {
+    const array = new ctor(2000);
+    for (let i = 0; i < array.length; i++) {
+      array[i] = specials[i % specials.length];
+    }
+    array.sort();
+    const perValue = array.length / specials.length;
+    // The denormal is rounded to +0 in a Float32Array.
+    const denormal = ctor == Float32Array ? 0 : 2 ** -1074;
+    let i = 0;
+    for (let value of [-Infinity, -1.5, -0, 0, denormal, 1.5, Infinity, NaN]) {
+      for (let j = 0; j < perValue; j++) {
+        assertEquals(value, array[i++]);
+      }
+    }
+  }
+})();
@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting already fulfilled promises doesn't need a reject handler, but must
+// still resume asynchronously and in order; awaiting rejected and pending
+// promises must keep throwing into the async function.
+
+var log = [];
+
+async function fulfilled(p, tag) {
+  log.push(tag + ':before');
+  var value = await p;
+  log.push(tag + ':' + value);
+  return value;
+}
+
+async function rejected(p) {
+  try {
+    await p;
+    log.push('rejected:unreachable');
+  } catch (e) {
+    log.push('rejected:' + e);
+  }
+}
+
+var resolvePending;
+var pending = new Promise(resolve => resolvePending = resolve);
+
+fulfilled(Promise.resolve(1), 'a');
+fulfilled(Promise.resolve(2), 'b');
+rejected(Promise.reject('boom'));
+fulfilled(pending, 'c');
+log.push('sync');
+resolvePending(3);
+
+%PerformMicrotaskCheckpoint();
+assertEquals(
+    ['a:before', 'b:before', 'c:before', 'sync', 'a:1', 'b:2', 'rejected:boom',
+     'c:3'],
+    log);
@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-sharedarraybuffer --harmony-atomics-waitasync
+
+// Waiters on different locations may end up on different wait lists; check
+// that notifying one location only wakes up its own waiters.
+(function test() {
+  const kLocations = 256;
+  const sab = new SharedArrayBuffer(kLocations * 4);
+  const i32a = new Int32Array(sab);
+
+  const resolved = [];
+  for (let i = 0; i < kLocations; ++i) {
+    for (let j = 0; j < 2; ++j) {
+      const result = Atomics.waitAsync(i32a, i, 0);
+      assertEquals(true, result.async);
+      result.value.then(
+          (value) => { assertEquals("ok", value); resolved.push(i); },
+          () => { assertUnreachable(); });
+    }
+  }
+  for (let i = 0; i < kLocations; ++i) {
+    assertEquals(2, %AtomicsNumWaitersForTesting(i32a, i));
+  }
+  assertEquals(2 * kLocations, %AtomicsNumAsyncWaitersForTesting());
+
+  // Wake up the waiters on every other location.
+  for (let i = 0; i < kLocations; i += 2) {
+    assertEquals(2, Atomics.notify(i32a, i));
+  }
+  for (let i = 0; i < kLocations; ++i) {
+    const woken = i % 2 == 0;
+    assertEquals(woken ? 0 : 2, %AtomicsNumWaitersForTesting(i32a, i));
+    assertEquals(woken ? 2 : 0,
+                 %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a, i));
+  }
+  assertEquals(kLocations, %AtomicsNumAsyncWaitersForTesting());
+
+  setTimeout(() => {
+    assertEquals(kLocations, resolved.length);
+    for (const i of resolved) assertEquals(0, i % 2);
+    for (let i = 1; i < kLocations; i += 2) {
+      assertEquals(2, Atomics.notify(i32a, i));
+    }
+    assertEquals(0, %AtomicsNumAsyncWaitersForTesting());
+  }, 0);
+})();
@@ -0,0 +1,18 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --bigint-parallel-multiplication
+
+// Operands of 2^20 bits are far above the parallel multiplication threshold
+// on both 32-bit and 64-bit platforms.
+const kBits = 1n << 20n;
+let a = (1n << kBits) / 3n;
+let b = (1n << kBits) / 7n + 12345n;
+let product = a * b;
+assertEquals(0n, product % a);
+assertEquals(b, product / a);
+assertEquals(a, product / b);
+assertEquals(2n ** (2n * kBits), (2n ** kBits) * (2n ** kBits));
+// (x + 1)^2 == x^2 + 2x + 1
+assertEquals(product * product + 2n * product + 1n, (product + 1n) ** 2n);
@@ -0,0 +1,43 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Numbers with long runs of digits in the integer, fraction and exponent
+// parts, on both one-byte and two-byte sources.
+function check(text) {
+  assertEquals(Number(text), JSON.parse(text));
+  assertEquals(-Number(text), JSON.parse('-' + text));
+  assertEquals([Number(text)], JSON.parse('[' + text + ']'));
+  assertEquals({a: Number(text)}, JSON.parse('{"a":' + text + '}'));
+  // A two-byte source.
+  assertEquals(
+      [Number(text)], JSON.parse('["\u2028",' + text + ']').slice(1));
+}
+
+check('1234567');
+check('12345678');
+check('123456789');
+check('1234567890123456789');
+check('12345678901234567890123456789');
+check('0.1234567890123456789');
+check('1234.56789012345678901234');
+check('9007199254740993');
+check('9007199254740993.00000000000000000001');
+check('1.7976931348623157e308');
+check('2.2250738585072011e-308');
+check('4.9406564584124654e-324');
+check('1e-400');
+check('1e400');
+check('123456789e-00000000000000000000000001');
+check('0.000000000000000000000000000000000000000000123');
+
+for (let i = 1; i < 40; i++) {
+  const digits = '31415926535897932384626433832795028841971'.substring(0, i);
+  check(digits);
+  check('0.' + digits);
+  check(digits + 'e-' + i);
+}
+
+assertThrows(() => JSON.parse('12345678a'), SyntaxError);
+assertThrows(() => JSON.parse('1234567.'), SyntaxError);
+assertThrows(() => JSON.parse('0.12345678e'), SyntaxError);
@@ -0,0 +1,46 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --maglev --no-always-turbofan
+
+// Locals that are dead across a yield are not saved into the generator's
+// register file; the live ones have to survive the suspension.
+function* gen(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    let dead = {i};
+    sum += dead.i;
+    let live = sum * 2;
+    yield live;
+    sum += live;
+  }
+  return sum;
+}
+
+function run() {
+  let results = [];
+  for (let v of gen(4)) results.push(v);
+  return results;
+}
+
+%PrepareFunctionForOptimization(gen);
+assertEquals([0, 2, 10, 36], run());
+assertEquals([0, 2, 10, 36], run());
+%OptimizeMaglevOnNextCall(gen);
+assertEquals([0, 2, 10, 36], run());
+gc();
+assertEquals([0, 2, 10, 36], run());
+
+// Interleave suspended instances so that stale slots would be observable.
+let a = gen(3);
+let b = gen(3);
+assertEquals(0, a.next().value);
+assertEquals(0, b.next().value);
+assertEquals(2, a.next().value);
+gc();
+assertEquals(2, b.next().value);
+assertEquals(10, a.next().value);
+assertEquals({value: 15, done: true}, a.next());
+assertEquals(10, b.next().value);
+assertEquals({value: 15, done: true}, b.next());
@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+// Flags: --optimize-proxy-loads
+
+const handler = {
+  get(target, name) {
+    if (name == 'throws') throw new Error('trap');
+    return target[name] + 1;
+  }
+};
+
+function load(p) {
+  return p.x;
+}
+
+const p = new Proxy({x: 1}, handler);
+%PrepareFunctionForOptimization(load);
+assertEquals(2, load(p));
+%OptimizeMaglevOnNextCall(load);
+assertEquals(2, load(p));
+assertTrue(isMaglevved(load));
+
+handler.get = () => 42;
+assertEquals(42, load(p));
+assertTrue(isMaglevved(load));
+
+// A receiver that's not a proxy deopts.
+assertEquals(3, load({x: 3}));
+assertFalse(isMaglevved(load));
+
+function loadThrows(p) {
+  try {
+    return p.throws;
+  } catch (e) {
+    return e.message;
+  }
+}
+
+handler.get = function(target, name) {
+  if (name == 'throws') throw new Error('trap');
+  return target[name];
+};
+%PrepareFunctionForOptimization(loadThrows);
+assertEquals('trap', loadThrows(p));
+%OptimizeMaglevOnNextCall(loadThrows);
+assertEquals('trap', loadThrows(p));
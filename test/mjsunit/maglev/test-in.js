@@ -0,0 +1,38 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+class A { foo() {} }
+class B extends A { constructor() { super(); this.bar = 1; } }
+
+function hasFoo(o) { return 'foo' in o; }
+function hasBaz(o) { return 'baz' in o; }
+function hasOwn(o) { return 'bar' in o; }
+
+for (let f of [hasFoo, hasBaz, hasOwn]) {
+  %PrepareFunctionForOptimization(f);
+  f(new B());
+  f(new B());
+  %OptimizeMaglevOnNextCall(f);
+}
+assertTrue(hasFoo(new B()));
+assertFalse(hasBaz(new B()));
+assertTrue(hasOwn(new B()));
+assertTrue(isMaglevved(hasFoo));
+assertTrue(isMaglevved(hasBaz));
+assertTrue(isMaglevved(hasOwn));
+
+// Adding the property to the prototype chain invalidates the code that
+// constant-folded the lookup.
+A.prototype.baz = 1;
+assertFalse(isMaglevved(hasBaz));
+assertTrue(hasBaz(new B()));
+
+// A receiver with a different map deopts.
+assertFalse(hasOwn(new A()));
+assertFalse(isMaglevved(hasOwn));
+
+// Non-receivers still throw.
+assertThrows(() => hasFoo(1), TypeError);
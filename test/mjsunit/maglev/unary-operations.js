@@ -0,0 +1,114 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+// Checks Smi increment and deopt on overflow.
+(function() {
+  function inc(x) {
+    return ++x;
+  }
+
+  %PrepareFunctionForOptimization(inc);
+  assertEquals(2, inc(1));
+
+  %OptimizeMaglevOnNextCall(inc);
+  assertEquals(2, inc(1));
+  assertEquals(0, inc(-1));
+  assertTrue(isMaglevved(inc));
+
+  // We should deopt here since the result is not a Smi.
+  assertEquals(0x40000000, inc(0x3FFFFFFF));
+  assertFalse(isMaglevved(inc));
+})();
+
+// Checks Smi decrement and deopt on non-Smi input.
+(function() {
+  function dec(x) {
+    return --x;
+  }
+
+  %PrepareFunctionForOptimization(dec);
+  assertEquals(0, dec(1));
+
+  %OptimizeMaglevOnNextCall(dec);
+  assertEquals(0, dec(1));
+  assertTrue(isMaglevved(dec));
+
+  assertEquals(0.5, dec(1.5));
+  assertFalse(isMaglevved(dec));
+})();
+
+// Checks Number increment.
+(function() {
+  function inc(x) {
+    return ++x;
+  }
+
+  %PrepareFunctionForOptimization(inc);
+  assertEquals(2.5, inc(1.5));
+
+  %OptimizeMaglevOnNextCall(inc);
+  assertEquals(2.5, inc(1.5));
+  assertEquals(2, inc(1));
+  assertTrue(isMaglevved(inc));
+})();
+
+// Checks negation of zero yields -0.
+(function() {
+  function neg(x) {
+    return -x;
+  }
+
+  %PrepareFunctionForOptimization(neg);
+  assertEquals(-1, neg(1));
+
+  %OptimizeMaglevOnNextCall(neg);
+  assertEquals(-1, neg(1));
+  assertEquals(-0, neg(0));
+  assertEquals(1.5, neg(-1.5));
+  assertTrue(isMaglevved(neg));
+})();
+
+// Checks bitwise not.
+(function() {
+  function not(x) {
+    return ~x;
+  }
+
+  %PrepareFunctionForOptimization(not);
+  assertEquals(-2, not(1));
+
+  %OptimizeMaglevOnNextCall(not);
+  assertEquals(-2, not(1));
+  assertEquals(-1, not(0));
+  assertTrue(isMaglevved(not));
+
+  assertEquals(-2, not(1.5));
+})();
+
+// Checks that property loads are not repeated after an increment.
+(function() {
+  function sum(o, load_again) {
+    let x = o.a;
+    x++;
+    if (load_again) return x + o.a;
+    return x;
+  }
+
+  const a = {a: 1};
+  const b = {a: 1, b: 2};
+  %PrepareFunctionForOptimization(sum);
+  // The first load sees both maps, the second one only {b}'s.
+  assertEquals(2, sum(a, false));
+  assertEquals(3, sum(b, true));
+
+  %OptimizeMaglevOnNextCall(sum);
+  assertEquals(3, sum(b, true));
+  assertTrue(isMaglevved(sum));
+
+  // If the second load was not eliminated, its map check would deopt here.
+  assertEquals(3, sum(a, true));
+  assertTrue(isMaglevved(sum));
+})();
@@ -0,0 +1,94 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Megamorphic named loads that miss the stub cache look up own data
+// properties directly; check that this agrees with the generic lookup for
+// fields, constants, accessors, prototype properties and missing properties.
+
+function load(o) { return o.x; }
+%PrepareFunctionForOptimization(load);
+
+const kShapes = 200;
+const objects = [];
+for (let i = 0; i < kShapes; ++i) {
+  const o = {};
+  // Most shapes have "x" at a different position among a varying number of
+  // other properties, so that both linear and binary descriptor search are
+  // used.
+  for (let j = 0; j < i % 20; ++j) o['p' + i + '_' + j] = j;
+  switch (i % 5) {
+    case 0:
+      o.x = i;
+      break;
+    case 1:
+      o.x = function() { return i; };
+      break;
+    case 2:
+      Object.defineProperty(o, 'x', { get() { return -i; } });
+      break;
+    case 3:
+      Object.setPrototypeOf(o, { x: 'proto' + i });
+      break;
+    case 4:
+      break;
+  }
+  objects.push(o);
+}
+
+function expected(i) {
+  switch (i % 5) {
+    case 0: return i;
+    case 1: return i;
+    case 2: return -i;
+    case 3: return 'proto' + i;
+    case 4: return undefined;
+  }
+}
+
+function check() {
+  for (let i = 0; i < kShapes; ++i) {
+    let value = load(objects[i]);
+    if (i % 5 == 1) value = value();
+    assertEquals(expected(i), value);
+  }
+}
+
+check();
+check();
+%OptimizeFunctionOnNextCall(load);
+check();
+
+// Primitives and dictionary mode objects still take the slow path.
+assertEquals(undefined, load(1));
+assertEquals(undefined, load('abc'));
+const dict = {y: 2, x: 1, z: 3};
+delete dict.y;
+assertFalse(%HasFastProperties(dict));
+assertEquals(1, load(dict));
+
+// Fields found on a stub cache miss enter their handler into the stub cache,
+// so later loads with the same maps go through the cached handlers. Check that
+// those read in-object, out-of-object and double fields correctly, also after
+// the values changed.
+(function TestCachedFieldHandlers() {
+  function loadY(o) { return o.y; }
+  const holders = [];
+  for (let i = 0; i < kShapes; ++i) {
+    // Literals get in-object slots, properties added later mostly live in the
+    // out-of-object property array.
+    const o = i % 2 ? {a: 0} : {};
+    for (let j = 0; j < i % 30; ++j) o['q' + i + '_' + j] = j;
+    o.y = i % 3 ? i + 0.5 : i;
+    holders.push(o);
+  }
+  for (let round = 0; round < 3; ++round) {
+    for (let i = 0; i < kShapes; ++i) {
+      const y = (i % 3 ? i + 0.5 : i) + round;
+      assertEquals(y, loadY(holders[i]));
+      holders[i].y = y + 1;
+    }
+  }
+})();
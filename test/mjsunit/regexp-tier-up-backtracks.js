@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=10
+// Flags: --regexp-tier-up-backtracks=100
+// Flags: --allow-natives-syntax --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+// Flags: --no-enable-experimental-regexp-engine-on-excessive-backtracks
+
+const kLatin1 = true;
+
+// A cheap regexp stays in the interpreter until its ticks are used up.
+let cheap = /^ab/;
+cheap.test("abc");
+cheap.test("abc");
+assertTrue(%RegexpHasBytecode(cheap, kLatin1));
+assertFalse(%RegexpHasNativeCode(cheap, kLatin1));
+
+// An expensive execution tiers up on the next execution, independent of the
+// remaining ticks. The subject is short enough to not tier up eagerly.
+let expensive = /^(a|a)*c$/;
+let subject = "a".repeat(12) + "x";
+assertFalse(expensive.test(subject));
+assertTrue(%RegexpHasBytecode(expensive, kLatin1));
+assertFalse(%RegexpHasNativeCode(expensive, kLatin1));
+assertFalse(expensive.test(subject));
+assertTrue(%RegexpHasNativeCode(expensive, kLatin1));
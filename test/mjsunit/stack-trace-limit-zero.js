@@ -0,0 +1,42 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// With Error.stackTraceLimit set to 0 no frames are captured, but errors
+// still get a stack property and the limit can be raised again later.
+
+function Throw() {
+  throw new Error('boom');
+}
+
+function Catch() {
+  try {
+    Throw();
+  } catch (e) {
+    return e;
+  }
+}
+
+(function TestLimitZero() {
+  const saved = Error.stackTraceLimit;
+  Error.stackTraceLimit = 0;
+  try {
+    assertEquals('Error: boom', Catch().stack);
+    const o = {};
+    Error.captureStackTrace(o);
+    assertEquals('Error', o.stack);
+    let prepared = false;
+    Error.prepareStackTrace = (error, frames) => {
+      prepared = true;
+      assertEquals([], frames);
+      return 'prepared';
+    };
+    assertEquals('prepared', Catch().stack);
+    assertTrue(prepared);
+  } finally {
+    Error.prepareStackTrace = undefined;
+    Error.stackTraceLimit = saved;
+  }
+  assertTrue(Catch().stack.includes('at Throw'));
+  assertTrue(Catch().stack.includes('at Catch'));
+})();
@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long BigInt64Array/BigUint64Array searches use the SIMD loops. The elements
+// must be compared as integers: some bit patterns are NaNs when viewed as
+// doubles, and 0n and -(2n**63n) are +0 and -0.
+
+const kLength = 1000;
+
+(function TestBigInt64Array() {
+  const values = [-1n, 0n, -(2n ** 63n), 2n ** 63n - 1n, 0x7ff8000000000000n];
+  for (const value of values) {
+    for (const position of [0, 1, 17, kLength - 1]) {
+      const a = new BigInt64Array(kLength).fill(42n);
+      assertEquals(-1, a.indexOf(value));
+      assertFalse(a.includes(value));
+      a[position] = value;
+      assertEquals(position, a.indexOf(value));
+      assertTrue(a.includes(value));
+      assertEquals(-1, a.indexOf(value, position + 1));
+    }
+  }
+  // Distinct values with the same double value must not be confused.
+  const a = new BigInt64Array(kLength);
+  a[kLength - 1] = -(2n ** 63n);
+  assertEquals(kLength - 1, a.indexOf(-(2n ** 63n)));
+  assertEquals(-1, a.indexOf(-(2n ** 63n), kLength));
+  a.fill(-(2n ** 63n));
+  assertEquals(-1, a.indexOf(0n));
+  assertFalse(a.includes(0n));
+})();
+
+(function TestBigUint64Array() {
+  const values = [2n ** 64n - 1n, 0n, 2n ** 63n, 0xfff0000000000001n];
+  for (const value of values) {
+    for (const position of [0, 1, 17, kLength - 1]) {
+      const a = new BigUint64Array(kLength).fill(42n);
+      assertEquals(-1, a.indexOf(value));
+      a[position] = value;
+      assertEquals(position, a.indexOf(value));
+      assertTrue(a.includes(value));
+    }
+  }
+  const a = new BigUint64Array(kLength).fill(2n ** 63n);
+  assertEquals(-1, a.indexOf(0n));
+})();
@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --liftoff --no-wasm-tier-up --liftoff-loop-locals-in-registers
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testLoopWithLocalsInRegisters() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const inc = builder.addFunction('inc', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add]);
+  // Computes the sum of 1..n, with the counter (local 2) being computed into
+  // its own register before the loop.
+  builder.addFunction('sum', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLocalGet, 0, kExprI32Const, 0, kExprI32Add, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add, kExprLocalSet, 1,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 2,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  // Same, but the loop body contains a call (which spills all registers), and
+  // local 2 starts out sharing its register with local 0.
+  builder.addFunction('sum_with_call', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add, kExprLocalSet, 1,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 2,
+          kExprCallFunction, inc.index, kExprI32Const, 1, kExprI32GtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1, kExprLocalGet, 0, kExprI32Add
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(1, instance.exports.sum(1));
+  assertEquals(55, instance.exports.sum(10));
+  assertEquals(5050, instance.exports.sum(100));
+  assertEquals(1 + 1, instance.exports.sum_with_call(1));
+  assertEquals(55 + 10, instance.exports.sum_with_call(10));
+})();
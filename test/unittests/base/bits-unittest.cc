@@ -288,6 +288,27 @@ TEST(Bits, SignedMulHigh32) {
   EXPECT_EQ(2, SignedMulHigh32(8 * 1024, 1024 * 1024));
 }
 
+TEST(Bits, UnsignedMul128) {
+  uint64_t low;
+  EXPECT_EQ(0u, UnsignedMul128(0, 0, &low));
+  EXPECT_EQ(0u, low);
+  EXPECT_EQ(0u, UnsignedMul128(uint64_t{1} << 32, uint64_t{1} << 31, &low));
+  EXPECT_EQ(uint64_t{1} << 63, low);
+  EXPECT_EQ(1u, UnsignedMul128(uint64_t{1} << 32, uint64_t{1} << 32, &low));
+  EXPECT_EQ(0u, low);
+  const uint64_t kMax = std::numeric_limits<uint64_t>::max();
+  EXPECT_EQ(kMax - 1, UnsignedMul128(kMax, kMax, &low));
+  EXPECT_EQ(1u, low);
+  TRACED_FORRANGE(uint64_t, i, 1, 50) {
+    TRACED_FORRANGE(uint64_t, j, 1, 50) {
+      const uint64_t a = kMax / i;
+      const uint64_t b = kMax / j + i;
+      EXPECT_EQ(UnsignedMulHigh64(a, b), UnsignedMul128(a, b, &low));
+      EXPECT_EQ(a * b, low);
+    }
+  }
+}
+
 
 TEST(Bits, SignedMulHighAndAdd32) {
   TRACED_FORRANGE(int32_t, i, 1, 50) {
@@ -0,0 +1,127 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/radix-sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "src/base/utils/random-number-generator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace base {
+
+namespace {
+
+// The order of %TypedArray%.prototype.sort without a comparator.
+template <typename T>
+bool NumberLess(T x, T y) {
+  if (std::isnan(static_cast<double>(y))) {
+    return !std::isnan(static_cast<double>(x));
+  }
+  if (x == y) {
+    return std::signbit(static_cast<double>(x)) &&
+           !std::signbit(static_cast<double>(y));
+  }
+  return x < y;
+}
+
+template <typename T>
+void CheckSorted(std::vector<T> values) {
+  std::vector<T> expected = values;
+  std::sort(expected.begin(), expected.end(), NumberLess<T>);
+  RadixSort(values.data(), values.size());
+  ASSERT_EQ(expected.size(), values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    if (std::isnan(static_cast<double>(expected[i]))) {
+      EXPECT_TRUE(std::isnan(static_cast<double>(values[i])));
+    } else {
+      EXPECT_EQ(expected[i], values[i]);
+      EXPECT_EQ(std::signbit(static_cast<double>(expected[i])),
+                std::signbit(static_cast<double>(values[i])));
+    }
+  }
+}
+
+template <typename T>
+std::vector<T> RandomIntegers(RandomNumberGenerator* rng, size_t length) {
+  std::vector<T> values(length);
+  rng->NextBytes(values.data(), length * sizeof(T));
+  return values;
+}
+
+}  // namespace
+
+TEST(RadixSortTest, Integers) {
+  RandomNumberGenerator rng(123);
+  for (size_t length : {0, 1, 2, 3, 100, 1000, 5000}) {
+    CheckSorted(RandomIntegers<int8_t>(&rng, length));
+    CheckSorted(RandomIntegers<uint8_t>(&rng, length));
+    CheckSorted(RandomIntegers<int16_t>(&rng, length));
+    CheckSorted(RandomIntegers<uint16_t>(&rng, length));
+    CheckSorted(RandomIntegers<int32_t>(&rng, length));
+    CheckSorted(RandomIntegers<uint32_t>(&rng, length));
+    CheckSorted(RandomIntegers<int64_t>(&rng, length));
+    CheckSorted(RandomIntegers<uint64_t>(&rng, length));
+  }
+}
+
+TEST(RadixSortTest, IntegerLimits) {
+  CheckSorted<int32_t>({0, -1, 1, std::numeric_limits<int32_t>::min(),
+                        std::numeric_limits<int32_t>::max(), 0, -1});
+  CheckSorted<int64_t>({0, -1, 1, std::numeric_limits<int64_t>::min(),
+                        std::numeric_limits<int64_t>::max(), 0, -1});
+}
+
+TEST(RadixSortTest, SmallRange) {
+  // Most bytes are the same in all values, so their passes are skipped.
+  RandomNumberGenerator rng(456);
+  std::vector<int32_t> values(3000);
+  for (int32_t& value : values) value = rng.NextInt(100) - 50;
+  CheckSorted(values);
+  std::vector<uint32_t> same(1000, 42);
+  CheckSorted(same);
+}
+
+TEST(RadixSortTest, Doubles) {
+  RandomNumberGenerator rng(789);
+  std::vector<double> values;
+  for (int i = 0; i < 5000; i++) {
+    values.push_back((rng.NextDouble() - 0.5) * std::pow(10, rng.NextInt(40)));
+  }
+  CheckSorted(values);
+}
+
+TEST(RadixSortTest, SpecialDoubles) {
+  const double kInf = std::numeric_limits<double>::infinity();
+  const double kNaN = std::numeric_limits<double>::quiet_NaN();
+  const double kMin = std::numeric_limits<double>::denorm_min();
+  CheckSorted<double>({kNaN, 1, -0.0, kInf, 0.0, -kNaN, -kInf, -kMin, kMin,
+                       -0.0, 0.0, kNaN, -1, std::numeric_limits<double>::max(),
+                       std::numeric_limits<double>::lowest()});
+  CheckSorted<float>({std::numeric_limits<float>::quiet_NaN(), 1.5f, -0.0f,
+                      std::numeric_limits<float>::infinity(), 0.0f, -2.5f,
+                      -std::numeric_limits<float>::infinity(), 0.0f});
+}
+
+TEST(RadixSortTest, Unaligned) {
+  std::vector<uint8_t> buffer(sizeof(double) * 101);
+  double* data = reinterpret_cast<double*>(buffer.data() + 1);
+  for (int i = 0; i < 100; i++) {
+    double value = (i * 37) % 100 - 50.5;
+    memcpy(&data[i], &value, sizeof(value));
+  }
+  RadixSort(data, 100);
+  for (int i = 0; i < 100; i++) {
+    double value;
+    memcpy(&value, &data[i], sizeof(value));
+    EXPECT_EQ(i - 50.5, value);
+  }
+}
+
+}  // namespace base
+}  // namespace v8
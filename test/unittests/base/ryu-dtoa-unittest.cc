@@ -0,0 +1,148 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/ryu-dtoa.h"
+
+#include <stdlib.h>
+
+#include "src/base/numbers/bignum-dtoa.h"
+#include "src/base/numbers/double.h"
+#include "src/base/numbers/fast-dtoa.h"
+#include "test/unittests/gay-shortest.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+
+using RyuDtoaTest = ::testing::Test;
+
+namespace base {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+TEST_F(RyuDtoaTest, RyuDtoaVariousDoubles) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  RyuDtoa(1.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(1, point);
+
+  RyuDtoa(1.5, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("15", buffer.begin()));
+  CHECK_EQ(1, point);
+
+  RyuDtoa(0.1, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(0, point);
+
+  double min_double = 5e-324;
+  RyuDtoa(min_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5", buffer.begin()));
+  CHECK_EQ(-323, point);
+
+  double max_double = 1.7976931348623157e308;
+  RyuDtoa(max_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("17976931348623157", buffer.begin()));
+  CHECK_EQ(309, point);
+
+  RyuDtoa(4294967272.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4294967272", buffer.begin()));
+  CHECK_EQ(10, point);
+
+  RyuDtoa(4.1855804968213567e298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4185580496821357", buffer.begin()));
+  CHECK_EQ(299, point);
+
+  RyuDtoa(5.5626846462680035e-309, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5562684646268003", buffer.begin()));
+  CHECK_EQ(-308, point);
+
+  RyuDtoa(2147483648.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("2147483648", buffer.begin()));
+  CHECK_EQ(10, point);
+
+  RyuDtoa(3.5844466002796428e+298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("35844466002796428", buffer.begin()));
+  CHECK_EQ(299, point);
+
+  uint64_t smallest_normal64 = 0x0010'0000'0000'0000;
+  RyuDtoa(Double(smallest_normal64).value(), buffer, &length, &point);
+  CHECK_EQ(0, strcmp("22250738585072014", buffer.begin()));
+  CHECK_EQ(-307, point);
+
+  uint64_t largest_denormal64 = 0x000F'FFFF'FFFF'FFFF;
+  RyuDtoa(Double(largest_denormal64).value(), buffer, &length, &point);
+  CHECK_EQ(0, strcmp("2225073858507201", buffer.begin()));
+  CHECK_EQ(-307, point);
+
+  // Rounding up to a power of ten must not leave trailing zeros.
+  RyuDtoa(1e23, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(24, point);
+
+  RyuDtoa(9007199254740992.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("9007199254740992", buffer.begin()));
+  CHECK_EQ(16, point);
+}
+
+TEST_F(RyuDtoaTest, RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    RyuDtoa(current_test.v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    CHECK_EQ(static_cast<int>(strlen(buffer.begin())), length);
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+}
+
+// The doubles for which FastDtoa gives up are the ones Ryu has to be exact
+// for without a fallback, so compare them against BignumDtoa.
+TEST_F(RyuDtoaTest, RyuDtoaMatchesBignumDtoaWhereFastDtoaFails) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  char expected_container[kBufferSize];
+  Vector<char> expected(expected_container, kBufferSize);
+  int length;
+  int point;
+  int expected_length;
+  int expected_point;
+  int fast_failed = 0;
+
+  uint64_t bits = 0x0123'4567'89AB'CDEF;
+  for (int i = 0; i < 200000; ++i) {
+    // Linear congruential generator over the bit patterns of finite,
+    // positive doubles.
+    bits = bits * 6364136223846793005u + 1442695040888963407u;
+    double v = Double(bits >> 1).value();
+    if (Double(v).IsSpecial() || v == 0) continue;
+    if (FastDtoa(v, FAST_DTOA_SHORTEST, 0, expected, &expected_length,
+                 &expected_point)) {
+      continue;
+    }
+    fast_failed++;
+    BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, expected, &expected_length,
+               &expected_point);
+    expected[expected_length] = '\0';
+    RyuDtoa(v, buffer, &length, &point);
+    CHECK_EQ(expected_length, length);
+    CHECK_EQ(expected_point, point);
+    CHECK_EQ(0, strcmp(expected.begin(), buffer.begin()));
+  }
+  CHECK_LT(0, fast_failed);
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace base
+}  // namespace v8
@@ -12,6 +12,12 @@ TEST(SysInfoTest, NumberOfProcessors) {
   EXPECT_LT(0, SysInfo::NumberOfProcessors());
 }
 
+TEST(SysInfoTest, NumberOfAvailableProcessors) {
+  EXPECT_LT(0, SysInfo::NumberOfAvailableProcessors());
+  EXPECT_GE(SysInfo::NumberOfProcessors(),
+            SysInfo::NumberOfAvailableProcessors());
+}
+
 TEST(SysInfoTest, AmountOfPhysicalMemory) {
   EXPECT_LT(0, SysInfo::AmountOfPhysicalMemory());
 }
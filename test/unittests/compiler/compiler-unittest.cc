@@ -7,7 +7,10 @@
 #include <stdlib.h>
 #include <wchar.h>
 
+#include <limits>
 #include <memory>
+#include <sstream>
+#include <string>
 
 #include "include/v8-function.h"
 #include "include/v8-local-handle.h"
@@ -16,6 +19,7 @@
 #include "src/api/api-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/script-details.h"
+#include "src/diagnostics/compilation-statistics.h"
 #include "src/heap/factory.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/objects-inl.h"
@@ -792,6 +796,60 @@ TEST_F(CompilerTest, DeepEagerCompilation) {
   }
 }
 
+namespace {
+
+bool CompileHintAtPosition(int position, void* data) {
+  return position == *static_cast<int*>(data);
+}
+
+}  // namespace
+
+TEST_F(CompilerTest, CompileHintsEagerCompilation) {
+  i::v8_flags.always_turbofan = false;
+  v8::HandleScope scope(isolate());
+  v8::Local<v8::String> source = NewString(
+      "function g(x) {"
+      "  return x;"
+      "}"
+      "function f(x) {"
+      "  return x + x;"
+      "}"
+      "f(2)");
+  // Hint only f, whose function token follows g's source.
+  int hinted_position = 27;
+  v8::ScriptOrigin origin(isolate(), NewString("test"));
+  v8::ScriptCompiler::Source script_source(source, origin,
+                                           CompileHintAtPosition,
+                                           &hinted_position);
+  v8::Local<v8::Script> script =
+      v8::ScriptCompiler::Compile(context(), &script_source)
+          .ToLocalChecked();
+  {
+    v8::internal::DisallowCompilation no_compile_expected(i_isolate());
+    v8::Local<v8::Value> result = script->Run(context()).ToLocalChecked();
+    EXPECT_EQ(4, result->Int32Value(context()).FromJust());
+  }
+  Handle<JSFunction> g = Handle<JSFunction>::cast(GetGlobalProperty("g"));
+  EXPECT_FALSE(g->shared().is_compiled());
+}
+
+TEST_F(CompilerTest, DynamicFunctionCacheSharedAcrossContexts) {
+  if (!v8_flags.compilation_cache) return;
+  v8::HandleScope scope(isolate());
+  const char* source = "new Function('a', 'return a + 1')";
+  // The eval cache only stores an entry the second time it is put.
+  RunJS(source);
+  Handle<JSFunction> f1 =
+      Handle<JSFunction>::cast(Utils::OpenHandle(*RunJS(source)));
+
+  v8::Local<v8::Context> other_context = v8::Context::New(isolate());
+  Handle<JSFunction> f2 = Handle<JSFunction>::cast(
+      Utils::OpenHandle(*RunJS(other_context, source)));
+
+  EXPECT_NE(f1->native_context(), f2->native_context());
+  EXPECT_EQ(f1->shared(), f2->shared());
+}
+
 TEST_F(CompilerTest, DeepEagerCompilationPeakMemory) {
   i::v8_flags.always_turbofan = false;
   v8::HandleScope scope(isolate());
@@ -924,5 +982,63 @@ TEST_F(CompilerTest, ProfilerEnabledDuringBackgroundCompile) {
   cpu_profiler->StopProfiling(profile);
 }
 
+class FunctionCompilationStatisticsTest : public TestWithContext {
+ public:
+  static void SetUpTestSuite() {
+    flag_was_enabled_ = i::v8_flags.function_compilation_stats;
+    i::v8_flags.function_compilation_stats = true;
+    TestWithContext::SetUpTestSuite();
+  }
+
+  static void TearDownTestSuite() {
+    TestWithContext::TearDownTestSuite();
+    i::v8_flags.function_compilation_stats = flag_was_enabled_;
+  }
+
+ private:
+  static bool flag_was_enabled_;
+};
+
+bool FunctionCompilationStatisticsTest::flag_was_enabled_ = false;
+
+TEST_F(FunctionCompilationStatisticsTest, RecordsTiersAndDeopts) {
+  if (i::v8_flags.always_turbofan || !i::v8_flags.turbofan) return;
+  i::v8_flags.allow_natives_syntax = true;
+  if (!i_isolate()->use_optimizer()) return;
+  v8::HandleScope scope(isolate());
+  FunctionCompilationStatistics* statistics =
+      i_isolate()->function_compilation_statistics();
+  ASSERT_NE(nullptr, statistics);
+
+  RunJS(
+      "function f(x) { return x + 1; }"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1); f(2);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f(3);"
+      "f('deopt');");
+
+  Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(context()
+                                         ->Global()
+                                         ->Get(context(), NewString("f"))
+                                         .ToLocalChecked())));
+  const FunctionCompilationStatistics::FunctionStats* stats =
+      statistics->Lookup(f->shared());
+  ASSERT_NE(nullptr, stats);
+  EXPECT_EQ("f", stats->function_name);
+  using Tier = FunctionCompilationStatistics::Tier;
+  EXPECT_EQ(1, stats->compilations[static_cast<int>(Tier::kIgnition)]);
+  EXPECT_EQ(1, stats->compilations[static_cast<int>(Tier::kTurbofan)]);
+  EXPECT_EQ(1, stats->deoptimizations);
+
+  // The total number of compilations follows the total time.
+  std::ostringstream os;
+  statistics->PrintTop(os, std::numeric_limits<size_t>::max());
+  EXPECT_NE(std::string::npos,
+            os.str().find("/" + std::to_string(stats->TotalCompilations()) +
+                          " f ["));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,195 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/branch-elimination-reducer.h"
+
+#include <set>
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/optimization-phase.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+class BranchEliminationReducerTest : public TestWithZone {
+ public:
+  BranchEliminationReducerTest()
+      : graph_(zone()), assembler_(graph_, graph_, zone()) {}
+
+  Assembler<>& Asm() { return assembler_; }
+
+  Block* NewBlock(Block::Kind kind = Block::Kind::kBranchTarget) {
+    return Asm().NewBlock(kind);
+  }
+
+  void ReturnValue(uint32_t value) {
+    Asm().Return(Asm().Word32Constant(value));
+  }
+
+  void RunBranchElimination() {
+    OptimizationPhase<BranchEliminationReducer>::Run(&graph_, zone(), nullptr);
+  }
+
+  size_t BranchCount() const {
+    size_t count = 0;
+    for (const Operation& op : graph_.AllOperations()) {
+      if (op.Is<BranchOp>()) count++;
+    }
+    return count;
+  }
+
+  // The values returned by the Return operations left in the graph.
+  std::set<uint32_t> ReturnedValues() const {
+    std::set<uint32_t> values;
+    for (const Operation& op : graph_.AllOperations()) {
+      if (const ReturnOp* ret = op.TryCast<ReturnOp>()) {
+        values.insert(
+            graph_.Get(ret->return_values()[0]).Cast<ConstantOp>().word32());
+      }
+    }
+    return values;
+  }
+
+ private:
+  Graph graph_;
+  Assembler<> assembler_;
+};
+
+TEST_F(BranchEliminationReducerTest, NestedBranchOnSameCondition) {
+  Block* start = NewBlock(Block::Kind::kMerge);
+  Block* if_true = NewBlock();
+  Block* if_false = NewBlock();
+  Block* inner_true = NewBlock();
+  Block* inner_false = NewBlock();
+
+  Asm().BindReachable(start);
+  OpIndex condition = Asm().Parameter(0);
+  Asm().Branch(condition, if_true, if_false);
+
+  Asm().BindReachable(if_true);
+  Asm().Branch(condition, inner_true, inner_false);
+  Asm().BindReachable(inner_true);
+  ReturnValue(1);
+  Asm().BindReachable(inner_false);
+  ReturnValue(2);
+
+  Asm().BindReachable(if_false);
+  ReturnValue(3);
+
+  EXPECT_EQ(2u, BranchCount());
+  RunBranchElimination();
+  // The inner Branch always goes to {inner_true}.
+  EXPECT_EQ(1u, BranchCount());
+  EXPECT_EQ((std::set<uint32_t>{1, 3}), ReturnedValues());
+}
+
+TEST_F(BranchEliminationReducerTest, SameConditionFromDifferentDominators) {
+  // The condition is known to be true in one branch and false in the other,
+  // so each of the inner Branches is folded towards a different side.
+  Block* start = NewBlock(Block::Kind::kMerge);
+  Block* if_true = NewBlock();
+  Block* if_false = NewBlock();
+  Block* true_true = NewBlock();
+  Block* true_false = NewBlock();
+  Block* false_true = NewBlock();
+  Block* false_false = NewBlock();
+
+  Asm().BindReachable(start);
+  OpIndex condition = Asm().Parameter(0);
+  Asm().Branch(condition, if_true, if_false);
+
+  Asm().BindReachable(if_true);
+  Asm().Branch(condition, true_true, true_false);
+  Asm().BindReachable(true_true);
+  ReturnValue(1);
+  Asm().BindReachable(true_false);
+  ReturnValue(2);
+
+  Asm().BindReachable(if_false);
+  Asm().Branch(condition, false_true, false_false);
+  Asm().BindReachable(false_true);
+  ReturnValue(3);
+  Asm().BindReachable(false_false);
+  ReturnValue(4);
+
+  EXPECT_EQ(3u, BranchCount());
+  RunBranchElimination();
+  EXPECT_EQ(1u, BranchCount());
+  EXPECT_EQ((std::set<uint32_t>{1, 4}), ReturnedValues());
+}
+
+TEST_F(BranchEliminationReducerTest, ConditionUnknownAfterMerge) {
+  // Both sides of the first Branch meet again before the second Branch, whose
+  // dominator doesn't know the condition, so it has to stay.
+  Block* start = NewBlock(Block::Kind::kMerge);
+  Block* if_true = NewBlock();
+  Block* if_false = NewBlock();
+  Block* merge = NewBlock(Block::Kind::kMerge);
+  Block* merge_true = NewBlock();
+  Block* merge_false = NewBlock();
+
+  Asm().BindReachable(start);
+  OpIndex condition = Asm().Parameter(0);
+  Asm().Branch(condition, if_true, if_false);
+
+  Asm().BindReachable(if_true);
+  Asm().Goto(merge);
+  Asm().BindReachable(if_false);
+  Asm().Goto(merge);
+
+  Asm().BindReachable(merge);
+  Asm().Branch(condition, merge_true, merge_false);
+  Asm().BindReachable(merge_true);
+  ReturnValue(1);
+  Asm().BindReachable(merge_false);
+  ReturnValue(2);
+
+  RunBranchElimination();
+  EXPECT_EQ(2u, BranchCount());
+  EXPECT_EQ((std::set<uint32_t>{1, 2}), ReturnedValues());
+}
+
+TEST_F(BranchEliminationReducerTest, ConditionKnownFurtherDown) {
+  // A block that is not a direct successor of the Branch still knows the
+  // condition through its dominators.
+  Block* start = NewBlock(Block::Kind::kMerge);
+  Block* if_true = NewBlock();
+  Block* if_false = NewBlock();
+  Block* other_true = NewBlock();
+  Block* other_false = NewBlock();
+  Block* merge = NewBlock(Block::Kind::kMerge);
+  Block* inner_true = NewBlock();
+  Block* inner_false = NewBlock();
+
+  Asm().BindReachable(start);
+  OpIndex condition = Asm().Parameter(0);
+  OpIndex other_condition = Asm().Parameter(1);
+  Asm().Branch(condition, if_true, if_false);
+
+  Asm().BindReachable(if_true);
+  Asm().Branch(other_condition, other_true, other_false);
+  Asm().BindReachable(other_true);
+  Asm().Goto(merge);
+  Asm().BindReachable(other_false);
+  Asm().Goto(merge);
+
+  // {merge} is dominated by {if_true}, where {condition} is true.
+  Asm().BindReachable(merge);
+  Asm().Branch(condition, inner_true, inner_false);
+  Asm().BindReachable(inner_true);
+  ReturnValue(1);
+  Asm().BindReachable(inner_false);
+  ReturnValue(2);
+
+  Asm().BindReachable(if_false);
+  ReturnValue(3);
+
+  RunBranchElimination();
+  EXPECT_EQ(2u, BranchCount());
+  EXPECT_EQ((std::set<uint32_t>{1, 3}), ReturnedValues());
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -119,6 +119,48 @@ TEST_F(TypedOptimizationTest, ReferenceEqualWithBooleanFalseConstant) {
   EXPECT_THAT(r.replacement(), IsBooleanNot(left));
 }
 
+// -----------------------------------------------------------------------------
+// CheckBounds
+
+TEST_F(TypedOptimizationTest, CheckBoundsDominatedByLessThan) {
+  Node* index = Parameter(Type::Unsigned31(), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* check = graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch = graph()->NewNode(common()->Branch(), check, graph()->start());
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check_bounds = graph()->NewNode(
+      simplified()->CheckBounds(FeedbackSource()), index, length,
+      graph()->start(), if_true);
+  Reduction r = Reduce(check_bounds);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_TRUE(CheckBoundsParametersOf(check_bounds->op()).flags() &
+              CheckBoundsFlag::kAbortOnOutOfBounds);
+}
+
+TEST_F(TypedOptimizationTest, CheckBoundsOnFalseSideOfLessThan) {
+  Node* index = Parameter(Type::Unsigned31(), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* check = graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch = graph()->NewNode(common()->Branch(), check, graph()->start());
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Reduction r = Reduce(graph()->NewNode(
+      simplified()->CheckBounds(FeedbackSource()), index, length,
+      graph()->start(), if_false));
+  EXPECT_FALSE(r.Changed());
+}
+
+TEST_F(TypedOptimizationTest, CheckBoundsDominatedByLessThanNegativeIndex) {
+  Node* index = Parameter(Type::Signed32(), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* check = graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch = graph()->NewNode(common()->Branch(), check, graph()->start());
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Reduction r = Reduce(graph()->NewNode(
+      simplified()->CheckBounds(FeedbackSource()), index, length,
+      graph()->start(), if_true));
+  EXPECT_FALSE(r.Changed());
+}
+
 }  // namespace typed_optimization_unittest
 }  // namespace compiler
 }  // namespace internal
@@ -4,6 +4,10 @@
 
 #include "src/date/date.h"
 
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
 #include "src/init/v8.h"
@@ -43,8 +47,13 @@ class DateCacheMock : public DateCache {
     return rule == nullptr ? 0 : rule->offset_sec * 1000;
   }
 
-  int GetLocalOffsetFromOS(int64_t time_sec, bool is_utc) override {
-    return local_offset_ + GetDaylightSavingsOffsetFromOS(time_sec);
+  int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) override {
+    return local_offset_ + GetDaylightSavingsOffsetFromOS(time_ms / 1000);
+  }
+
+  bool GetNextOffsetTransitionFromOS(int64_t time_ms, bool is_utc,
+                                     int64_t* transition_ms) override {
+    return false;
   }
 
  private:
@@ -87,6 +96,63 @@ class DateCacheMock : public DateCache {
   int rules_count_;
 };
 
+// A time zone given by a list of offset transitions, which can be hidden from
+// the offset cache or reported at the wrong times.
+class TransitionListDateCache : public DateCache {
+ public:
+  struct Transition {
+    int64_t time_ms;
+    int offset_ms;
+  };
+
+  TransitionListDateCache(int initial_offset_ms,
+                          std::vector<Transition> transitions)
+      : initial_offset_ms_(initial_offset_ms),
+        transitions_(std::move(transitions)) {}
+
+  int OffsetAt(int64_t time_ms) {
+    int offset = initial_offset_ms_;
+    for (const Transition& transition : transitions_) {
+      if (time_ms < transition.time_ms) break;
+      offset = transition.offset_ms;
+    }
+    return offset;
+  }
+
+  void set_report_transitions(bool value) { report_transitions_ = value; }
+  void set_reported_transition_shift_ms(int64_t value) {
+    reported_transition_shift_ms_ = value;
+  }
+  int os_calls() const { return os_calls_; }
+
+ protected:
+  int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) override {
+    os_calls_++;
+    return OffsetAt(time_ms);
+  }
+
+  bool GetNextOffsetTransitionFromOS(int64_t time_ms, bool is_utc,
+                                     int64_t* transition_ms) override {
+    if (!report_transitions_) return false;
+    for (const Transition& transition : transitions_) {
+      int64_t reported = transition.time_ms + reported_transition_shift_ms_;
+      if (reported > time_ms) {
+        *transition_ms = reported;
+        return true;
+      }
+    }
+    *transition_ms = std::numeric_limits<int64_t>::max();
+    return true;
+  }
+
+ private:
+  int initial_offset_ms_;
+  std::vector<Transition> transitions_;
+  bool report_transitions_ = true;
+  int64_t reported_transition_shift_ms_ = 0;
+  int os_calls_ = 0;
+};
+
 static int64_t TimeFromYearMonthDay(DateCache* date_cache, int year, int month,
                                     int day) {
   int64_t result = date_cache->DaysFromYearMonth(year, month);
@@ -141,6 +207,111 @@ TEST_F(DateTest, DaylightSavingsTime) {
   CheckDST(august_20);
 }
 
+namespace {
+
+const int kMsPerHour = 3600 * 1000;
+const int kStandardOffsetMs = -8 * kMsPerHour;
+const int kDaylightOffsetMs = -7 * kMsPerHour;
+
+// Checks that the cached offsets match the time zone around each transition,
+// both for the first lookup in a bucket and once the bucket is cached.
+void CheckOffsetsAroundTransitions(
+    TransitionListDateCache* date_cache,
+    const std::vector<TransitionListDateCache::Transition>& transitions) {
+  for (int pass = 0; pass < 2; pass++) {
+    for (const auto& transition : transitions) {
+      for (int delta : {-kMsPerHour, -1, 0, 1, kMsPerHour}) {
+        int64_t time = transition.time_ms + delta;
+        for (bool is_utc : {true, false}) {
+          // Look the time up twice so that its bucket gets cached.
+          EXPECT_EQ(date_cache->OffsetAt(time),
+                    date_cache->LocalOffsetInMs(time, is_utc));
+          EXPECT_EQ(date_cache->OffsetAt(time),
+                    date_cache->LocalOffsetInMs(time, is_utc));
+        }
+      }
+    }
+  }
+}
+
+std::vector<TransitionListDateCache::Transition> DSTTransitions(
+    DateCache* date_cache, int first_year, int last_year) {
+  std::vector<TransitionListDateCache::Transition> transitions;
+  for (int year = first_year; year <= last_year; year++) {
+    int64_t march_10 = TimeFromYearMonthDay(date_cache, year, 2, 10);
+    int64_t november_3 = TimeFromYearMonthDay(date_cache, year, 10, 3);
+    transitions.push_back({march_10 + 10 * kMsPerHour, kDaylightOffsetMs});
+    transitions.push_back({november_3 + 9 * kMsPerHour, kStandardOffsetMs});
+  }
+  return transitions;
+}
+
+}  // anonymous namespace
+
+TEST_F(DateTest, LocalOffsetAroundDSTTransitions) {
+  DateCache scratch;
+  auto transitions = DSTTransitions(&scratch, 1960, 2040);
+  TransitionListDateCache date_cache(kStandardOffsetMs, transitions);
+  CheckOffsetsAroundTransitions(&date_cache, transitions);
+}
+
+TEST_F(DateTest, LocalOffsetCachedBucketsDontCallTheOS) {
+  DateCache scratch;
+  auto transitions = DSTTransitions(&scratch, 2020, 2022);
+  TransitionListDateCache date_cache(kStandardOffsetMs, transitions);
+  int64_t july_2021 = TimeFromYearMonthDay(&scratch, 2021, 6, 1);
+  date_cache.LocalOffsetInMs(july_2021, true);
+  date_cache.LocalOffsetInMs(july_2021, true);
+  int os_calls = date_cache.os_calls();
+  for (int64_t day = -100; day < 100; day++) {
+    int64_t time = july_2021 + day * DateCache::kMsPerDay;
+    EXPECT_EQ(date_cache.OffsetAt(time),
+              date_cache.LocalOffsetInMs(time, true));
+  }
+  EXPECT_EQ(os_calls, date_cache.os_calls());
+}
+
+TEST_F(DateTest, LocalOffsetShortLivedChange) {
+  // An offset that is in effect for a single hour, and one for a single
+  // millisecond, both well within one kDefaultDSTDeltaInSec.
+  DateCache scratch;
+  int64_t june_1 = TimeFromYearMonthDay(&scratch, 2015, 5, 1);
+  std::vector<TransitionListDateCache::Transition> transitions = {
+      {june_1, kDaylightOffsetMs},
+      {june_1 + kMsPerHour, kStandardOffsetMs},
+      {june_1 + 2 * DateCache::kMsPerDay, kDaylightOffsetMs},
+      {june_1 + 2 * DateCache::kMsPerDay + 1, kStandardOffsetMs},
+  };
+  TransitionListDateCache date_cache(kStandardOffsetMs, transitions);
+  CheckOffsetsAroundTransitions(&date_cache, transitions);
+}
+
+TEST_F(DateTest, LocalOffsetWithoutKnownTransitions) {
+  // Without known transitions, every lookup has to ask the time zone, which
+  // still gets short-lived changes right.
+  DateCache scratch;
+  int64_t june_1 = TimeFromYearMonthDay(&scratch, 2015, 5, 1);
+  std::vector<TransitionListDateCache::Transition> transitions = {
+      {june_1, kDaylightOffsetMs},
+      {june_1 + kMsPerHour, kStandardOffsetMs},
+  };
+  TransitionListDateCache date_cache(kStandardOffsetMs, transitions);
+  date_cache.set_report_transitions(false);
+  CheckOffsetsAroundTransitions(&date_cache, transitions);
+}
+
+TEST_F(DateTest, LocalOffsetWithMisreportedTransitions) {
+  // Transitions that don't match the offsets are not cached.
+  DateCache scratch;
+  auto transitions = DSTTransitions(&scratch, 2014, 2016);
+  TransitionListDateCache date_cache(kStandardOffsetMs, transitions);
+  date_cache.set_reported_transition_shift_ms(kMsPerHour);
+  CheckOffsetsAroundTransitions(&date_cache, transitions);
+  date_cache.set_reported_transition_shift_ms(-kMsPerHour);
+  date_cache.ResetDateCache(base::TimezoneCache::TimeZoneDetection::kSkip);
+  CheckOffsetsAroundTransitions(&date_cache, transitions);
+}
+
 namespace {
 int legacy_parse_count = 0;
 void DateParseLegacyCounterCallback(v8::Isolate* isolate,
@@ -304,6 +304,43 @@ TEST(WorkListTest, MultipleSegmentsStolen) {
   EXPECT_TRUE(worklist.IsEmpty());
 }
 
+TEST(WorkListTest, StealPrefersMatchingLocality) {
+  TestWorklist worklist;
+  TestWorklist::Local worklist_local1(worklist);
+  TestWorklist::Local worklist_local2(worklist);
+  TestWorklist::Local worklist_local3(worklist);
+  worklist_local1.SetLocality(1);
+  worklist_local2.SetLocality(2);
+  worklist_local3.SetLocality(1);
+  SomeObject dummy1;
+  SomeObject dummy2;
+  for (size_t i = 0; i < TestWorklist::kMinSegmentSizeForTesting; i++) {
+    worklist_local1.Push(&dummy1);
+  }
+  worklist_local1.Publish();
+  for (size_t i = 0; i < TestWorklist::kMinSegmentSizeForTesting; i++) {
+    worklist_local2.Push(&dummy2);
+  }
+  worklist_local2.Publish();
+  EXPECT_EQ(2U, worklist.Size());
+  // The segment of worklist_local2 is on top, but worklist_local3 shares the
+  // locality of worklist_local1.
+  SomeObject* retrieved = nullptr;
+  EXPECT_TRUE(worklist_local3.Pop(&retrieved));
+  EXPECT_EQ(&dummy1, retrieved);
+  EXPECT_EQ(1U, worklist.Size());
+  for (size_t i = 1; i < TestWorklist::kMinSegmentSizeForTesting; i++) {
+    EXPECT_TRUE(worklist_local3.Pop(&retrieved));
+    EXPECT_EQ(&dummy1, retrieved);
+  }
+  // Without a matching segment, stealing falls back to the top-most one.
+  for (size_t i = 0; i < TestWorklist::kMinSegmentSizeForTesting; i++) {
+    EXPECT_TRUE(worklist_local3.Pop(&retrieved));
+    EXPECT_EQ(&dummy2, retrieved);
+  }
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 TEST(WorkListTest, MergeGlobalPool) {
   TestWorklist worklist1;
   TestWorklist::Local worklist_local1(worklist1);
@@ -9,65 +9,110 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+// The registry doesn't access the memory, any page-aligned address will do.
+constexpr Address kChunkStart = Address{4} << kPageSizeBits;
+constexpr Address kPageEnd = kChunkStart + (Address{1} << kPageSizeBits);
+}  // namespace
+
 TEST(CodeObjectRegistry, RegisterAlreadyExistingObjectsAndContains) {
-  CodeObjectRegistry registry;
+  CodeObjectRegistry registry(kChunkStart);
   const int elements = 10;
-  const int offset = 100;
+  const int offset = 4 * kCodeAlignment;
+  std::vector<Address> code_objects;
   for (int i = 0; i < elements; i++) {
-    registry.RegisterNewlyAllocatedCodeObject(i * offset);
+    code_objects.push_back(kChunkStart + i * offset);
   }
+  registry.ReinitializeFrom(std::move(code_objects));
 
   for (int i = 0; i < elements; i++) {
-    CHECK(registry.Contains(i * offset));
+    CHECK(registry.Contains(kChunkStart + i * offset));
+    CHECK(!registry.Contains(kChunkStart + i * offset + kCodeAlignment));
   }
 }
 
 TEST(CodeObjectRegistry, RegisterNewlyAllocatedObjectsAndContains) {
-  CodeObjectRegistry registry;
+  CodeObjectRegistry registry(kChunkStart);
   const int elements = 10;
-  const int offset = 100;
+  const int offset = 4 * kCodeAlignment;
   for (int i = 0; i < elements; i++) {
-    registry.RegisterNewlyAllocatedCodeObject(i * offset);
+    registry.RegisterNewlyAllocatedCodeObject(kChunkStart + i * offset);
   }
 
   for (int i = 0; i < elements; i++) {
-    CHECK(registry.Contains(i * offset));
+    CHECK(registry.Contains(kChunkStart + i * offset));
+    CHECK(!registry.Contains(kChunkStart + i * offset + kCodeAlignment));
   }
 }
 
 TEST(CodeObjectRegistry, FindAlreadyExistingObjects) {
-  CodeObjectRegistry registry;
+  CodeObjectRegistry registry(kChunkStart);
   const int elements = 10;
-  const int offset = 100;
-  const int inner = 2;
+  const int offset = 4 * kCodeAlignment;
+  const int inner = offset;
+  std::vector<Address> code_objects;
   for (int i = 1; i <= elements; i++) {
-    registry.RegisterNewlyAllocatedCodeObject(i * offset);
+    code_objects.push_back(kChunkStart + i * offset);
   }
+  registry.ReinitializeFrom(std::move(code_objects));
 
   for (int i = 1; i <= elements; i++) {
     for (int j = 0; j < inner; j++) {
-      CHECK_EQ(registry.GetCodeObjectStartFromInnerAddress(i * offset + j),
-               i * offset);
+      CHECK_EQ(registry.GetCodeObjectStartFromInnerAddress(kChunkStart +
+                                                           i * offset + j),
+               kChunkStart + i * offset);
     }
   }
 }
 
 TEST(CodeObjectRegistry, FindNewlyAllocatedObjects) {
-  CodeObjectRegistry registry;
+  CodeObjectRegistry registry(kChunkStart);
   const int elements = 10;
-  const int offset = 100;
-  const int inner = 2;
+  const int offset = 4 * kCodeAlignment;
+  const int inner = offset;
   for (int i = 1; i <= elements; i++) {
-    registry.RegisterNewlyAllocatedCodeObject(i * offset);
+    registry.RegisterNewlyAllocatedCodeObject(kChunkStart + i * offset);
   }
 
   for (int i = 1; i <= elements; i++) {
     for (int j = 0; j < inner; j++) {
-      CHECK_EQ(registry.GetCodeObjectStartFromInnerAddress(i * offset + j),
-               i * offset);
+      CHECK_EQ(registry.GetCodeObjectStartFromInnerAddress(kChunkStart +
+                                                           i * offset + j),
+               kChunkStart + i * offset);
     }
   }
 }
 
+TEST(CodeObjectRegistry, FindObjectsSpanningManyCells) {
+  CodeObjectRegistry registry(kChunkStart);
+  // Objects large enough that their start is several bitmap cells away from
+  // addresses at their end, including one ending at the end of the page.
+  const Address first = kChunkStart + kCodeAlignment;
+  const Address second = kChunkStart + 1000 * kCodeAlignment;
+  registry.RegisterNewlyAllocatedCodeObject(first);
+  registry.RegisterNewlyAllocatedCodeObject(second);
+
+  CHECK_EQ(first, registry.GetCodeObjectStartFromInnerAddress(first));
+  CHECK_EQ(first, registry.GetCodeObjectStartFromInnerAddress(second - 1));
+  CHECK_EQ(second, registry.GetCodeObjectStartFromInnerAddress(second));
+  CHECK_EQ(second, registry.GetCodeObjectStartFromInnerAddress(kPageEnd - 1));
+}
+
+TEST(CodeObjectRegistry, ReinitializeDropsDeadObjects) {
+  CodeObjectRegistry registry(kChunkStart);
+  const int offset = 4 * kCodeAlignment;
+  for (int i = 0; i < 10; i++) {
+    registry.RegisterNewlyAllocatedCodeObject(kChunkStart + i * offset);
+  }
+  registry.ReinitializeFrom({kChunkStart, kChunkStart + 5 * offset});
+
+  CHECK(registry.Contains(kChunkStart));
+  CHECK(!registry.Contains(kChunkStart + offset));
+  CHECK(registry.Contains(kChunkStart + 5 * offset));
+  CHECK(!registry.Contains(kChunkStart + 6 * offset));
+  CHECK_EQ(kChunkStart, registry.GetCodeObjectStartFromInnerAddress(
+                            kChunkStart + 5 * offset - 1));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -4,12 +4,15 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <vector>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/custom-space.h"
 #include "include/cppgc/persistent.h"
 #include "src/heap/cppgc/garbage-collector.h"
 #include "src/heap/cppgc/heap-object-header.h"
 #include "src/heap/cppgc/heap-page.h"
+#include "src/heap/cppgc/heap-space.h"
 #include "src/heap/cppgc/marker.h"
 #include "src/heap/cppgc/stats-collector.h"
 #include "test/unittests/heap/cppgc/tests.h"
@@ -23,6 +26,13 @@ class CompactableCustomSpace : public CustomSpace<CompactableCustomSpace> {
   static constexpr bool kSupportsCompaction = true;
 };
 
+class SecondCompactableCustomSpace
+    : public CustomSpace<SecondCompactableCustomSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kSupportsCompaction = true;
+};
+
 namespace internal {
 
 namespace {
@@ -63,12 +73,52 @@ struct CompactableHolder
   CompactableGCed* objects[kNumObjects]{};
 };
 
+// An object that takes up exactly 1KB, including its header, in the
+// compactable custom space with the given index.
+template <size_t kSpaceIndex>
+struct PaddedGCed : public GarbageCollected<PaddedGCed<kSpaceIndex>> {
+ public:
+  ~PaddedGCed() { ++g_destructor_callcount; }
+  void Trace(Visitor*) const {}
+  static size_t g_destructor_callcount;
+  char padding[kKB - sizeof(HeapObjectHeader)];
+};
+// static
+template <size_t kSpaceIndex>
+size_t PaddedGCed<kSpaceIndex>::g_destructor_callcount = 0;
+
+template <typename T>
+struct PaddedHolder : public GarbageCollected<PaddedHolder<T>> {
+ public:
+  static constexpr size_t kMaxObjects = 2048;
+
+  PaddedHolder(cppgc::AllocationHandle& allocation_handle, size_t num_objects)
+      : num_objects(num_objects) {
+    CHECK_LE(num_objects, kMaxObjects);
+    for (size_t i = 0; i < num_objects; ++i)
+      objects[i] = MakeGarbageCollected<T>(allocation_handle);
+  }
+
+  void Trace(Visitor* visitor) const {
+    for (size_t i = 0; i < num_objects; ++i) {
+      VisitorBase::TraceRawForTesting(visitor,
+                                      const_cast<const T*>(objects[i]));
+      visitor->RegisterMovableReference(const_cast<const T**>(&objects[i]));
+    }
+  }
+
+  size_t num_objects;
+  T* objects[kMaxObjects]{};
+};
+
 class CompactorTest : public testing::TestWithPlatform {
  public:
   CompactorTest() {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.custom_spaces.emplace_back(
+        std::make_unique<SecondCompactableCustomSpace>());
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
@@ -88,6 +138,14 @@ class CompactorTest : public testing::TestWithPlatform {
         GCConfig::PreciseIncrementalConfig());
   }
 
+  // Starts a GC that compacts only if the compactor's heuristics ask for it.
+  void StartGCWithCompactionHeuristics() {
+    compactor().InitializeIfShouldCompact(GCConfig::MarkingType::kIncremental,
+                                          StackState::kNoHeapPointers);
+    heap()->StartIncrementalGarbageCollection(
+        GCConfig::PreciseIncrementalConfig());
+  }
+
   void EndGC() {
     heap()->marker()->FinishMarking(StackState::kNoHeapPointers);
     heap()->GetMarkerRefForTesting().reset();
@@ -104,6 +162,10 @@ class CompactorTest : public testing::TestWithPlatform {
     return heap_->GetAllocationHandle();
   }
   Compactor& compactor() { return heap()->compactor(); }
+  NormalPageSpace& CompactableSpace(size_t index) {
+    return *static_cast<NormalPageSpace*>(
+        heap()->raw_heap().CustomSpace(CustomSpaceIndex(index)));
+  }
 
  private:
   std::unique_ptr<cppgc::Heap> heap_;
@@ -118,6 +180,16 @@ struct SpaceTrait<internal::CompactableGCed> {
   using Space = CompactableCustomSpace;
 };
 
+template <>
+struct SpaceTrait<internal::PaddedGCed<0>> {
+  using Space = CompactableCustomSpace;
+};
+
+template <>
+struct SpaceTrait<internal::PaddedGCed<1>> {
+  using Space = SecondCompactableCustomSpace;
+};
+
 namespace internal {
 
 TEST_F(CompactorTest, NothingToCompact) {
@@ -244,5 +316,85 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, OnlyFragmentedSpacesAreCompacted) {
+  using FragmentedGCed = PaddedGCed<0>;
+  using OtherGCed = PaddedGCed<1>;
+  const size_t objects_per_page = NormalPage::PayloadSize() / kKB;
+  // Ten full pages, every other object of which dies, leave about 640KB of
+  // free list entries, which is enough to trigger compaction.
+  Persistent<PaddedHolder<FragmentedGCed>> fragmented =
+      MakeGarbageCollected<PaddedHolder<FragmentedGCed>>(
+          GetAllocationHandle(), GetAllocationHandle(), 10 * objects_per_page);
+  for (size_t i = 0; i < fragmented->num_objects; i += 2) {
+    fragmented->objects[i] = nullptr;
+  }
+  // A single full page, every fourth object of which dies, stays below the
+  // per-space threshold.
+  Persistent<PaddedHolder<OtherGCed>> other =
+      MakeGarbageCollected<PaddedHolder<OtherGCed>>(
+          GetAllocationHandle(), GetAllocationHandle(), objects_per_page);
+  for (size_t i = 0; i < other->num_objects; i += 4) {
+    other->objects[i] = nullptr;
+  }
+  // Sweeping fills the free lists.
+  heap()->CollectGarbage(GCConfig::PreciseAtomicConfig());
+  const size_t fragmented_free_list_size =
+      CompactableSpace(0).free_list().Size();
+  EXPECT_LT(64 * kKB, fragmented_free_list_size);
+  EXPECT_GT(64 * kKB, CompactableSpace(1).free_list().Size());
+
+  std::vector<FragmentedGCed*> fragmented_references(
+      fragmented->objects, fragmented->objects + fragmented->num_objects);
+  other->objects[1] = nullptr;
+  std::vector<OtherGCed*> other_references(
+      other->objects, other->objects + other->num_objects);
+  FragmentedGCed::g_destructor_callcount = 0u;
+  OtherGCed::g_destructor_callcount = 0u;
+  StartGCWithCompactionHeuristics();
+  EXPECT_TRUE(compactor().IsEnabledForTesting());
+  EndGC();
+
+  // The fragmented space was compacted: its objects moved and most of its free
+  // list is gone.
+  size_t moved_objects = 0;
+  for (size_t i = 0; i < fragmented->num_objects; ++i) {
+    if (fragmented->objects[i] != fragmented_references[i]) moved_objects++;
+  }
+  EXPECT_LT(0u, moved_objects);
+  EXPECT_EQ(0u, FragmentedGCed::g_destructor_callcount);
+  EXPECT_GT(fragmented_free_list_size, CompactableSpace(0).free_list().Size());
+  // The other space was swept in place instead.
+  for (size_t i = 0; i < other->num_objects; ++i) {
+    EXPECT_EQ(other_references[i], other->objects[i]);
+  }
+  EXPECT_EQ(1u, OtherGCed::g_destructor_callcount);
+  EXPECT_FALSE(CompactableSpace(0).was_compacted());
+  EXPECT_FALSE(CompactableSpace(1).was_compacted());
+}
+
+TEST_F(CompactorTest, SweeperIgnoresOnlyCompactedSpaces) {
+  PaddedGCed<0>::g_destructor_callcount = 0u;
+  PaddedGCed<1>::g_destructor_callcount = 0u;
+  MakeGarbageCollected<PaddedGCed<0>>(GetAllocationHandle());
+  MakeGarbageCollected<PaddedGCed<1>>(GetAllocationHandle());
+  heap()->object_allocator().ResetLinearAllocationBuffers();
+  CompactableSpace(0).set_was_compacted(true);
+  // Pretend to finish marking as StatsCollector verifies that Notify* methods
+  // are called in the right order.
+  heap()->stats_collector()->NotifyMarkingStarted(
+      CollectionType::kMajor, GCConfig::MarkingType::kAtomic,
+      GCConfig::IsForcedGC::kNotForced);
+  heap()->stats_collector()->NotifyMarkingCompleted(0);
+  const SweepingConfig sweeping_config{
+      SweepingConfig::SweepingType::kAtomic,
+      SweepingConfig::CompactableSpaceHandling::kIgnore};
+  heap()->sweeper().Start(sweeping_config);
+  heap()->sweeper().FinishIfRunning();
+  // Only the space that was not compacted was swept.
+  EXPECT_EQ(0u, PaddedGCed<0>::g_destructor_callcount);
+  EXPECT_EQ(1u, PaddedGCed<1>::g_destructor_callcount);
+  EXPECT_FALSE(CompactableSpace(0).was_compacted());
+}
+
 }  // namespace internal
 }  // namespace cppgc
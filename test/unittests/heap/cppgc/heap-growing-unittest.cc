@@ -172,5 +172,34 @@ TEST(HeapGrowingTest, IncrementalGCFinalized) {
   FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
 }
 
+TEST(HeapGrowingTest, MinorGCNotTriggeredWithoutGenerationalGC) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  constraints.initial_heap_size_bytes = 100 * kMB;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  EXPECT_CALL(gc, CollectGarbage(::testing::_)).Times(0);
+  EXPECT_CALL(gc, StartIncrementalGarbageCollection(::testing::_)).Times(0);
+  FakeAllocate(&stats_collector, growing.limit_for_minor_gc() + 1);
+}
+
+TEST(HeapGrowingTest, MinorGCTriggered) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  constraints.initial_heap_size_bytes = 100 * kMB;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  growing.EnableMinorGCScheduling();
+  EXPECT_GT(growing.limit_for_incremental_gc(), growing.limit_for_minor_gc());
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(&GCConfig::collection_type,
+                                                  CollectionType::kMinor)));
+  EXPECT_CALL(gc, StartIncrementalGarbageCollection(::testing::_)).Times(0);
+  FakeAllocate(&stats_collector, growing.limit_for_minor_gc() + 1);
+}
+
 }  // namespace internal
 }  // namespace cppgc
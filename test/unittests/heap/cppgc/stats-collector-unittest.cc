@@ -57,6 +57,20 @@ TEST_F(StatsCollectorTest, EventPrevGCMarkedObjectSize) {
   EXPECT_EQ(1024u, event.marked_bytes);
 }
 
+TEST_F(StatsCollectorTest, EventFinalizationBatches) {
+  stats.NotifyMarkingStarted(CollectionType::kMajor,
+                             GCConfig::MarkingType::kAtomic,
+                             GCConfig::IsForcedGC::kNotForced);
+  stats.NotifyMarkingCompleted(kNoMarkedBytes);
+  stats.NotifyFinalizationBatch(3);
+  stats.NotifyFinalizationBatch(7);
+  stats.NotifyFinalizationBatch(5);
+  stats.NotifySweepingCompleted(GCConfig::SweepingType::kAtomic);
+  auto event = stats.GetPreviousEventForTesting();
+  EXPECT_EQ(15u, event.finalized_objects);
+  EXPECT_EQ(7u, event.max_finalization_batch_size);
+}
+
 TEST_F(StatsCollectorTest, AllocationNoReportBelowAllocationThresholdBytes) {
   constexpr size_t kObjectSize = 17;
   EXPECT_LT(kObjectSize, StatsCollector::kAllocationThresholdBytes);
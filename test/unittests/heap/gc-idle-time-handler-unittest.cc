@@ -5,6 +5,7 @@
 #include <limits>
 
 #include "src/heap/gc-idle-time-handler.h"
+#include "test/common/flag-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace v8 {
@@ -127,5 +128,96 @@ TEST_F(GCIdleTimeHandlerTest, DoneIfNotMakingProgressOnIncrementalMarking) {
             handler()->Compute(idle_time_ms, heap_state));
 }
 
+TEST(GCIdleTimeHandler, ShouldDoScavengeNewSpaceNotFullEnough) {
+  EXPECT_FALSE(GCIdleTimeHandler::ShouldDoScavenge(100, 1 * MB, 8 * MB,
+                                                   10 * MB));
+}
+
+TEST(GCIdleTimeHandler, ShouldDoScavengeEnoughTime) {
+  const double scavenge_speed = 1 * MB;
+  EXPECT_TRUE(GCIdleTimeHandler::ShouldDoScavenge(10, 6 * MB, 8 * MB,
+                                                  scavenge_speed));
+}
+
+TEST(GCIdleTimeHandler, ShouldDoScavengeNotEnoughTime) {
+  const double scavenge_speed = 1 * MB;
+  EXPECT_FALSE(GCIdleTimeHandler::ShouldDoScavenge(5, 6 * MB, 8 * MB,
+                                                   scavenge_speed));
+}
+
+TEST(GCIdleTimeHandler, ShouldDoScavengeInitialSpeed) {
+  const size_t new_space_size = 6 * MB;
+  const double idle_time_ms =
+      new_space_size / GCIdleTimeHandler::kInitialConservativeScavengeSpeed;
+  EXPECT_FALSE(GCIdleTimeHandler::ShouldDoScavenge(
+      idle_time_ms - 1, new_space_size, 8 * MB, 0));
+  EXPECT_TRUE(GCIdleTimeHandler::ShouldDoScavenge(
+      idle_time_ms * 2, new_space_size, 8 * MB, 0));
+}
+
+TEST_F(GCIdleTimeHandlerTest, ScavengeWhenMarkingIsStopped) {
+  FlagScope<bool> idle_time_scavenge(&v8_flags.idle_time_scavenge, true);
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.new_space_size = 6 * MB;
+  heap_state.new_space_capacity = 8 * MB;
+  heap_state.scavenge_speed_in_bytes_per_ms = 1 * MB;
+  double idle_time_ms = 10.0;
+  EXPECT_EQ(GCIdleTimeAction::kScavenge,
+            handler()->Compute(idle_time_ms, heap_state));
+  // Incremental marking takes precedence over scavenging.
+  heap_state.incremental_marking_stopped = false;
+  if (v8_flags.incremental_marking) {
+    EXPECT_EQ(GCIdleTimeAction::kIncrementalStep,
+              handler()->Compute(idle_time_ms, heap_state));
+  }
+}
+
+TEST_F(GCIdleTimeHandlerTest, NoScavengeWithoutFlag) {
+  FlagScope<bool> idle_time_scavenge(&v8_flags.idle_time_scavenge, false);
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.new_space_size = 6 * MB;
+  heap_state.new_space_capacity = 8 * MB;
+  heap_state.scavenge_speed_in_bytes_per_ms = 1 * MB;
+  double idle_time_ms = 10.0;
+  EXPECT_EQ(GCIdleTimeAction::kDone,
+            handler()->Compute(idle_time_ms, heap_state));
+}
+
+TEST_F(GCIdleTimeHandlerTest, NoScavengeWithoutIdleTime) {
+  FlagScope<bool> idle_time_scavenge(&v8_flags.idle_time_scavenge, true);
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.new_space_size = 6 * MB;
+  heap_state.new_space_capacity = 8 * MB;
+  heap_state.scavenge_speed_in_bytes_per_ms = 1 * MB;
+  EXPECT_EQ(GCIdleTimeAction::kDone, handler()->Compute(0, heap_state));
+}
+
+TEST_F(GCIdleTimeHandlerTest, NoScavengeWhenNewSpaceIsNotFullEnough) {
+  FlagScope<bool> idle_time_scavenge(&v8_flags.idle_time_scavenge, true);
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.new_space_size = 1 * MB;
+  heap_state.new_space_capacity = 8 * MB;
+  heap_state.scavenge_speed_in_bytes_per_ms = 1 * MB;
+  double idle_time_ms = 10.0;
+  EXPECT_EQ(GCIdleTimeAction::kDone,
+            handler()->Compute(idle_time_ms, heap_state));
+}
+
+TEST_F(GCIdleTimeHandlerTest, NoScavengeWhenIdleTimeIsTooShort) {
+  FlagScope<bool> idle_time_scavenge(&v8_flags.idle_time_scavenge, true);
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.new_space_size = 6 * MB;
+  heap_state.new_space_capacity = 8 * MB;
+  heap_state.scavenge_speed_in_bytes_per_ms = 1 * MB;
+  double idle_time_ms = 5.0;
+  EXPECT_EQ(GCIdleTimeAction::kDone,
+            handler()->Compute(idle_time_ms, heap_state));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,7 +6,10 @@
 
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <vector>
 
+#include "include/v8-metrics.h"
 #include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -579,5 +582,74 @@ TEST_F(GCTracerTest, RecordScavengerHistograms) {
   GcHistogram::CleanUp();
 }
 
+namespace {
+
+class GcMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionFullCycle& event,
+                          ContextId context_id) override {
+    full_cycle_events.push_back(event);
+  }
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionYoungCycle& event,
+                          ContextId context_id) override {
+    young_cycle_events.push_back(event);
+  }
+
+  std::vector<v8::metrics::GarbageCollectionFullCycle> full_cycle_events;
+  std::vector<v8::metrics::GarbageCollectionYoungCycle> young_cycle_events;
+};
+
+}  // namespace
+
+TEST_F(GCTracerTest, ReportFullCycleDetailedPhases) {
+  if (v8_flags.stress_incremental_marking) return;
+  if (i_isolate()->heap()->cpp_heap()) return;
+  auto recorder = std::make_shared<GcMetricsRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  tracer->current_.type = GCTracer::Event::MARK_COMPACTOR;
+  tracer->current_.scopes[GCTracer::Scope::MC_MARK_ROOTS] = 1;
+  tracer->current_.scopes[GCTracer::Scope::MC_CLEAR] = 2;
+  tracer->current_.scopes[GCTracer::Scope::MC_EVACUATE_COPY] = 3;
+  tracer->current_.scopes[GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS] = 4;
+  tracer->current_.scopes[GCTracer::Scope::MC_SWEEP] = 5;
+  tracer->ReportFullCycleToRecorder();
+  ASSERT_EQ(1u, recorder->full_cycle_events.size());
+  const v8::metrics::GarbageCollectionDetailedPhases& phases =
+      recorder->full_cycle_events[0].main_thread_atomic_detailed;
+  EXPECT_EQ(1000, phases.roots_wall_clock_duration_in_us);
+  EXPECT_EQ(2000, phases.weak_wall_clock_duration_in_us);
+  EXPECT_EQ(3000, phases.evacuate_wall_clock_duration_in_us);
+  EXPECT_EQ(4000, phases.update_pointers_wall_clock_duration_in_us);
+  EXPECT_EQ(5000, phases.sweep_wall_clock_duration_in_us);
+  tracer->ResetForTesting();
+}
+
+TEST_F(GCTracerTest, ReportYoungCycleDetailedPhases) {
+  if (v8_flags.stress_incremental_marking) return;
+  auto recorder = std::make_shared<GcMetricsRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  tracer->current_.type = GCTracer::Event::SCAVENGER;
+  tracer->current_.scopes[GCTracer::Scope::SCAVENGER_SCAVENGE_ROOTS] = 1;
+  tracer->current_.scopes[GCTracer::Scope::SCAVENGER_SCAVENGE_WEAK] = 2;
+  tracer->current_.scopes[GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL] = 3;
+  tracer->current_.scopes[GCTracer::Scope::SCAVENGER_SCAVENGE_UPDATE_REFS] = 4;
+  tracer->ReportYoungCycleToRecorder();
+  ASSERT_EQ(1u, recorder->young_cycle_events.size());
+  const v8::metrics::GarbageCollectionDetailedPhases& phases =
+      recorder->young_cycle_events[0].main_thread_detailed;
+  EXPECT_EQ(1000, phases.roots_wall_clock_duration_in_us);
+  EXPECT_EQ(2000, phases.weak_wall_clock_duration_in_us);
+  EXPECT_EQ(3000, phases.evacuate_wall_clock_duration_in_us);
+  EXPECT_EQ(4000, phases.update_pointers_wall_clock_duration_in_us);
+  // The Scavenger doesn't sweep, which is reported as zero rather than as
+  // missing.
+  EXPECT_EQ(0, phases.sweep_wall_clock_duration_in_us);
+  tracer->ResetForTesting();
+}
+
 }  // namespace internal
 }  // namespace v8
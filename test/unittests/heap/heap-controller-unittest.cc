@@ -52,6 +52,18 @@ TEST_F(MemoryControllerTest, HeapGrowingFactor) {
                     V8Controller::DynamicGrowingFactor(400, 1, 4.0));
 }
 
+TEST_F(MemoryControllerTest, HeapGrowingFactorWithTargetMutatorUtilization) {
+  CheckEqualRounded(1.818,
+                    V8Controller::DynamicGrowingFactor(20, 1, 4.0, 0.9));
+  CheckEqualRounded(V8HeapTrait::kMinGrowingFactor,
+                    V8Controller::DynamicGrowingFactor(100, 1, 4.0, 0.9));
+  CheckEqualRounded(1.980,
+                    V8Controller::DynamicGrowingFactor(200, 1, 4.0, 0.99));
+  CheckEqualRounded(V8Controller::DynamicGrowingFactor(300, 1, 4.0),
+                    V8Controller::DynamicGrowingFactor(
+                        300, 1, 4.0, V8HeapTrait::kTargetMutatorUtilization));
+}
+
 TEST_F(MemoryControllerTest, MaxHeapGrowingFactor) {
   CheckEqualRounded(1.3, V8Controller::MaxGrowingFactor(V8HeapTrait::kMinSize));
   CheckEqualRounded(1.600,
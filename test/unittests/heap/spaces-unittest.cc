@@ -126,6 +126,35 @@ TEST_F(SpacesTest, WriteBarrierInYoungGenerationFromSpace) {
   EXPECT_FALSE(slim_chunk->InYoungGeneration());
 }
 
+TEST_F(SpacesTest, SurvivalHistory) {
+  const size_t kSizeOfMemoryChunk = sizeof(MemoryChunk);
+  char memory[kSizeOfMemoryChunk];
+  memset(&memory, 0, kSizeOfMemoryChunk);
+  MemoryChunk* chunk = reinterpret_cast<MemoryChunk*>(&memory);
+  EXPECT_EQ(0, chunk->SurvivalSamples());
+  chunk->RecordSurvival(80);
+  EXPECT_EQ(80, chunk->SurvivalRate());
+  EXPECT_EQ(1, chunk->SurvivalSamples());
+  // A single GC with few live bytes does not reset the survival rate.
+  chunk->RecordSurvival(0);
+  EXPECT_EQ(40, chunk->SurvivalRate());
+  chunk->RecordSurvival(80);
+  EXPECT_EQ(60, chunk->SurvivalRate());
+  EXPECT_EQ(3, chunk->SurvivalSamples());
+  chunk->RecordSurvival(0);
+  EXPECT_EQ(30, chunk->SurvivalRate());
+  EXPECT_GE(chunk->SurvivalSamples(), v8_flags.page_promotion_survival_gcs);
+  EXPECT_GE(chunk->SurvivalRate(), v8_flags.page_promotion_survival_threshold);
+  for (int i = 0; i < 2 * kMaxUInt8; i++) {
+    chunk->RecordSurvival(100);
+  }
+  EXPECT_EQ(100, chunk->SurvivalRate());
+  EXPECT_EQ(kMaxUInt8, chunk->SurvivalSamples());
+  chunk->ClearSurvivalHistory();
+  EXPECT_EQ(0, chunk->SurvivalRate());
+  EXPECT_EQ(0, chunk->SurvivalSamples());
+}
+
 TEST_F(SpacesTest, CodeRangeAddressReuse) {
   CodeRangeAddressHint hint;
   const size_t kAnyBaseAlignment = 1;
@@ -6,6 +6,7 @@
 
 #include "src/interpreter/bytecode-label.h"
 #include "src/interpreter/bytecode-register-optimizer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/interpreter/bytecode-utils.h"
 #include "test/unittests/test-utils.h"
 
@@ -88,6 +89,27 @@ TEST_F(BytecodeRegisterOptimizerTest, TemporaryMaterializedForJump) {
   CHECK_EQ(output()->at(0).output.index(), temp.index());
 }
 
+TEST_F(BytecodeRegisterOptimizerTest,
+       EquivalenceKeptOnFallThroughOfConditionalJump) {
+  FlagScope<bool> flag(&v8_flags.ignition_reo_across_conditional_jumps, true);
+  Initialize(3, 1);
+  Register parameter = Register::FromParameterIndex(1);
+  Register temp = NewTemporary();
+  optimizer()->DoLdar(parameter);
+  optimizer()->DoStar(temp);
+  CHECK_EQ(write_count(), 0u);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+  // The accumulator still holds the value of {temp} on the fall-through path.
+  optimizer()->DoLdar(temp);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kReturn,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+}
+
 // Basic Register Optimizations
 
 TEST_F(BytecodeRegisterOptimizerTest, TemporaryNotEmitted) {
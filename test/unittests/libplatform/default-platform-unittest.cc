@@ -3,6 +3,9 @@
 // found in the LICENSE file.
 
 #include "src/libplatform/default-platform.h"
+
+#include <vector>
+
 #include "src/base/platform/semaphore.h"
 #include "src/base/platform/time.h"
 #include "testing/gmock/include/gmock/gmock.h"
@@ -252,6 +255,72 @@ TEST(CustomDefaultPlatformTest, RunBackgroundTask) {
   EXPECT_TRUE(task_executed);
 }
 
+namespace {
+
+class BlockingBackgroundTask : public Task {
+ public:
+  BlockingBackgroundTask(base::Semaphore* started, base::Semaphore* unblock)
+      : started_(started), unblock_(unblock) {}
+
+  void Run() override {
+    started_->Signal();
+    unblock_->Wait();
+  }
+
+ private:
+  base::Semaphore* started_;
+  base::Semaphore* unblock_;
+};
+
+class RecordingBackgroundTask : public Task {
+ public:
+  RecordingBackgroundTask(base::Semaphore* sem, std::vector<int>* order, int id)
+      : sem_(sem), order_(order), id_(id) {}
+
+  void Run() override {
+    order_->push_back(id_);
+    sem_->Signal();
+  }
+
+ private:
+  base::Semaphore* sem_;
+  std::vector<int>* order_;
+  int id_;
+};
+
+}  // namespace
+
+TEST(CustomDefaultPlatformTest, WorkerTasksRunInPriorityOrder) {
+  DefaultPlatform platform(1);
+
+  // Occupy the only worker thread, so that the following tasks are queued.
+  base::Semaphore started(0);
+  base::Semaphore unblock(0);
+  platform.CallOnWorkerThread(
+      std::make_unique<BlockingBackgroundTask>(&started, &unblock));
+  started.Wait();
+
+  base::Semaphore sem(0);
+  std::vector<int> order;
+  platform.CallLowPriorityTaskOnWorkerThread(
+      std::make_unique<RecordingBackgroundTask>(&sem, &order, 0));
+  platform.CallOnWorkerThread(
+      std::make_unique<RecordingBackgroundTask>(&sem, &order, 1));
+  platform.CallBlockingTaskOnWorkerThread(
+      std::make_unique<RecordingBackgroundTask>(&sem, &order, 2));
+  unblock.Signal();
+  for (int i = 0; i < 3; i++) sem.Wait();
+  EXPECT_EQ((std::vector<int>{2, 1, 0}), order);
+}
+
+TEST(CustomDefaultPlatformTest, NumberOfWorkerThreads) {
+  // All priorities share the same worker threads.
+  EXPECT_EQ(1, DefaultPlatform(1).NumberOfWorkerThreads());
+  EXPECT_EQ(3, DefaultPlatform(3).NumberOfWorkerThreads());
+  EXPECT_EQ(8, DefaultPlatform(8).NumberOfWorkerThreads());
+  EXPECT_EQ(16, DefaultPlatform(16).NumberOfWorkerThreads());
+}
+
 TEST(CustomDefaultPlatformTest, PostForegroundTaskAfterPlatformTermination) {
   std::shared_ptr<TaskRunner> foreground_taskrunner;
   {
@@ -473,5 +473,25 @@ TEST_F(StrtodTest, RandomStrtod) {
   }
 }
 
+// Inputs with 16 to 19 significant digits are handled without bignums, longer
+// ones if the truncated significand determines the result.
+TEST_F(StrtodTest, StrtodLongSignificands) {
+  // Ties between two doubles round to even.
+  CHECK_EQ(9007199254740992.0, StrtodChar("9007199254740993", 0));
+  CHECK_EQ(9007199254740996.0, StrtodChar("9007199254740995", 0));
+  CHECK_EQ(9007199254740994.0,
+           StrtodChar("9007199254740993000000000001", -12));
+  CHECK_EQ(1.7976931348623157e308, StrtodChar("17976931348623157", 292));
+  CHECK_EQ(Double(uint64_t{0x000F'FFFF'FFFF'FFFF}).value(),
+           StrtodChar("2225073858507201", -323));
+  CHECK_EQ(1.2345678901234567,
+           StrtodChar("123456789012345678901234567890", -29));
+  CHECK_EQ(7.450580596923828e-09, StrtodChar("7450580596923828125", -27));
+  CHECK_EQ(123456789.01234567, StrtodChar("1234567890123456789", -10));
+  // Just below and just above half of the smallest denormal.
+  CHECK_EQ(0.0, StrtodChar("2470328229206232720882", -345));
+  CHECK_EQ(5e-324, StrtodChar("2470328229206232720883", -345));
+}
+
 }  // namespace base
 }  // namespace v8
@@ -809,6 +809,23 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObject) {
   ExpectScriptTrue("result === result.self");
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithDifferentShapes) {
+  // Records of different shapes give the deserialized objects' initial map
+  // more than one transition, so keys are not matched against an expected
+  // transition key.
+  Local<Value> value = RoundTripTest(
+      "[{ a: 1, b: 'x' }, { c: 2, 0: 3 }, { a: 4, b: 'y' }, { c: 5, 0: 6 },"
+      " { a: 7, \u00e9: 8 }]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 5");
+  ExpectScriptTrue(
+      "result.map(o => Object.keys(o).join()).join(';') === "
+      "'a,b;0,c;a,b;0,c;a,\u00e9'");
+  ExpectScriptTrue("result[2].a === 4 && result[2].b === 'y'");
+  ExpectScriptTrue("result[3].c === 5 && result[3][0] === 6");
+  ExpectScriptTrue("result[4]['\u00e9'] === 8");
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObject) {
   // Empty object.
   DecodeTestFutureVersions(
@@ -151,6 +151,38 @@ TEST_F(WeakMapsTest, Shrinking) {
   CHECK_EQ(32, EphemeronHashTable::cast(weakmap->table()).Capacity());
 }
 
+TEST_F(WeakMapsTest, LargeWeakMapClearing) {
+  // Enough entries for the table to be cleared in several parallel ranges.
+  constexpr int kEntries = 40000;
+  Isolate* isolate = i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmap = isolate->factory()->NewJSWeakMap();
+  Handle<FixedArray> alive = factory->NewFixedArray(kEntries / 2);
+
+  // Keep every other key alive.
+  {
+    HandleScope inner_scope(isolate);
+    Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+    for (int i = 0; i < kEntries; i++) {
+      Handle<JSObject> object = factory->NewJSObjectFromMap(map);
+      Handle<Smi> smi(Smi::FromInt(i), isolate);
+      int32_t object_hash = object->GetOrCreateHash(isolate).value();
+      JSWeakCollection::Set(weakmap, object, smi, object_hash);
+      if (i % 2 == 0) alive->set(i / 2, *object);
+    }
+  }
+  CHECK_EQ(kEntries,
+           EphemeronHashTable::cast(weakmap->table()).NumberOfElements());
+
+  PreciseCollectAllGarbage();
+  EphemeronHashTable table = EphemeronHashTable::cast(weakmap->table());
+  CHECK_EQ(kEntries / 2, table.NumberOfElements());
+  for (int i = 0; i < kEntries / 2; i++) {
+    CHECK_EQ(2 * i, Smi::ToInt(table.Lookup(handle(alive->get(i), isolate))));
+  }
+}
+
 namespace {
 bool EphemeronHashTableContainsKey(EphemeronHashTable table, HeapObject key) {
   for (InternalIndex i : table.IterateEntries()) {
@@ -412,6 +412,36 @@ TEST_F(ScannerStreamsTest, Utf8SingleByteChunks) {
   }
 }
 
+TEST_F(ScannerStreamsTest, Utf8SeekWithinMixedChunks) {
+  // Mostly-ascii chunks with a multi-byte char in the middle, to exercise the
+  // ascii fast paths on both sides of it.
+  const char* chunks[] = {"abc\xc3\xa4"
+                          "defghij",
+                          "klm\xe2\xa8\xa0"
+                          "nop",
+                          ""};
+  const uint16_t expected[] = {97,  98,  99,  228, 100,   101, 102, 103, 104,
+                               105, 106, 107, 108, 109, 10784, 110, 111, 112};
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+  for (size_t i = 0; i < arraysize(expected); i++) {
+    CHECK_EQ(expected[i], stream->Advance());
+  }
+  CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput, stream->Advance());
+
+  // Fresh clones share the fetched chunks but have an empty buffer, so each
+  // seek has to skip through the chunk data.
+  for (size_t i = 0; i < arraysize(expected); i++) {
+    std::unique_ptr<v8::internal::Utf16CharacterStream> clone =
+        stream->Clone();
+    clone->Seek(i);
+    CHECK_EQ(expected[i], clone->Advance());
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
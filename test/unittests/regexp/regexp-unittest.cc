@@ -1256,6 +1256,7 @@ TEST_F(RegExpTest, MacroAssembler) {
   Handle<ByteArray> array = Handle<ByteArray>::cast(m.GetCode(source));
   int captures[5];
   std::memset(captures, 0, sizeof(captures));
+  uint32_t backtrack_count;
 
   const base::uc16 str1[] = {'f', 'o', 'o', 'b', 'a', 'r'};
   Handle<String> f1_16 =
@@ -1265,7 +1266,8 @@ TEST_F(RegExpTest, MacroAssembler) {
   CHECK_EQ(IrregexpInterpreter::SUCCESS,
            IrregexpInterpreter::MatchInternal(
                isolate(), *array, *f1_16, captures, 5, 5, 0,
-               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit));
+               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit,
+               &backtrack_count));
   CHECK_EQ(0, captures[0]);
   CHECK_EQ(3, captures[1]);
   CHECK_EQ(1, captures[2]);
@@ -1281,7 +1283,8 @@ TEST_F(RegExpTest, MacroAssembler) {
   CHECK_EQ(IrregexpInterpreter::FAILURE,
            IrregexpInterpreter::MatchInternal(
                isolate(), *array, *f2_16, captures, 5, 5, 0,
-               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit));
+               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit,
+               &backtrack_count));
   // Failed matches don't alter output registers.
   CHECK_EQ(0, captures[0]);
   CHECK_EQ(0, captures[1]);
@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,86 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPool) {
+  AccountingAllocator allocator;
+  size_t used;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+    used = allocator.GetCurrentMemoryUsage();
+    EXPECT_LT(0u, used);
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+  }
+  // The zone's segment is pooled rather than freed ...
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(used, allocator.GetPooledMemory());
+  {
+    // ... and reused by the next zone.
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+    EXPECT_EQ(used, allocator.GetCurrentMemoryUsage());
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+  }
+  EXPECT_EQ(used, allocator.GetPooledMemory());
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
+TEST_F(ZoneTest, SegmentPoolSizeLimit) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 0);
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+  }
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
+TEST_F(ZoneTest, SegmentPoolSkipsLargeSegments) {
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * MB);
+  }
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
+using ZoneSegmentPoolTest = TestWithIsolate;
+
+namespace {
+
+void PoolSegment(AccountingAllocator* allocator) {
+  {
+    Zone zone(allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+  }
+  EXPECT_LT(0u, allocator->GetPooledMemory());
+}
+
+}  // namespace
+
+TEST_F(ZoneSegmentPoolTest, ReleasedOnLowMemoryNotification) {
+  AccountingAllocator* allocator = i_isolate()->allocator();
+  PoolSegment(allocator);
+  isolate()->LowMemoryNotification();
+  EXPECT_EQ(0u, allocator->GetPooledMemory());
+}
+
+TEST_F(ZoneSegmentPoolTest, ReleasedInBackground) {
+  AccountingAllocator* allocator = i_isolate()->allocator();
+  PoolSegment(allocator);
+  isolate()->IsolateInBackgroundNotification();
+  EXPECT_EQ(0u, allocator->GetPooledMemory());
+  isolate()->IsolateInForegroundNotification();
+}
+
+TEST_F(ZoneSegmentPoolTest, ReleasedWhenIdle) {
+  FlagScope<bool> incremental_marking(&v8_flags.incremental_marking, false);
+  AccountingAllocator* allocator = i_isolate()->allocator();
+  PoolSegment(allocator);
+  isolate()->IdleNotificationForMilliseconds(100);
+  EXPECT_EQ(0u, allocator->GetPooledMemory());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -33,6 +33,29 @@ parser.add_argument(
     default=Path("out"),
     help='directory to be used for building V8, by default `./out`',
     type=Path)
+parser.add_argument(
+    '--gn-args',
+    default=None,
+    help='file with additional gn args describing the embedder\'s ' +
+    'configuration; they are used both for the instrumented build and, ' +
+    'with --build-with-profile, for the final build',
+    type=Path)
+parser.add_argument(
+    '--d8-flags',
+    default="",
+    help='additional d8 flags used while running the benchmark, separated by '
+    + 'spaces')
+parser.add_argument(
+    '--profile-path',
+    default=None,
+    help='where to write the profile, by default ' +
+    '`tools/builtins-pgo/<v8_target_cpu>.profile`',
+    type=Path)
+parser.add_argument(
+    '--build-with-profile',
+    default=False,
+    help='Build d8 again with the generated profile applied to the builtins.',
+    action=argparse.BooleanOptionalAction)
 
 args = parser.parse_args()
 
@@ -87,19 +110,32 @@ is_debug = false
 target_cpu = "{args.target_cpu}"
 v8_target_cpu = "{args.v8_target_cpu}"
 use_goma = {has_goma_str}
-v8_enable_builtins_profiling = true
 """
 
+extra_gn_args = ""
+if args.gn_args is not None:
+  extra_gn_args = args.gn_args.read_text().rstrip("\n") + "\n"
+
 for arch, gn_args in [(args.v8_target_cpu, GN_ARGS_TEMPLATE)]:
   build_dir = args.out_path / f"{arch}.release.generate_builtin_pgo_profile"
-  d8_path = build_d8(build_dir, gn_args)
+  d8_path = build_d8(
+      build_dir,
+      gn_args + extra_gn_args + "v8_enable_builtins_profiling = true\n")
   benchmark_dir = args.benchmark_path.parent
   benchmark_file = args.benchmark_path.name
   log_path = (build_dir / "v8.builtins.pgo").absolute()
-  cmd = cmd_prefix + [
-      d8_path, f"--turbo-profiling-output={log_path}", benchmark_file
-  ]
+  cmd = cmd_prefix + [d8_path, f"--turbo-profiling-output={log_path}"
+                     ] + args.d8_flags.split() + [benchmark_file]
   run(cmd, cwd=benchmark_dir)
   get_hints_path = tools_pgo_dir / "get_hints.py"
-  profile_path = tools_pgo_dir / f"{arch}.profile"
+  profile_path = args.profile_path
+  if profile_path is None:
+    profile_path = tools_pgo_dir / f"{arch}.profile"
+  profile_path = profile_path.absolute()
   run([get_hints_path, log_path, profile_path])
+
+  if args.build_with_profile:
+    # mksnapshot picks the profile up through v8_builtins_profiling_log_file.
+    pgo_build_dir = args.out_path / f"{arch}.release.builtin_pgo"
+    pgo_gn_args = f"v8_builtins_profiling_log_file = \"{profile_path}\"\n"
+    build_d8(pgo_build_dir, gn_args + extra_gn_args + pgo_gn_args)